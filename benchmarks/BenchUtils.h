@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ZILLIQA_BENCHMARKS_BENCHUTILS_H_
+#define ZILLIQA_BENCHMARKS_BENCHUTILS_H_
+
+#include <Schnorr.h>
+#include <vector>
+
+#include "common/Hashes.h"
+#include "depends/common/SHA3.h"
+#include "libData/AccountData/Transaction.h"
+#include "libUtils/DataConversion.h"
+
+namespace bench {
+
+/// Deterministic, well spread hash for index i.
+inline dev::h256 HashOf(uint64_t i) {
+  return dev::sha3(dev::zbytesConstRef(reinterpret_cast<const uint8_t*>(&i),
+                                       sizeof(i)));
+}
+
+/// Signed plain transfers, each from its own sender. Signing is slow, so the
+/// set is built once and grown on demand.
+inline const std::vector<Transaction>& SignedTransfers(size_t count) {
+  static std::vector<Transaction> txns;
+  Address toAddr;
+  toAddr.asArray().fill(0x42);
+  while (txns.size() < count) {
+    txns.emplace_back(DataConversion::Pack(CHAIN_ID, 1), txns.size() + 1,
+                      toAddr, Schnorr::GenKeyPair(), 100,
+                      PRECISION_MIN_VALUE + txns.size() % 7, 50, zbytes{},
+                      zbytes{});
+  }
+  return txns;
+}
+
+}  // namespace bench
+
+#endif  // ZILLIQA_BENCHMARKS_BENCHUTILS_H_
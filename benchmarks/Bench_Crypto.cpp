@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "BenchUtils.h"
+#include "libCrypto/Sha2.h"
+
+namespace {
+
+void BM_Sha256(benchmark::State& state) {
+  const zbytes input(state.range(0), 0xAB);
+  for (auto _ : state) {
+    SHA256Calculator sha2;
+    sha2.Update(input);
+    benchmark::DoNotOptimize(sha2.Finalize());
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_Sha256)->Arg(64)->Arg(1 << 10)->Arg(64 << 10);
+
+void BM_Sha3(benchmark::State& state) {
+  const zbytes input(state.range(0), 0xAB);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(dev::sha3(input));
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_Sha3)->Arg(64)->Arg(1 << 10)->Arg(64 << 10);
+
+void BM_SchnorrSign(benchmark::State& state) {
+  const PairOfKey keys = Schnorr::GenKeyPair();
+  const zbytes message(256, 0x11);
+  Signature signature;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        Schnorr::Sign(message, keys.first, keys.second, signature));
+  }
+}
+BENCHMARK(BM_SchnorrSign);
+
+void BM_SchnorrVerify(benchmark::State& state) {
+  const PairOfKey keys = Schnorr::GenKeyPair();
+  const zbytes message(256, 0x11);
+  Signature signature;
+  Schnorr::Sign(message, keys.first, keys.second, signature);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Schnorr::Verify(message, signature, keys.second));
+  }
+}
+BENCHMARK(BM_SchnorrVerify);
+
+void BM_TransactionVerifyBatch(benchmark::State& state) {
+  const auto& all = bench::SignedTransfers(state.range(0));
+  const std::vector<Transaction> txns(all.begin(),
+                                      all.begin() + state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Transaction::VerifyBatch(txns));
+  }
+  state.SetItemsProcessed(state.iterations() * txns.size());
+}
+BENCHMARK(BM_TransactionVerifyBatch)->Arg(1000)->UseRealTime();
+
+}  // namespace
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "BenchUtils.h"
+#include "libBlockchain/MicroBlock.h"
+#include "libBlockchain/TxBlock.h"
+#include "libData/AccountStore/AccountStore.h"
+
+namespace {
+
+constexpr unsigned int COMMITTEE_SIZE = 600;
+
+TxBlock MakeTxBlock(int64_t numMicroBlocks) {
+  std::vector<MicroBlockInfo> mbInfos;
+  for (int64_t i = 0; i < numMicroBlocks; ++i) {
+    mbInfos.push_back({bench::HashOf(2 * i), bench::HashOf(2 * i + 1),
+                       static_cast<uint32_t>(i)});
+  }
+  TxBlockHeader header(1000000, 50000, 100, 12345, {}, 2000,
+                       Schnorr::GenKeyPair().second, 123);
+  return TxBlock(header, mbInfos, CoSignatures(COMMITTEE_SIZE));
+}
+
+MicroBlock MakeMicroBlock(int64_t numTxns) {
+  std::vector<TxnHash> tranHashes;
+  for (int64_t i = 0; i < numTxns; ++i) {
+    tranHashes.push_back(bench::HashOf(i));
+  }
+  MicroBlockHeader header(0, 1000000, 50000, 100, 12345, {},
+                          static_cast<uint32_t>(numTxns),
+                          Schnorr::GenKeyPair().second, 123);
+  return MicroBlock(header, std::move(tranHashes),
+                    CoSignatures(COMMITTEE_SIZE));
+}
+
+void BM_TxBlockSerialize(benchmark::State& state) {
+  const TxBlock block = MakeTxBlock(state.range(0));
+  for (auto _ : state) {
+    zbytes dst;
+    benchmark::DoNotOptimize(block.Serialize(dst, 0));
+  }
+}
+BENCHMARK(BM_TxBlockSerialize)->Arg(4)->Arg(64);
+
+void BM_TxBlockDeserialize(benchmark::State& state) {
+  zbytes src;
+  MakeTxBlock(state.range(0)).Serialize(src, 0);
+  for (auto _ : state) {
+    TxBlock block;
+    benchmark::DoNotOptimize(block.Deserialize(src, 0));
+  }
+  state.SetBytesProcessed(state.iterations() * src.size());
+}
+BENCHMARK(BM_TxBlockDeserialize)->Arg(4)->Arg(64);
+
+void BM_MicroBlockSerialize(benchmark::State& state) {
+  const MicroBlock block = MakeMicroBlock(state.range(0));
+  for (auto _ : state) {
+    zbytes dst;
+    benchmark::DoNotOptimize(block.Serialize(dst, 0));
+  }
+}
+BENCHMARK(BM_MicroBlockSerialize)->Arg(100)->Arg(5000);
+
+void BM_MicroBlockDeserialize(benchmark::State& state) {
+  zbytes src;
+  MakeMicroBlock(state.range(0)).Serialize(src, 0);
+  for (auto _ : state) {
+    MicroBlock block;
+    benchmark::DoNotOptimize(block.Deserialize(src, 0));
+  }
+  state.SetBytesProcessed(state.iterations() * src.size());
+}
+BENCHMARK(BM_MicroBlockDeserialize)->Arg(100)->Arg(5000);
+
+// Fills the temp store with count changed accounts on top of an empty state.
+void PrepareDelta(int64_t count) {
+  auto& store = AccountStore::GetInstance();
+  store.Init();
+  store.InitTemp();
+  for (int64_t i = 0; i < count; ++i) {
+    Address address;
+    const auto hash = bench::HashOf(i);
+    std::copy_n(hash.asArray().begin(), Address::size,
+                address.asArray().begin());
+    store.AddAccountTemp(address, {static_cast<uint128_t>(1000 + i), 1});
+  }
+}
+
+void BM_StateDeltaSerialize(benchmark::State& state) {
+  PrepareDelta(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(AccountStore::GetInstance().SerializeDelta());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StateDeltaSerialize)
+    ->Arg(1000)
+    ->Arg(20000)
+    ->Unit(benchmark::kMillisecond);
+
+void BM_StateDeltaDeserialize(benchmark::State& state) {
+  PrepareDelta(state.range(0));
+  auto& store = AccountStore::GetInstance();
+  store.SerializeDelta();
+  zbytes delta;
+  store.GetSerializedDelta(delta);
+  for (auto _ : state) {
+    state.PauseTiming();
+    store.InitTemp();
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(store.DeserializeDeltaTemp(delta, 0));
+  }
+  state.SetBytesProcessed(state.iterations() * delta.size());
+}
+BENCHMARK(BM_StateDeltaDeserialize)
+    ->Arg(1000)
+    ->Arg(20000)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "BenchUtils.h"
+#include "libNode/RootComputation.h"
+
+namespace {
+
+void BM_ComputeRootHashes(benchmark::State& state) {
+  std::vector<dev::h256> hashes;
+  for (int64_t i = 0; i < state.range(0); ++i) {
+    hashes.push_back(bench::HashOf(i));
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ComputeRoot(hashes));
+  }
+  state.SetItemsProcessed(state.iterations() * hashes.size());
+}
+BENCHMARK(BM_ComputeRootHashes)->Arg(100)->Arg(10000);
+
+void BM_ComputeRootTransactions(benchmark::State& state) {
+  std::unordered_map<TxnHash, Transaction> txns;
+  for (const auto& txn : bench::SignedTransfers(state.range(0))) {
+    txns.emplace(txn.GetTranID(), txn);
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ComputeRoot(txns));
+  }
+  state.SetItemsProcessed(state.iterations() * txns.size());
+}
+BENCHMARK(BM_ComputeRootTransactions)->Arg(1000);
+
+}  // namespace
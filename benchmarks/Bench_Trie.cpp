@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <thread>
+
+#include "BenchUtils.h"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#include "depends/libDatabase/MemoryDB.h"
+#include "depends/libDatabase/OverlayDB.h"
+#pragma GCC diagnostic pop
+#include "depends/libTrie/TrieDB.h"
+
+namespace {
+
+// Account-like entries: 40 byte hex address keys and ~100 byte values.
+std::vector<std::pair<zbytes, zbytes>> MakeEntries(int64_t count,
+                                                   uint64_t salt = 0) {
+  std::vector<std::pair<zbytes, zbytes>> entries;
+  entries.reserve(count);
+  for (int64_t i = 0; i < count; ++i) {
+    entries.emplace_back(dev::asBytes(bench::HashOf(i).hex().substr(0, 40)),
+                         zbytes(100, static_cast<uint8_t>(i + salt)));
+  }
+  return entries;
+}
+
+void BM_TrieInsert(benchmark::State& state) {
+  const auto entries = MakeEntries(state.range(0));
+  for (auto _ : state) {
+    dev::MemoryDB db;
+    dev::GenericTrieDB<dev::MemoryDB> trie(&db);
+    trie.init();
+    for (const auto& entry : entries) {
+      trie.insert(entry.first, entry.second);
+    }
+    benchmark::DoNotOptimize(trie.root());
+  }
+  state.SetItemsProcessed(state.iterations() * entries.size());
+}
+BENCHMARK(BM_TrieInsert)->Arg(1000)->Arg(20000)->Unit(benchmark::kMillisecond);
+
+void BM_TrieInsertBatch(benchmark::State& state) {
+  const auto entries = MakeEntries(state.range(0));
+  const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+  for (auto _ : state) {
+    dev::MemoryDB db;
+    dev::GenericTrieDB<dev::MemoryDB> trie(&db);
+    trie.init();
+    trie.insertBatch(entries, threads);
+    benchmark::DoNotOptimize(trie.root());
+  }
+  state.SetItemsProcessed(state.iterations() * entries.size());
+}
+BENCHMARK(BM_TrieInsertBatch)
+    ->Arg(1000)
+    ->Arg(20000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Scaling with the number of threads, on 20000 entries.
+void BM_TrieInsertBatchThreads(benchmark::State& state) {
+  const auto entries = MakeEntries(20000);
+  const unsigned threads = state.range(0);
+  for (auto _ : state) {
+    dev::MemoryDB db;
+    dev::GenericTrieDB<dev::MemoryDB> trie(&db);
+    trie.init();
+    benchmark::DoNotOptimize(trie.insertBatch(entries, threads));
+    benchmark::DoNotOptimize(trie.root());
+  }
+  state.SetItemsProcessed(state.iterations() * entries.size());
+}
+BENCHMARK(BM_TrieInsertBatchThreads)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+void BM_TrieCommit(benchmark::State& state) {
+  dev::OverlayDB db("benchmark_trie");
+  dev::GenericTrieDB<dev::OverlayDB> trie(&db);
+  trie.init();
+  uint64_t round = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (const auto& entry : MakeEntries(state.range(0), ++round)) {
+      trie.insert(entry.first, entry.second);
+    }
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(db.commit());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  db.ResetDB();
+}
+BENCHMARK(BM_TrieCommit)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+}  // namespace
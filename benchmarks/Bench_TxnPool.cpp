@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "BenchUtils.h"
+#include "libData/AccountData/TxnPool.h"
+
+namespace {
+
+void BM_TxnPoolInsert(benchmark::State& state) {
+  const auto& txns = bench::SignedTransfers(state.range(0));
+  MempoolInsertionStatus status;
+  for (auto _ : state) {
+    TxnPool pool;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      pool.insert(txns[i], status);
+    }
+    benchmark::DoNotOptimize(pool.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TxnPoolInsert)->Arg(1000)->Arg(10000);
+
+void BM_TxnPoolFindOne(benchmark::State& state) {
+  const auto& txns = bench::SignedTransfers(state.range(0));
+  MempoolInsertionStatus status;
+  for (auto _ : state) {
+    state.PauseTiming();
+    TxnPool pool;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      pool.insert(txns[i], status);
+    }
+    state.ResumeTiming();
+
+    // Drains the pool in gas price order, as the shard leader does.
+    Transaction txn;
+    while (pool.findOne(txn)) {
+      benchmark::DoNotOptimize(txn);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TxnPoolFindOne)->Arg(1000)->Arg(10000);
+
+}  // namespace
@@ -227,6 +227,10 @@ do
         CMAKE_EXTRA_OPTIONS="-DTESTS=ON ${CMAKE_EXTRA_OPTIONS}"
         echo "Build tests"
     ;;
+    benchmarks)
+        CMAKE_EXTRA_OPTIONS="-DBENCHMARKS=ON ${CMAKE_EXTRA_OPTIONS}"
+        echo "Build benchmarks"
+    ;;
     coverage)
         CMAKE_EXTRA_OPTIONS="-DLLVM_EXTRA_TOOLS=ON -DENABLE_COVERAGE=ON ${CMAKE_EXTRA_OPTIONS}"
         run_code_coverage=1
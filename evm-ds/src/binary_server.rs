@@ -0,0 +1,85 @@
+//! Binary transport for the node.
+//!
+//! Serves the same `run` method as the JSON-RPC socket, but over a separate Unix domain
+//! socket with length-prefixed protobuf frames, so that the node can keep connections open
+//! and skip the JSON and base64 layers.
+//!
+//! Request:  u32 big-endian length, then a serialized `EvmArgs`.
+//! Response: u32 big-endian length, then a status byte (0 = serialized `EvmResult`,
+//!           1 = UTF-8 error message), then the payload. The length covers the status byte.
+//!
+//! Each connection serves its requests one at a time; the node opens several connections
+//! to run calls concurrently.
+
+use std::sync::Arc;
+
+use anyhow::{anyhow, Result};
+use log::{debug, error, info};
+use tokio::io::{AsyncReadExt, AsyncWriteExt};
+use tokio::net::{UnixListener, UnixStream};
+
+use crate::evm_server::EvmServer;
+
+/// Frames larger than this are rejected and the connection is dropped.
+pub const MAX_FRAME_SIZE: u32 = 256 * 1024 * 1024;
+
+const STATUS_OK: u8 = 0;
+const STATUS_ERROR: u8 = 1;
+
+/// Starts serving on `path` on a dedicated thread with its own tokio runtime.
+pub fn start(
+    path: String,
+    evm_server: Arc<EvmServer>,
+) -> std::io::Result<std::thread::JoinHandle<()>> {
+    let _ = std::fs::remove_file(&path);
+    let runtime = tokio::runtime::Runtime::new()?;
+    let listener = {
+        let _guard = runtime.enter();
+        UnixListener::bind(&path)?
+    };
+    info!("Binary transport listening on {path}");
+    Ok(std::thread::spawn(move || {
+        runtime.block_on(async move {
+            loop {
+                match listener.accept().await {
+                    Ok((stream, _)) => {
+                        let evm_server = evm_server.clone();
+                        tokio::spawn(async move {
+                            if let Err(e) = serve_connection(stream, evm_server).await {
+                                debug!("Binary transport connection closed: {e}");
+                            }
+                        });
+                    }
+                    Err(e) => error!("Binary transport accept failed: {e}"),
+                }
+            }
+        })
+    }))
+}
+
+async fn serve_connection(mut stream: UnixStream, evm_server: Arc<EvmServer>) -> Result<()> {
+    loop {
+        let length = match stream.read_u32().await {
+            Ok(length) => length,
+            // The node closed an idle connection.
+            Err(e) if e.kind() == std::io::ErrorKind::UnexpectedEof => return Ok(()),
+            Err(e) => return Err(e.into()),
+        };
+        if length > MAX_FRAME_SIZE {
+            return Err(anyhow!("request frame of {length} bytes is too large"));
+        }
+        let mut payload = vec![0u8; length as usize];
+        stream.read_exact(&mut payload).await?;
+
+        let (status, body) = match evm_server.run_binary(&payload).await {
+            Ok(result) => (STATUS_OK, result),
+            Err(e) => (STATUS_ERROR, e.message.into_bytes()),
+        };
+
+        let mut frame = Vec::with_capacity(5 + body.len());
+        frame.extend_from_slice(&((body.len() + 1) as u32).to_be_bytes());
+        frame.push(status);
+        frame.extend_from_slice(&body);
+        stream.write_all(&frame).await?;
+    }
+}
@@ -20,7 +20,6 @@ pub(crate) struct EvmServer {
 }
 
 impl EvmServer {
-    #[allow(dead_code)]
     pub fn new(backend_config: ScillaBackendConfig, gas_scaling_factor: u64) -> Self {
         Self {
             backend_config,
@@ -29,7 +28,6 @@ impl EvmServer {
         }
     }
 
-    #[allow(dead_code)]
     pub fn run_json(&self, params: jsonrpc_core::Params) -> BoxFuture<Result<jsonrpc_core::Value>> {
         let args = jsonrpc_core::Value::from(params);
         if let Some(arg) = args.get(0) {
@@ -46,7 +44,6 @@ impl EvmServer {
         }
     }
 
-    #[allow(dead_code)]
     fn run(&self, args_str: String) -> BoxFuture<Result<String>> {
         let args_parsed = base64::decode(args_str)
             .map_err(|_| Error::invalid_params("cannot decode base64"))
@@ -56,48 +53,60 @@ impl EvmServer {
             });
 
         match args_parsed {
-            Ok(mut args) => {
-                let origin = H160::from(args.get_origin());
-                let address = H160::from(args.get_address());
-                let code = Vec::from(args.get_code());
-                let data = Vec::from(args.get_data());
-                let apparent_value = U256::from(args.get_apparent_value());
-                let gas_limit = args.get_gas_limit();
-                let estimate = args.get_estimate();
-                let caller = H160::from(args.get_caller());
-                let backend =
-                    ScillaBackend::new(self.backend_config.clone(), origin, args.take_extras());
-                let gas_scaling_factor = self.gas_scaling_factor;
-                let is_static = args.get_is_static_call();
+            Ok(args) => self
+                .run_args(args)
+                .map(|result| result.map(base64::encode))
+                .boxed(),
+            Err(e) => futures::future::err(e).boxed(),
+        }
+    }
 
-                let node_continuation = if args.get_continuation().get_id() == 0 {
-                    None
-                } else {
-                    Some(args.take_continuation())
-                };
+    /// Runs a raw protobuf-encoded `EvmArgs` and returns the raw `EvmResult` bytes.
+    /// Used by the binary transport, which skips the JSON and base64 layers.
+    pub fn run_binary(&self, payload: &[u8]) -> BoxFuture<Result<Vec<u8>>> {
+        match EvmProto::EvmArgs::parse_from_bytes(payload) {
+            Ok(args) => self.run_args(args),
+            Err(e) => futures::future::err(Error::invalid_params(format!("{e}"))).boxed(),
+        }
+    }
 
-                run_evm_impl(
-                    address,
-                    code,
-                    data,
-                    apparent_value,
-                    gas_limit,
-                    caller,
-                    backend,
-                    gas_scaling_factor,
-                    estimate,
-                    is_static,
-                    args.get_context().to_string(),
-                    node_continuation,
-                    self.continuations.clone(),
-                    args.get_enable_cps(),
-                    args.get_tx_trace_enabled(),
-                    args.get_tx_trace().to_string(),
-                )
-                .boxed()
-            }
+    fn run_args(&self, mut args: EvmProto::EvmArgs) -> BoxFuture<Result<Vec<u8>>> {
+        let origin = H160::from(args.get_origin());
+        let address = H160::from(args.get_address());
+        let code = Vec::from(args.get_code());
+        let data = Vec::from(args.get_data());
+        let apparent_value = U256::from(args.get_apparent_value());
+        let gas_limit = args.get_gas_limit();
+        let estimate = args.get_estimate();
+        let caller = H160::from(args.get_caller());
+        let backend = ScillaBackend::new(self.backend_config.clone(), origin, args.take_extras());
+        let gas_scaling_factor = self.gas_scaling_factor;
+        let is_static = args.get_is_static_call();
 
-            Err(e) => futures::future::err(e).boxed(),
-        }
+        let node_continuation = if args.get_continuation().get_id() == 0 {
+            None
+        } else {
+            Some(args.take_continuation())
+        };
+
+        run_evm_impl(
+            address,
+            code,
+            data,
+            apparent_value,
+            gas_limit,
+            caller,
+            backend,
+            gas_scaling_factor,
+            estimate,
+            is_static,
+            args.get_context().to_string(),
+            node_continuation,
+            self.continuations.clone(),
+            args.get_enable_cps(),
+            args.get_tx_trace_enabled(),
+            args.get_tx_trace().to_string(),
+        )
+        .boxed()
     }
 }
@@ -45,7 +45,7 @@ pub async fn run_evm_impl(
     enable_cps: bool,
     tx_trace_enabled: bool,
     tx_trace: String,
-) -> Result<String> {
+) -> Result<Vec<u8>> {
     // We must spawn a separate blocking task (on a blocking thread), because by default a JSONRPC
     // method runs as a non-blocking thread under a tokio runtime, and creating a new runtime
     // cannot be done. And we'll need a new runtime that we can safely drop on a handled
@@ -71,7 +71,7 @@ pub async fn run_evm_impl(
             tx_trace,
         );
 
-        Ok(base64::encode(result.write_to_bytes().unwrap()))
+        Ok(result.write_to_bytes().unwrap())
     })
     .await
     .unwrap()
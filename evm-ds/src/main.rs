@@ -3,6 +3,7 @@
 // #![deny(warnings)]
 #![forbid(unsafe_code)]
 
+mod binary_server;
 mod continuations;
 mod convert;
 mod cps_executor;
@@ -41,6 +42,11 @@ struct Args {
     #[clap(short, long, default_value = "/tmp/evm-server.sock")]
     socket: String,
 
+    /// Path of the binary (length-prefixed protobuf) EVM server Unix domain socket.
+    /// Not served unless set.
+    #[clap(long)]
+    binary_socket: Option<String>,
+
     /// Path of the Node Unix domain socket.
     #[clap(short, long, default_value = "/tmp/zilliqa.sock")]
     node_socket: String,
@@ -365,7 +371,12 @@ fn main() -> std::result::Result<(), Box<dyn std::error::Error>> {
         zil_scaling_factor: args.zil_scaling_factor,
     };
 
-    let evm_server = EvmServer::new(backend_config, args.gas_scaling_factor);
+    let evm_server = Arc::new(EvmServer::new(backend_config, args.gas_scaling_factor));
+
+    if let Some(binary_socket) = args.binary_socket {
+        binary_server::start(binary_socket, evm_server.clone())
+            .expect("Couldn't open binary socket");
+    }
 
     // Setup a channel to signal a shutdown.
     let (shutdown_sender, shutdown_receiver) = std::sync::mpsc::channel();
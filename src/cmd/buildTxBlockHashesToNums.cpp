@@ -51,7 +51,10 @@ int main(int argc, char* argv[]) {
   const auto it = std::unique_ptr<leveldb::Iterator>(
       txBlockchainDB.GetDB()->NewIterator(leveldb::ReadOptions()));
   for (it->SeekToFirst(); it->Valid(); it->Next()) {
-    const uint64_t blockNum = std::stoull(it->key().ToString());
+    uint64_t blockNum = 0;
+    if (!LevelDB::ParseBlockNumKey(it->key(), blockNum)) {
+      continue;
+    }
     const auto blockString = txBlockchainDB.Lookup(blockNum);
     TxBlock block;
     block.Deserialize(zbytes(blockString.begin(), blockString.end()), 0);
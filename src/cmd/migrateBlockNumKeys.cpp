@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <filesystem>
+#include <iostream>
+
+#include <common/Constants.h>
+#include <depends/libDatabase/LevelDB.h>
+
+int main(int argc, char* argv[]) {
+  if (argc != 2) {
+    std::cerr << "Usage: " << argv[0] << " PERSISTENCE_PATH" << std::endl;
+    exit(1);
+  }
+  const std::string persistencePath = argv[1];
+  const std::string EMPTY_SUBDIR{};
+
+  // Databases keyed by block number (or a small integer index) through the
+  // LevelDB uint256_t overloads. Databases with textual keys, such as
+  // metadata and stateRoot, must not be migrated.
+  const std::vector<std::string> dbNames{
+      "dsBlocks",        "txBlocks",        "blockLinks",
+      "dsCommittee",     "shardStructure",  "stateDelta",
+      "minerInfoDSComm", "minerInfoShards", "diagnosticNodes",
+      "diagnosticCoinb"};
+
+  // Algo is as follows:
+  // For each (key, value) in db with a decimal key:
+  //   Insert (8-byte big-endian key, value) and delete the decimal key
+  // Once done, set LEVELDB_BINARY_BLOCKNUM_KEYS to true in constants.xml
+  //
+
+  int ret = 0;
+  for (const auto& dbName : dbNames) {
+    if (!std::filesystem::exists(persistencePath + "/" + dbName)) {
+      std::cerr << "Skipping " << dbName << ", not found" << std::endl;
+      continue;
+    }
+
+    // Pass explicitly subdir as an empty std::string type to invoke proper ctor
+    LevelDB db{dbName, persistencePath, EMPTY_SUBDIR};
+    const auto migrated = db.MigrateBlockNumKeys();
+    if (migrated < 0) {
+      std::cerr << "Failed to migrate " << dbName << std::endl;
+      ret = 1;
+      continue;
+    }
+
+    std::cerr << "Migrated " << migrated << " keys in " << dbName << std::endl;
+  }
+
+  return ret;
+}
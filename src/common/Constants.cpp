@@ -137,6 +137,15 @@ const unsigned int NUM_DS_EPOCHS_STATE_HISTORY{
 
 const uint64_t INIT_TRIE_DB_SNAPSHOT_EPOCH{
     ReadConstantUInt64("INIT_TRIE_DB_SNAPSHOT_EPOCH")};
+const unsigned int STATE_TRIE_UPDATE_THREADS{
+    ReadConstantNumeric("STATE_TRIE_UPDATE_THREADS", "node.general.", 0)};
+const unsigned int STATE_NODE_CACHE_SIZE_MB{
+    ReadConstantNumeric("STATE_NODE_CACHE_SIZE_MB", "node.general.", 128)};
+const unsigned int STATE_NODE_CACHE_SHARDS{
+    ReadConstantNumeric("STATE_NODE_CACHE_SHARDS", "node.general.", 16)};
+const bool LEVELDB_BINARY_BLOCKNUM_KEYS{
+    ReadConstantString("LEVELDB_BINARY_BLOCKNUM_KEYS", "node.general.",
+                       "false") == "true"};
 
 const unsigned int MAX_ARCHIVED_LOG_COUNT{
     ReadConstantNumeric("MAX_ARCHIVED_LOG_COUNT")};
@@ -145,6 +154,36 @@ const unsigned int MAX_LOG_FILE_SIZE_KB{
 const bool JSON_LOGGING{ReadConstantString("JSON_LOGGING") == "true"};
 const bool AUTO_UPGRADE{ReadConstantString("AUTO_UPGRADE") == "true"};
 
+// LevelDB constants
+const unsigned int LEVELDB_MAX_OPEN_FILES{
+    ReadConstantNumeric("LEVELDB_MAX_OPEN_FILES", "node.leveldb.", 256)};
+const unsigned int LEVELDB_BLOCK_CACHE_SIZE_MB{
+    ReadConstantNumeric("LEVELDB_BLOCK_CACHE_SIZE_MB", "node.leveldb.", 256)};
+const string LEVELDB_POINT_LOOKUP_DBS{ReadConstantString(
+    "LEVELDB_POINT_LOOKUP_DBS", "node.leveldb.",
+    "txBodies,txEpochs,txBlockHashToNum,state,contractCode,"
+    "contractStateData2,contractInitState2,contractTrie")};
+const unsigned int LEVELDB_POINT_LOOKUP_BLOOM_BITS{ReadConstantNumeric(
+    "LEVELDB_POINT_LOOKUP_BLOOM_BITS", "node.leveldb.", 10)};
+const unsigned int LEVELDB_POINT_LOOKUP_WRITE_BUFFER_MB{ReadConstantNumeric(
+    "LEVELDB_POINT_LOOKUP_WRITE_BUFFER_MB", "node.leveldb.", 8)};
+const unsigned int LEVELDB_POINT_LOOKUP_BLOCK_SIZE_KB{ReadConstantNumeric(
+    "LEVELDB_POINT_LOOKUP_BLOCK_SIZE_KB", "node.leveldb.", 4)};
+const string LEVELDB_POINT_LOOKUP_COMPRESSION{ReadConstantString(
+    "LEVELDB_POINT_LOOKUP_COMPRESSION", "node.leveldb.", "snappy")};
+const string LEVELDB_APPEND_ONLY_DBS{ReadConstantString(
+    "LEVELDB_APPEND_ONLY_DBS", "node.leveldb.",
+    "dsBlocks,txBlocks,txBlocksAux,microBlocks,VCBlocks,blockLinks,"
+    "stateDelta,txTraces,otterTraces,eventLogs")};
+const unsigned int LEVELDB_APPEND_ONLY_BLOOM_BITS{
+    ReadConstantNumeric("LEVELDB_APPEND_ONLY_BLOOM_BITS", "node.leveldb.", 0)};
+const unsigned int LEVELDB_APPEND_ONLY_WRITE_BUFFER_MB{ReadConstantNumeric(
+    "LEVELDB_APPEND_ONLY_WRITE_BUFFER_MB", "node.leveldb.", 32)};
+const unsigned int LEVELDB_APPEND_ONLY_BLOCK_SIZE_KB{ReadConstantNumeric(
+    "LEVELDB_APPEND_ONLY_BLOCK_SIZE_KB", "node.leveldb.", 64)};
+const string LEVELDB_APPEND_ONLY_COMPRESSION{ReadConstantString(
+    "LEVELDB_APPEND_ONLY_COMPRESSION", "node.leveldb.", "snappy")};
+
 // Version constants
 const unsigned int MSG_VERSION{
     ReadConstantNumeric("MSG_VERSION", "node.version.")};
@@ -184,6 +223,10 @@ const unsigned int SEED_SYNC_SMALL_PULL_INTERVAL{
     ReadConstantNumeric("SEED_SYNC_SMALL_PULL_INTERVAL", "node.seed.")};
 const unsigned int SEED_SYNC_LARGE_PULL_INTERVAL{
     ReadConstantNumeric("SEED_SYNC_LARGE_PULL_INTERVAL", "node.seed.")};
+const unsigned int SEED_SYNC_WINDOW_BLOCKS{
+    ReadConstantNumeric("SEED_SYNC_WINDOW_BLOCKS", "node.seed.", 10)};
+const unsigned int SEED_SYNC_MAX_PARALLEL_REQUESTS{
+    ReadConstantNumeric("SEED_SYNC_MAX_PARALLEL_REQUESTS", "node.seed.", 4)};
 const bool ENABLE_SEED_TO_SEED_COMMUNICATION{
     ReadConstantString("ENABLE_SEED_TO_SEED_COMMUNICATION", "node.seed.") ==
     "true"};
@@ -417,6 +460,12 @@ const unsigned int NUM_SHARD_PEER_TO_REVEAL{
     ReadConstantNumeric("NUM_SHARD_PEER_TO_REVEAL", "node.jsonrpc.")};
 const std::string SCILLA_IPC_SOCKET_PATH{
     ReadConstantString("SCILLA_IPC_SOCKET_PATH", "node.jsonrpc.")};
+const bool ENABLE_SCILLA_IPC_BINARY{
+    ReadConstantString("ENABLE_SCILLA_IPC_BINARY", "node.jsonrpc.", "false") ==
+    "true"};
+const std::string SCILLA_IPC_BINARY_SOCKET_PATH{
+    ReadConstantString("SCILLA_IPC_BINARY_SOCKET_PATH", "node.jsonrpc.",
+                       "/tmp/zilliqa-bin.sock")};
 const std::string SCILLA_SERVER_SOCKET_PATH{
     ReadConstantString("SCILLA_SERVER_SOCKET_PATH", "node.jsonrpc.")};
 const std::string SCILLA_SERVER_BINARY{
@@ -442,6 +491,10 @@ const unsigned int CONNECTION_CALLBACK_TIMEOUT{
     ReadConstantNumeric("CONNECTION_CALLBACK_TIMEOUT", "node.jsonrpc.")};
 const size_t REQUEST_PROCESSING_THREADS{ReadConstantNumeric("REQUEST_PROCESSING_THREADS", "node.jsonrpc.", 64)};
 const size_t REQUEST_QUEUE_SIZE{ReadConstantNumeric("REQUEST_QUEUE_SIZE", "node.jsonrpc.", 65536)};
+const size_t ACCOUNT_READ_CACHE_SIZE{
+    ReadConstantNumeric("ACCOUNT_READ_CACHE_SIZE", "node.jsonrpc.", 100000)};
+const size_t ETH_CALL_CACHE_SIZE{
+    ReadConstantNumeric("ETH_CALL_CACHE_SIZE", "node.jsonrpc.", 10000)};
 
 // Network composition constants
 const unsigned int COMM_SIZE{
@@ -506,6 +559,10 @@ const bool OPENCL_GPU_MINE{ReadConstantString("OPENCL_GPU_MINE", "node.pow.") ==
                            "true"};
 const bool REMOTE_MINE{ReadConstantString("REMOTE_MINE", "node.pow.") ==
                        "true"};
+const unsigned int POW_MINE_CPU_THREADS{
+    ReadConstantNumeric("POW_MINE_CPU_THREADS", "node.pow.", 0)};
+const unsigned int POW_MINE_CPU_BATCH_SIZE{
+    ReadConstantNumeric("POW_MINE_CPU_BATCH_SIZE", "node.pow.", 64)};
 const std::string MINING_PROXY_URL{
     ReadConstantString("MINING_PROXY_URL", "node.pow.")};
 const unsigned int MINING_PROXY_TIMEOUT_IN_MS{
@@ -528,6 +585,10 @@ const unsigned int POW_BOUNDARY_N_DIVIDED_START{
     ReadConstantNumeric("POW_BOUNDARY_N_DIVIDED_START", "node.pow.")};
 const unsigned int POW_SUBMISSION_LIMIT{
     ReadConstantNumeric("POW_SUBMISSION_LIMIT", "node.pow.")};
+const unsigned int POW_VERIFY_THREADS{
+    ReadConstantNumeric("POW_VERIFY_THREADS", "node.pow.", 0)};
+const unsigned int POW_VERIFY_QUEUE_SIZE{
+    ReadConstantNumeric("POW_VERIFY_QUEUE_SIZE", "node.pow.", 4096)};
 const unsigned int NUM_FINAL_BLOCK_PER_POW{
     ReadConstantNumeric("NUM_FINAL_BLOCK_PER_POW", "node.pow.")};
 const unsigned int POW_CHANGE_TO_ADJ_DIFF{
@@ -576,6 +637,12 @@ const unsigned int RESUME_BLACKLIST_DELAY_IN_SECONDS{
     ReadConstantNumeric("RESUME_BLACKLIST_DELAY_IN_SECONDS", "node.recovery.")};
 const unsigned int INCRDB_DSNUMS_WITH_STATEDELTAS{
     ReadConstantNumeric("INCRDB_DSNUMS_WITH_STATEDELTAS", "node.recovery.")};
+const unsigned int STATE_SNAPSHOT_INTERVAL_DSEPOCHS{ReadConstantNumeric(
+    "STATE_SNAPSHOT_INTERVAL_DSEPOCHS", "node.recovery.", 0)};
+const unsigned int STATE_SNAPSHOT_KEEP{
+    ReadConstantNumeric("STATE_SNAPSHOT_KEEP", "node.recovery.", 2)};
+const unsigned int STATE_SNAPSHOT_CHUNK_SIZE_MB{
+    ReadConstantNumeric("STATE_SNAPSHOT_CHUNK_SIZE_MB", "node.recovery.", 64)};
 const bool CONTRACT_STATES_MIGRATED{
     ReadConstantString("CONTRACT_STATES_MIGRATED", "node.recovery.") == "true"};
 const unsigned int MAX_IPCHANGE_REQUEST_LIMIT{
@@ -628,6 +695,11 @@ const string LIBRARY_CODE_EXTENSION{
     ReadConstantString("LIBRARY_CODE_EXTENSION", "node.smart_contract.")};
 const string EXTLIB_FOLDER{
     ReadConstantString("EXTLIB_FOLDER", "node.smart_contract.")};
+const string SCILLA_WORKSPACE_ROOT{
+    ReadConstantString("SCILLA_WORKSPACE_ROOT", "node.smart_contract.",
+                       "/dev/shm/zilliqa_scilla")};
+const unsigned int SCILLA_CODE_CACHE_SIZE{ReadConstantNumeric(
+    "SCILLA_CODE_CACHE_SIZE", "node.smart_contract.", 1024)};
 const bool ENABLE_SCILLA_MULTI_VERSION{
     ReadConstantString("ENABLE_SCILLA_MULTI_VERSION", "node.smart_contract.") ==
     "true"};
@@ -641,6 +713,11 @@ const unsigned int SCILLA_SERVER_PENDING_IN_MS{
     ReadConstantNumeric("SCILLA_SERVER_PENDING_IN_MS", "node.smart_contract.")};
 unsigned int SCILLA_SERVER_LOOP_WAIT_MICROSECONDS{ReadConstantNumeric(
     "SCILLA_SERVER_LOOP_WAIT_MICROSECONDS", "node.smart_contract.")};
+const unsigned int SCILLA_SERVER_POOL_SIZE{
+    ReadConstantNumeric("SCILLA_SERVER_POOL_SIZE", "node.smart_contract.", 1)};
+const unsigned int SCILLA_SERVER_HEALTH_CHECK_INTERVAL_IN_MS{
+    ReadConstantNumeric("SCILLA_SERVER_HEALTH_CHECK_INTERVAL_IN_MS",
+                        "node.smart_contract.", 10000)};
 
 // Test constants
 const bool ENABLE_CHECK_PERFORMANCE_LOG{
@@ -714,6 +791,13 @@ const double BLOOM_FILTER_FALSE_RATE{
     ReadConstantDouble("BLOOM_FILTER_FALSE_RATE", "node.transactions.")};
 const unsigned int TXN_DISPATCH_ATTEMPT_LIMIT{
     ReadConstantNumeric("TXN_DISPATCH_ATTEMPT_LIMIT", "node.transactions.")};
+const bool ENABLE_SPECULATIVE_TXN_EXECUTION{
+    ReadConstantString("ENABLE_SPECULATIVE_TXN_EXECUTION",
+                       "node.transactions.", "false") == "true"};
+const unsigned int SPECULATIVE_TXN_EXECUTION_THREADS{ReadConstantNumeric(
+    "SPECULATIVE_TXN_EXECUTION_THREADS", "node.transactions.", 0)};
+const unsigned int TXN_SIG_VERIFY_THREADS{ReadConstantNumeric(
+    "TXN_SIG_VERIFY_THREADS", "node.transactions.", 0)};
 
 // Viewchange constants
 const unsigned int POST_VIEWCHANGE_BUFFER{
@@ -762,6 +846,21 @@ const bool LAUNCH_EVM_DAEMON{
     ReadConstantString("LAUNCH_EVM_DAEMON", "node.jsonrpc.", "true") == "true"};
 const bool ENABLE_CPS{
     ReadConstantString("ENABLE_CPS", "node.jsonrpc.", "true") == "true"};
+const bool ENABLE_EVENT_LOG_INDEX{
+    ReadConstantString("ENABLE_EVENT_LOG_INDEX", "node.jsonrpc.", "true") ==
+    "true"};
+const uint64_t EVENT_LOG_INDEX_SECTION_SIZE{
+    ReadConstantUInt64("EVENT_LOG_INDEX_SECTION_SIZE", "node.jsonrpc.", 4096)};
+const unsigned int GET_LOGS_MAX_RESULTS{
+    ReadConstantNumeric("GET_LOGS_MAX_RESULTS", "node.jsonrpc.", 10000)};
+const bool ENABLE_EVM_BINARY_TRANSPORT{
+    ReadConstantString("ENABLE_EVM_BINARY_TRANSPORT", "node.jsonrpc.",
+                       "false") == "true"};
+const std::string EVM_SERVER_BINARY_SOCKET_PATH{
+    ReadConstantString("EVM_SERVER_BINARY_SOCKET_PATH", "node.jsonrpc.",
+                       "/tmp/evm-server-bin.sock")};
+const unsigned int EVM_CONNECTION_POOL_SIZE{
+    ReadConstantNumeric("EVM_CONNECTION_POOL_SIZE", "node.jsonrpc.", 4)};
 const std::string METRIC_ZILLIQA_HOSTNAME{ReadConstantString(
     "METRIC_ZILLIQA_HOSTNAME", "node.metric.zilliqa.", "localhost")};
 const std::string METRIC_ZILLIQA_PROVIDER{ReadConstantString(
@@ -110,6 +110,7 @@ const std::string RAND2_GENESIS =
 
 const std::string PERSISTENCE_PATH = "/persistence";
 const std::string STATEDELTAFROMS3_PATH = "/StateDeltaFromS3";
+const std::string STATE_SNAPSHOT_PATH = "/StateSnapshots";
 
 const std::string DS_KICKOUT_MSG = "KICKED OUT FROM DS";
 const std::string DS_LEADER_MSG = "DS LEADER NOW";
@@ -141,11 +142,29 @@ extern const bool KEEP_HISTORICAL_STATE;
 extern const bool ENABLE_MEMORY_STATS;
 extern const unsigned int NUM_DS_EPOCHS_STATE_HISTORY;
 extern const uint64_t INIT_TRIE_DB_SNAPSHOT_EPOCH;
+extern const unsigned int STATE_TRIE_UPDATE_THREADS;
+extern const unsigned int STATE_NODE_CACHE_SIZE_MB;
+extern const unsigned int STATE_NODE_CACHE_SHARDS;
+extern const bool LEVELDB_BINARY_BLOCKNUM_KEYS;
 extern const unsigned int MAX_ARCHIVED_LOG_COUNT;
 extern const unsigned int MAX_LOG_FILE_SIZE_KB;
 extern const bool JSON_LOGGING;
 extern const bool AUTO_UPGRADE;
 
+// LevelDB constants
+extern const unsigned int LEVELDB_MAX_OPEN_FILES;
+extern const unsigned int LEVELDB_BLOCK_CACHE_SIZE_MB;
+extern const std::string LEVELDB_POINT_LOOKUP_DBS;
+extern const unsigned int LEVELDB_POINT_LOOKUP_BLOOM_BITS;
+extern const unsigned int LEVELDB_POINT_LOOKUP_WRITE_BUFFER_MB;
+extern const unsigned int LEVELDB_POINT_LOOKUP_BLOCK_SIZE_KB;
+extern const std::string LEVELDB_POINT_LOOKUP_COMPRESSION;
+extern const std::string LEVELDB_APPEND_ONLY_DBS;
+extern const unsigned int LEVELDB_APPEND_ONLY_BLOOM_BITS;
+extern const unsigned int LEVELDB_APPEND_ONLY_WRITE_BUFFER_MB;
+extern const unsigned int LEVELDB_APPEND_ONLY_BLOCK_SIZE_KB;
+extern const std::string LEVELDB_APPEND_ONLY_COMPRESSION;
+
 // Version constants
 extern const unsigned int MSG_VERSION;
 extern const unsigned int TRANSACTION_VERSION;
@@ -168,6 +187,8 @@ extern const unsigned int TXN_STORAGE_LIMIT;
 extern bool MULTIPLIER_SYNC_MODE;
 extern const unsigned int SEED_SYNC_SMALL_PULL_INTERVAL;
 extern const unsigned int SEED_SYNC_LARGE_PULL_INTERVAL;
+extern const unsigned int SEED_SYNC_WINDOW_BLOCKS;
+extern const unsigned int SEED_SYNC_MAX_PARALLEL_REQUESTS;
 extern const bool ENABLE_SEED_TO_SEED_COMMUNICATION;
 extern const unsigned int P2P_SEED_CONNECT_PORT;
 extern const unsigned int P2P_SEED_SERVER_CONNECTION_TIMEOUT;
@@ -298,12 +319,20 @@ extern const uint64_t ETH_CHAINID;
 extern const uint64_t EVM_ZIL_SCALING_FACTOR;
 extern const bool LAUNCH_EVM_DAEMON;
 extern const bool ENABLE_CPS;
+extern const bool ENABLE_EVENT_LOG_INDEX;
+extern const uint64_t EVENT_LOG_INDEX_SECTION_SIZE;
+extern const bool ENABLE_EVM_BINARY_TRANSPORT;
+extern const std::string EVM_SERVER_BINARY_SOCKET_PATH;
+extern const unsigned int EVM_CONNECTION_POOL_SIZE;
+extern const unsigned int GET_LOGS_MAX_RESULTS;
 
 extern const std::string IP_TO_BIND;  // Only for non-lookup nodes
 extern const bool ENABLE_STAKING_RPC;
 extern const bool ENABLE_STATUS_RPC;
 extern const unsigned int NUM_SHARD_PEER_TO_REVEAL;
 extern const std::string SCILLA_IPC_SOCKET_PATH;
+extern const bool ENABLE_SCILLA_IPC_BINARY;
+extern const std::string SCILLA_IPC_BINARY_SOCKET_PATH;
 extern const std::string SCILLA_SERVER_SOCKET_PATH;
 extern const std::string SCILLA_SERVER_BINARY;
 extern bool ENABLE_WEBSOCKET;
@@ -317,6 +346,8 @@ extern const unsigned int CONNECTION_ALL_TIMEOUT;
 extern const unsigned int CONNECTION_CALLBACK_TIMEOUT;
 extern const size_t REQUEST_PROCESSING_THREADS;
 extern const size_t REQUEST_QUEUE_SIZE;
+extern const size_t ACCOUNT_READ_CACHE_SIZE;
+extern const size_t ETH_CALL_CACHE_SIZE;
 
 // Network composition constants
 extern const unsigned int COMM_SIZE;
@@ -352,6 +383,8 @@ extern const unsigned int RECONNECT_INTERVAL_IN_MS;
 extern const bool FULL_DATASET_MINE;
 extern const bool OPENCL_GPU_MINE;
 extern const bool REMOTE_MINE;
+extern const unsigned int POW_MINE_CPU_THREADS;
+extern const unsigned int POW_MINE_CPU_BATCH_SIZE;
 extern const std::string MINING_PROXY_URL;
 extern const unsigned int MINING_PROXY_TIMEOUT_IN_MS;
 extern const unsigned int MAX_RETRY_SEND_POW_TIME;
@@ -363,6 +396,8 @@ extern const unsigned int POW_DIFFICULTY;
 extern const unsigned int POW_BOUNDARY_N_DIVIDED;
 extern const unsigned int POW_BOUNDARY_N_DIVIDED_START;
 extern const unsigned int POW_SUBMISSION_LIMIT;
+extern const unsigned int POW_VERIFY_THREADS;
+extern const unsigned int POW_VERIFY_QUEUE_SIZE;
 extern const unsigned int NUM_FINAL_BLOCK_PER_POW;
 extern const unsigned int POW_CHANGE_TO_ADJ_DIFF;
 extern const unsigned int POW_CHANGE_TO_ADJ_DS_DIFF;
@@ -387,6 +422,9 @@ extern const unsigned int TERMINATION_COUNTDOWN_IN_SECONDS;
 extern const bool REJOIN_NODE_NOT_IN_NETWORK;
 extern const unsigned int RESUME_BLACKLIST_DELAY_IN_SECONDS;
 extern const unsigned int INCRDB_DSNUMS_WITH_STATEDELTAS;
+extern const unsigned int STATE_SNAPSHOT_INTERVAL_DSEPOCHS;
+extern const unsigned int STATE_SNAPSHOT_KEEP;
+extern const unsigned int STATE_SNAPSHOT_CHUNK_SIZE_MB;
 extern const bool CONTRACT_STATES_MIGRATED;
 extern const unsigned int MAX_IPCHANGE_REQUEST_LIMIT;
 extern const unsigned int MAX_REJOIN_NETWORK_ATTEMPTS;
@@ -410,6 +448,8 @@ extern const std::string INPUT_CODE;
 extern const std::string CONTRACT_FILE_EXTENSION;
 extern const std::string LIBRARY_CODE_EXTENSION;
 extern const std::string EXTLIB_FOLDER;
+extern const std::string SCILLA_WORKSPACE_ROOT;
+extern const unsigned int SCILLA_CODE_CACHE_SIZE;
 extern const bool ENABLE_SCILLA_MULTI_VERSION;
 extern bool ENABLE_SCILLA;
 
@@ -417,6 +457,8 @@ extern const bool LOG_SC;
 extern const bool DISABLE_SCILLA_LIB;
 extern const unsigned int SCILLA_SERVER_PENDING_IN_MS;
 extern unsigned int SCILLA_SERVER_LOOP_WAIT_MICROSECONDS;
+extern const unsigned int SCILLA_SERVER_POOL_SIZE;
+extern const unsigned int SCILLA_SERVER_HEALTH_CHECK_INTERVAL_IN_MS;
 const std::string FIELDS_MAP_DEPTH_INDICATOR = "_fields_map_depth";
 const std::string MAP_DEPTH_INDICATOR = "_depth";
 const std::string SCILLA_VERSION_INDICATOR = "_version";
@@ -467,6 +509,9 @@ extern const bool ENABLE_TXNS_BACKUP;
 extern const bool SHARDLDR_SAVE_TXN_LOCALLY;
 extern const double BLOOM_FILTER_FALSE_RATE;
 extern const unsigned int TXN_DISPATCH_ATTEMPT_LIMIT;
+extern const bool ENABLE_SPECULATIVE_TXN_EXECUTION;
+extern const unsigned int SPECULATIVE_TXN_EXECUTION_THREADS;
+extern const unsigned int TXN_SIG_VERIFY_THREADS;
 extern const uint64_t EVM_RPC_TIMEOUT_SECONDS;
 
 // TxBlockAux constants
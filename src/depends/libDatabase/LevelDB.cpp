@@ -15,10 +15,14 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <charconv>
 #include <string>
 
+#include <leveldb/write_batch.h>
 
 #include "LevelDB.h"
+#include "LevelDBProfile.h"
 #include "common/Constants.h"
 #include "depends/common/Common.h"
 #include "depends/common/CommonData.h"
@@ -40,6 +44,7 @@ LevelDB::LevelDB(const string& dbName, const string& path, const string& subdire
     this->m_subdirectory = subdirectory;
     this->m_dbName = dbName;
     this->m_db = NULL;
+    this->m_binaryBlockNumKeys = LEVELDB_BINARY_BLOCKNUM_KEYS;
 
     if(!(std::filesystem::exists(path)))
     {
@@ -47,8 +52,7 @@ LevelDB::LevelDB(const string& dbName, const string& path, const string& subdire
         return;
     }
 
-    m_options.max_open_files = 256;
-    m_options.create_if_missing = true;
+    m_options = GetLevelDBOptions(GetLevelDBProfile(m_dbName));
 
     leveldb::DB* db;
     leveldb::Status status;
@@ -84,9 +88,9 @@ LevelDB::LevelDB(const std::string & dbName, const std::string& subdirectory, bo
 {
     this->m_subdirectory = subdirectory;
     this->m_dbName = dbName;
+    this->m_binaryBlockNumKeys = LEVELDB_BINARY_BLOCKNUM_KEYS;
 
-    m_options.max_open_files = 256;
-    m_options.create_if_missing = true;
+    m_options = GetLevelDBOptions(GetLevelDBProfile(m_dbName));
 
     leveldb::DB* db;
     leveldb::Status status;
@@ -133,6 +137,164 @@ leveldb::Slice toSlice(boost::multiprecision::uint256_t num)
     return (leveldb::Slice)h.ref();
 }
 
+string LevelDB::BlockNumToKey(const boost::multiprecision::uint256_t & blockNum)
+{
+    const uint64_t num = blockNum.convert_to<uint64_t>();
+    string key(sizeof(num), '\0');
+    for (size_t i = 0; i < sizeof(num); i++)
+    {
+        key[sizeof(num) - 1 - i] = static_cast<char>((num >> (8 * i)) & 0xFF);
+    }
+    return key;
+}
+
+bool LevelDB::ParseBlockNumKey(const leveldb::Slice & key, uint64_t & blockNum)
+{
+    const char* begin = key.data();
+    const char* end = key.data() + key.size();
+
+    // Legacy keys are decimal text, a binary key of any realistic block
+    // number starts with a zero byte and so is never all digits
+    if (!key.empty() && std::all_of(begin, end, [](char c) { return c >= '0' && c <= '9'; }))
+    {
+        auto res = std::from_chars(begin, end, blockNum);
+        return res.ec == std::errc() && res.ptr == end;
+    }
+
+    if (key.size() != sizeof(blockNum))
+    {
+        return false;
+    }
+
+    blockNum = 0;
+    for (size_t i = 0; i < key.size(); i++)
+    {
+        blockNum = (blockNum << 8) | static_cast<unsigned char>(key[i]);
+    }
+    return true;
+}
+
+string LevelDB::BlockNumKey(const boost::multiprecision::uint256_t & blockNum) const
+{
+    return m_binaryBlockNumKeys ? BlockNumToKey(blockNum) : blockNum.convert_to<string>();
+}
+
+void LevelDB::ForEachBlockInRange(uint64_t lo, uint64_t hi,
+                                  const std::function<bool(uint64_t, const leveldb::Slice &)> & fn) const
+{
+    if (lo > hi)
+    {
+        return;
+    }
+
+    // Visits the blocks in [from, to] that are only stored under a legacy key
+    auto visitLegacy = [this, &fn](uint64_t from, uint64_t to) -> bool
+    {
+        for (uint64_t blockNum = from;; blockNum++)
+        {
+            string value;
+            if (m_db->Get(leveldb::ReadOptions(), to_string(blockNum), &value).ok() &&
+                !fn(blockNum, leveldb::Slice(value)))
+            {
+                return false;
+            }
+            if (blockNum == to)
+            {
+                return true;
+            }
+        }
+    };
+
+    if (!m_binaryBlockNumKeys)
+    {
+        // Decimal keys do not sort numerically
+        visitLegacy(lo, hi);
+        return;
+    }
+
+    std::unique_ptr<leveldb::Iterator> it{m_db->NewIterator(leveldb::ReadOptions())};
+    const string hiKey = BlockNumToKey(hi);
+    uint64_t next = lo;
+    for (it->Seek(BlockNumToKey(lo)); it->Valid() && it->key().compare(hiKey) <= 0; it->Next())
+    {
+        uint64_t blockNum = 0;
+        if (it->key().size() != sizeof(blockNum) || !ParseBlockNumKey(it->key(), blockNum))
+        {
+            continue;
+        }
+        if (blockNum > next && !visitLegacy(next, blockNum - 1))
+        {
+            return;
+        }
+        if (!fn(blockNum, it->value()))
+        {
+            return;
+        }
+        if (blockNum == hi)
+        {
+            return;
+        }
+        next = blockNum + 1;
+    }
+
+    visitLegacy(next, hi);
+}
+
+int64_t LevelDB::MigrateBlockNumKeys()
+{
+    constexpr size_t MAX_BATCH_SIZE = 10000;
+
+    int64_t migrated = 0;
+    ldb::WriteBatch batch;
+    size_t batchSize = 0;
+
+    auto flush = [this, &batch, &batchSize]() -> bool
+    {
+        ldb::Status s = m_db->Write(leveldb::WriteOptions(), &batch);
+        if (!s.ok())
+        {
+            LOG_GENERAL(WARNING, "[MigrateBlockNumKeys] Status: " << s.ToString());
+            return false;
+        }
+        batch.Clear();
+        batchSize = 0;
+        return true;
+    };
+
+    // Decimal keys all sort after the binary ones, so start at the first digit
+    std::unique_ptr<leveldb::Iterator> it{m_db->NewIterator(leveldb::ReadOptions())};
+    for (it->Seek("0"); it->Valid(); it->Next())
+    {
+        uint64_t blockNum = 0;
+        if (!ParseBlockNumKey(it->key(), blockNum) || to_string(blockNum) != it->key().ToString())
+        {
+            continue;
+        }
+
+        batch.Put(BlockNumToKey(blockNum), it->value());
+        batch.Delete(it->key());
+        migrated++;
+
+        if (++batchSize >= MAX_BATCH_SIZE && !flush())
+        {
+            return -1;
+        }
+    }
+
+    if (!it->status().ok())
+    {
+        LOG_GENERAL(WARNING, "[MigrateBlockNumKeys] Status: " << it->status().ToString());
+        return -1;
+    }
+
+    if (batchSize > 0 && !flush())
+    {
+        return -1;
+    }
+
+    return migrated;
+}
+
 string LevelDB::GetDBName()
 {
         if (LOOKUP_NODE_MODE)
@@ -173,22 +335,20 @@ string LevelDB::Lookup(const vector<unsigned char>& key) const
 
 string LevelDB::Lookup(const boost::multiprecision::uint256_t & blockNum) const
 {
-    string value;
-    leveldb::Status s = m_db->Get(leveldb::ReadOptions(), blockNum.convert_to<string>(), &value);
-
-    if (!s.ok())
-    {
-        log_error(s);
-        return "";
-    }
-
-    return value;
+    bool found = false;
+    return Lookup(blockNum, found);
 }
 
 string LevelDB::Lookup(const boost::multiprecision::uint256_t & blockNum, bool &found) const
 {
     string value;
-    leveldb::Status s = m_db->Get(leveldb::ReadOptions(), blockNum.convert_to<string>(), &value);
+    leveldb::Status s = m_db->Get(leveldb::ReadOptions(), BlockNumKey(blockNum), &value);
+
+    // Entries written before the switch to binary keys stay readable
+    if (s.IsNotFound() && m_binaryBlockNumKeys)
+    {
+        s = m_db->Get(leveldb::ReadOptions(), blockNum.convert_to<string>(), &value);
+    }
 
     if (!s.ok())
     {
@@ -257,7 +417,7 @@ int LevelDB::Insert(const boost::multiprecision::uint256_t & blockNum,
                     const vector<unsigned char> & body)
 {
     leveldb::Status s = m_db->Put(leveldb::WriteOptions(),
-                                  leveldb::Slice(blockNum.convert_to<string>()),
+                                  leveldb::Slice(BlockNumKey(blockNum)),
                                   leveldb::Slice(vector_ref<const unsigned char>(&body[0],
                                                                                  body.size())));
 
@@ -274,7 +434,7 @@ int LevelDB::Insert(const boost::multiprecision::uint256_t & blockNum,
                     const std::string & body)
 {
     leveldb::Status s = m_db->Put(leveldb::WriteOptions(),
-                                  leveldb::Slice(blockNum.convert_to<string>()),
+                                  leveldb::Slice(BlockNumKey(blockNum)),
                                   leveldb::Slice(body.c_str(), body.size()));
 
     if (!s.ok())
@@ -345,10 +505,15 @@ int LevelDB::Insert(const leveldb::Slice & key, const leveldb::Slice & value)
 }
 
 bool LevelDB::BatchInsert(const std::unordered_map<dev::h256, std::pair<std::string, unsigned>> & m_main,
-                          const std::unordered_map<dev::h256, std::pair<dev::zbytes, bool>> & m_aux, unordered_set<dev::h256>& inserted)
+                          const std::unordered_map<dev::h256, std::pair<dev::zbytes, bool>> & m_aux, unordered_set<dev::h256>& inserted,
+                          const std::vector<dev::h256>& toDelete)
 {
     ldb::WriteBatch batch;
 
+    for (const auto& i : toDelete) {
+        batch.Delete(leveldb::Slice(i.hex()));
+    }
+
     for (const auto & i: m_main) {
         if (i.second.second || (LOOKUP_NODE_MODE && KEEP_HISTORICAL_STATE)) {
             batch.Put(leveldb::Slice(i.first.hex()),
@@ -400,6 +565,21 @@ bool LevelDB::BatchInsert(const std::unordered_map<std::string, std::string>& kv
     return true;
 }
 
+bool LevelDB::BatchWrite(leveldb::WriteBatch & batch, bool sync)
+{
+    leveldb::WriteOptions options;
+    options.sync = sync;
+
+    ldb::Status s = m_db->Write(options, &batch);
+
+    if (!s.ok()) {
+        LOG_GENERAL(WARNING, "[BatchWrite] Status: " << s.ToString());
+        return false;
+    }
+
+    return true;
+}
+
 bool LevelDB::BatchDelete(const std::vector<dev::h256>& toDelete) {
     ldb::WriteBatch batch;
     for (const auto& i : toDelete) {
@@ -454,7 +634,14 @@ int LevelDB::DeleteKey(const dev::h256 & key)
 
 int LevelDB::DeleteKey(const boost::multiprecision::uint256_t & blockNum)
 {
-    leveldb::Status s = m_db->Delete(leveldb::WriteOptions(), ldb::Slice(blockNum.convert_to<string>()));
+    ldb::WriteBatch batch;
+    batch.Delete(ldb::Slice(BlockNumKey(blockNum)));
+    if (m_binaryBlockNumKeys)
+    {
+        batch.Delete(ldb::Slice(blockNum.convert_to<string>()));
+    }
+
+    leveldb::Status s = m_db->Write(leveldb::WriteOptions(), &batch);
     if (!s.ok())
     {
         LOG_GENERAL(WARNING, "[DeleteDB] Status: " << s.ToString());
@@ -516,13 +703,9 @@ bool LevelDB::RefreshDB()
 {
     m_db.reset();
 
-    leveldb::Options options;
-    options.max_open_files = 256;
-    options.create_if_missing = true;
-
     leveldb::DB* db;
 
-    leveldb::Status status = leveldb::DB::Open(options, STORAGE_PATH + PERSISTENCE_PATH + "/" + this->m_dbName, &db);
+    leveldb::Status status = leveldb::DB::Open(m_options, STORAGE_PATH + PERSISTENCE_PATH + "/" + this->m_dbName, &db);
     if(!status.ok())
     {
         // throw exception();
@@ -560,13 +743,9 @@ bool LevelDB::ResetDBForNormalNode()
     {
         std::filesystem::remove_all(STORAGE_PATH + PERSISTENCE_PATH + "/" + this->m_dbName);
 
-        leveldb::Options options;
-        options.max_open_files = 256;
-        options.create_if_missing = true;
-
         leveldb::DB* db;
 
-        leveldb::Status status = leveldb::DB::Open(options, STORAGE_PATH + PERSISTENCE_PATH + "/" + this->m_dbName, &db);
+        leveldb::Status status = leveldb::DB::Open(m_options, STORAGE_PATH + PERSISTENCE_PATH + "/" + this->m_dbName, &db);
         if(!status.ok())
         {
             // throw exception();
@@ -603,13 +782,9 @@ bool LevelDB::ResetDBForLookupNode()
     {
         std::filesystem::remove_all(STORAGE_PATH + PERSISTENCE_PATH + "/" + this->m_dbName);
 
-        leveldb::Options options;
-        options.max_open_files = 256;
-        options.create_if_missing = true;
-
         leveldb::DB* db;
 
-        leveldb::Status status = leveldb::DB::Open(options, STORAGE_PATH + PERSISTENCE_PATH + "/" + this->m_dbName, &db);
+        leveldb::Status status = leveldb::DB::Open(m_options, STORAGE_PATH + PERSISTENCE_PATH + "/" + this->m_dbName, &db);
         if(!status.ok())
         {
             // throw exception();
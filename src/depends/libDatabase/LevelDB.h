@@ -19,12 +19,14 @@
 #ifndef __LEVELDB_H__
 #define __LEVELDB_H__
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include <leveldb/db.h>
+#include <leveldb/write_batch.h>
 
 #include "depends/common/Common.h"
 #include "depends/common/FixedHash.h"
@@ -45,6 +47,8 @@ class LevelDB
 
     std::string m_open_db_path;
 
+    bool m_binaryBlockNumKeys = false;
+
     void log_error(leveldb::Status status) const;
 
 public:
@@ -84,6 +88,27 @@ public:
     /// Returns the value at the specified key.
     std::string Lookup(const dev::h256 & key) const;
 
+    /// Returns the key under which the specified block number is stored.
+    std::string BlockNumKey(const boost::multiprecision::uint256_t & blockNum) const;
+
+    /// Encodes a block number as an order-preserving 8-byte big-endian key.
+    static std::string BlockNumToKey(const boost::multiprecision::uint256_t & blockNum);
+
+    /// Decodes a block number key, either binary or legacy decimal.
+    static bool ParseBlockNumKey(const leveldb::Slice & key, uint64_t & blockNum);
+
+    /// Selects binary or legacy decimal block number keys for this database.
+    void SetBinaryBlockNumKeys(bool binary) { m_binaryBlockNumKeys = binary; }
+
+    /// Calls fn for every block in [lo, hi] in ascending order until it returns false.
+    /// With binary keys this is a sequential scan, otherwise one lookup per block.
+    void ForEachBlockInRange(uint64_t lo, uint64_t hi,
+                             const std::function<bool(uint64_t, const leveldb::Slice &)> & fn) const;
+
+    /// Rewrites all legacy decimal block number keys in binary form.
+    /// Returns the number of keys migrated, or -1 on failure.
+    int64_t MigrateBlockNumKeys();
+
     /// Returns the value at the specified key.
     std::string Lookup(const dev::zbytesConstRef & key) const;
 
@@ -117,11 +142,17 @@ public:
     /// Sets the value at the specified key.
     int Insert(const leveldb::Slice & key, const leveldb::Slice & value);
 
-    /// Sets the value at the specified key for multiple such pairs.
+    /// Sets the value at the specified key for multiple such pairs, removing
+    /// the keys in toDelete first within the same write batch.
     bool BatchInsert(const std::unordered_map<dev::h256, std::pair<std::string, unsigned>> & m_main,
-                     const std::unordered_map<dev::h256, std::pair<dev::zbytes, bool>> & m_aux, std::unordered_set<dev::h256>& inserted);
+                     const std::unordered_map<dev::h256, std::pair<dev::zbytes, bool>> & m_aux, std::unordered_set<dev::h256>& inserted,
+                     const std::vector<dev::h256>& toDelete = {});
     bool BatchInsert(const std::unordered_map<std::string, std::string>& kv_map);
 
+    /// Applies all updates in batch atomically. With sync the write is
+    /// flushed to disk before returning.
+    bool BatchWrite(leveldb::WriteBatch & batch, bool sync = false);
+
     /// Remove the kv pair for multiple specified key.
     bool BatchDelete(const std::vector<dev::h256>& toDelete);
 
@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_set>
+
+#include <leveldb/cache.h>
+#include <leveldb/filter_policy.h>
+
+#include "LevelDBProfile.h"
+#include "common/Constants.h"
+#include "libMetrics/Api.h"
+#include "libUtils/Logger.h"
+
+namespace {
+
+/// Bloom filter that counts how often it was consulted and how many of
+/// those reads it answered without touching a data block. Keeps the name of
+/// the builtin policy so that existing table files stay readable.
+class CountingBloomFilterPolicy : public leveldb::FilterPolicy {
+ public:
+  explicit CountingBloomFilterPolicy(int bitsPerKey)
+      : m_bloom(leveldb::NewBloomFilterPolicy(bitsPerKey)) {}
+
+  const char* Name() const override { return m_bloom->Name(); }
+
+  void CreateFilter(const leveldb::Slice* keys, int n,
+                    std::string* dst) const override {
+    m_bloom->CreateFilter(keys, n, dst);
+  }
+
+  bool KeyMayMatch(const leveldb::Slice& key,
+                   const leveldb::Slice& filter) const override {
+    const bool match = m_bloom->KeyMayMatch(key, filter);
+    m_checks.fetch_add(1, std::memory_order_relaxed);
+    if (!match) {
+      m_skips.fetch_add(1, std::memory_order_relaxed);
+    }
+    return match;
+  }
+
+  uint64_t Checks() const { return m_checks.load(std::memory_order_relaxed); }
+  uint64_t Skips() const { return m_skips.load(std::memory_order_relaxed); }
+
+ private:
+  std::unique_ptr<const leveldb::FilterPolicy> m_bloom;
+  mutable std::atomic<uint64_t> m_checks{0};
+  mutable std::atomic<uint64_t> m_skips{0};
+};
+
+struct ProfileSettings {
+  unsigned int bloomBits;
+  unsigned int writeBufferMB;
+  unsigned int blockSizeKB;
+  const std::string& compression;
+};
+
+constexpr LevelDBProfile TUNED_PROFILES[] = {LevelDBProfile::POINT_LOOKUP,
+                                             LevelDBProfile::APPEND_ONLY};
+
+ProfileSettings SettingsFor(LevelDBProfile profile) {
+  if (profile == LevelDBProfile::POINT_LOOKUP) {
+    return {LEVELDB_POINT_LOOKUP_BLOOM_BITS,
+            LEVELDB_POINT_LOOKUP_WRITE_BUFFER_MB,
+            LEVELDB_POINT_LOOKUP_BLOCK_SIZE_KB,
+            LEVELDB_POINT_LOOKUP_COMPRESSION};
+  }
+  return {LEVELDB_APPEND_ONLY_BLOOM_BITS, LEVELDB_APPEND_ONLY_WRITE_BUFFER_MB,
+          LEVELDB_APPEND_ONLY_BLOCK_SIZE_KB, LEVELDB_APPEND_ONLY_COMPRESSION};
+}
+
+std::unordered_set<std::string> SplitNames(const std::string& list) {
+  std::unordered_set<std::string> names;
+  std::istringstream in(list);
+  std::string name;
+  while (std::getline(in, name, ',')) {
+    if (!name.empty()) {
+      names.emplace(std::move(name));
+    }
+  }
+  return names;
+}
+
+// The cache and filter policies below are deliberately never freed: some
+// databases belong to singletons that may close after static destruction.
+
+leveldb::Cache* SharedBlockCache() {
+  static leveldb::Cache* cache =
+      LEVELDB_BLOCK_CACHE_SIZE_MB > 0
+          ? leveldb::NewLRUCache(size_t(LEVELDB_BLOCK_CACHE_SIZE_MB) << 20)
+          : nullptr;
+  return cache;
+}
+
+const CountingBloomFilterPolicy* FilterPolicyFor(LevelDBProfile profile) {
+  static const auto* pointLookup =
+      LEVELDB_POINT_LOOKUP_BLOOM_BITS > 0
+          ? new CountingBloomFilterPolicy(LEVELDB_POINT_LOOKUP_BLOOM_BITS)
+          : nullptr;
+  static const auto* appendOnly =
+      LEVELDB_APPEND_ONLY_BLOOM_BITS > 0
+          ? new CountingBloomFilterPolicy(LEVELDB_APPEND_ONLY_BLOOM_BITS)
+          : nullptr;
+
+  switch (profile) {
+    case LevelDBProfile::POINT_LOOKUP:
+      return pointLookup;
+    case LevelDBProfile::APPEND_ONLY:
+      return appendOnly;
+    default:
+      return nullptr;
+  }
+}
+
+Z_I64GAUGE& GetLevelDBGauge() {
+  static Z_I64GAUGE gauge{Z_FL::LEVELDB, "leveldb.stats",
+                          "Shared block cache and bloom filter statistics",
+                          "count", true};
+  return gauge;
+}
+
+void RegisterMetrics() {
+  GetLevelDBGauge().SetCallback([](auto&& result) {
+    if (!GetLevelDBGauge().Enabled()) {
+      return;
+    }
+    if (const auto* cache = SharedBlockCache()) {
+      result.Set(cache->TotalCharge(), {{"counter", "BlockCacheUsage"}});
+      result.Set(size_t(LEVELDB_BLOCK_CACHE_SIZE_MB) << 20,
+                 {{"counter", "BlockCacheCapacity"}});
+    }
+    for (auto profile : TUNED_PROFILES) {
+      if (const auto* policy = FilterPolicyFor(profile)) {
+        result.Set(policy->Checks(), {{"profile", LevelDBProfileName(profile)},
+                                      {"counter", "FilterChecks"}});
+        result.Set(policy->Skips(), {{"profile", LevelDBProfileName(profile)},
+                                     {"counter", "FilterSkips"}});
+      }
+    }
+  });
+}
+
+leveldb::CompressionType ParseCompression(const std::string& compression) {
+  if (compression == "none") {
+    return leveldb::kNoCompression;
+  }
+  if (compression != "snappy") {
+    LOG_GENERAL(WARNING, "Unknown LevelDB compression " << compression
+                                                        << ", using snappy");
+  }
+  return leveldb::kSnappyCompression;
+}
+
+}  // namespace
+
+const char* LevelDBProfileName(LevelDBProfile profile) {
+  switch (profile) {
+    case LevelDBProfile::POINT_LOOKUP:
+      return "point_lookup";
+    case LevelDBProfile::APPEND_ONLY:
+      return "append_only";
+    default:
+      return "default";
+  }
+}
+
+LevelDBProfile GetLevelDBProfile(const std::string& dbName) {
+  static const auto pointLookupDBs = SplitNames(LEVELDB_POINT_LOOKUP_DBS);
+  static const auto appendOnlyDBs = SplitNames(LEVELDB_APPEND_ONLY_DBS);
+
+  std::string baseName = dbName;
+  const auto pos = baseName.find_last_of('_');
+  if (pos != std::string::npos && pos + 1 < baseName.size() &&
+      baseName.find_first_not_of("0123456789", pos + 1) == std::string::npos) {
+    baseName.resize(pos);
+  }
+
+  if (pointLookupDBs.count(baseName) > 0) {
+    return LevelDBProfile::POINT_LOOKUP;
+  }
+  if (appendOnlyDBs.count(baseName) > 0) {
+    return LevelDBProfile::APPEND_ONLY;
+  }
+  return LevelDBProfile::DEFAULT;
+}
+
+leveldb::Options GetLevelDBOptions(LevelDBProfile profile) {
+  static std::once_flag metricsRegistered;
+  std::call_once(metricsRegistered, RegisterMetrics);
+
+  leveldb::Options options;
+  options.max_open_files = LEVELDB_MAX_OPEN_FILES;
+  options.create_if_missing = true;
+  options.block_cache = SharedBlockCache();
+
+  if (profile == LevelDBProfile::DEFAULT) {
+    return options;
+  }
+
+  const auto settings = SettingsFor(profile);
+  options.filter_policy = FilterPolicyFor(profile);
+  if (settings.writeBufferMB > 0) {
+    options.write_buffer_size = size_t(settings.writeBufferMB) << 20;
+  }
+  if (settings.blockSizeKB > 0) {
+    options.block_size = size_t(settings.blockSizeKB) << 10;
+  }
+  options.compression = ParseCompression(settings.compression);
+  return options;
+}
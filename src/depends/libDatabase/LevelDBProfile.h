@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ZILLIQA_SRC_DEPENDS_LIBDATABASE_LEVELDBPROFILE_H_
+#define ZILLIQA_SRC_DEPENDS_LIBDATABASE_LEVELDBPROFILE_H_
+
+#include <string>
+
+#include <leveldb/options.h>
+
+/// Tuning presets for the databases opened through LevelDB. Which databases
+/// use which profile is configured in the leveldb section of constants.xml.
+enum class LevelDBProfile {
+  DEFAULT,       // small or rarely read databases, leveldb defaults
+  POINT_LOOKUP,  // random reads by hash: bloom filters, small blocks
+  APPEND_ONLY,   // written once per block: large write buffers and blocks
+};
+
+const char* LevelDBProfileName(LevelDBProfile profile);
+
+/// Returns the profile configured for dbName. Databases split per epoch
+/// ("txBodies_3") use the profile of their base name.
+LevelDBProfile GetLevelDBProfile(const std::string& dbName);
+
+/// Returns open options for a database of the given profile. Every database
+/// shares one block cache, and databases of a profile share its bloom
+/// filter policy, so the returned options must not be freed.
+leveldb::Options GetLevelDBOptions(LevelDBProfile profile);
+
+#endif  // ZILLIQA_SRC_DEPENDS_LIBDATABASE_LEVELDBPROFILE_H_
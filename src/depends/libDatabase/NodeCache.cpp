@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "NodeCache.h"
+#include "libMetrics/Api.h"
+
+namespace {
+
+// Bookkeeping per entry on top of the node bytes themselves.
+constexpr size_t ENTRY_OVERHEAD = sizeof(dev::h256) + 64;
+
+Z_I64METRIC& GetHitsCounter() {
+  static Z_I64METRIC counter{Z_FL::STATE_DB, "nodecache.hits",
+                             "Trie nodes served from the node cache", "calls"};
+  return counter;
+}
+
+Z_I64METRIC& GetMissesCounter() {
+  static Z_I64METRIC counter{Z_FL::STATE_DB, "nodecache.misses",
+                             "Trie node lookups that went to disk", "calls"};
+  return counter;
+}
+
+Z_I64METRIC& GetEvictionsCounter() {
+  static Z_I64METRIC counter{Z_FL::STATE_DB, "nodecache.evictions",
+                             "Trie nodes evicted from the node cache",
+                             "calls"};
+  return counter;
+}
+
+}  // namespace
+
+NodeCache::NodeCache(size_t capacityBytes, size_t numShards) {
+  if (capacityBytes == 0 || numShards == 0) {
+    return;
+  }
+  m_shardCapacity = capacityBytes / numShards;
+  m_shards.reserve(numShards);
+  for (size_t i = 0; i < numShards; ++i) {
+    m_shards.emplace_back(std::make_unique<Shard>());
+  }
+}
+
+NodeCache::Shard& NodeCache::ShardFor(const dev::h256& key) {
+  // The key is already a hash, any of its bytes spreads evenly.
+  return *m_shards[key[0] % m_shards.size()];
+}
+
+bool NodeCache::Get(const dev::h256& key, std::string& value) {
+  if (!Enabled()) {
+    return false;
+  }
+
+  Shard& shard = ShardFor(key);
+  std::lock_guard<std::mutex> g(shard.mutex);
+  auto it = shard.index.find(key);
+  if (it == shard.index.end()) {
+    GetMissesCounter()++;
+    return false;
+  }
+  shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+  value = it->second->second;
+  GetHitsCounter()++;
+  return true;
+}
+
+void NodeCache::Put(const dev::h256& key, const std::string& value) {
+  const size_t size = value.size() + ENTRY_OVERHEAD;
+  if (!Enabled() || size > m_shardCapacity) {
+    return;
+  }
+
+  Shard& shard = ShardFor(key);
+  std::lock_guard<std::mutex> g(shard.mutex);
+  auto it = shard.index.find(key);
+  if (it != shard.index.end()) {
+    shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+    return;
+  }
+
+  shard.lru.emplace_front(key, value);
+  shard.index.emplace(key, shard.lru.begin());
+  shard.bytes += size;
+
+  size_t evicted = 0;
+  while (shard.bytes > m_shardCapacity) {
+    auto& last = shard.lru.back();
+    shard.bytes -= last.second.size() + ENTRY_OVERHEAD;
+    shard.index.erase(last.first);
+    shard.lru.pop_back();
+    ++evicted;
+  }
+  if (evicted > 0) {
+    GetEvictionsCounter().Increment(evicted);
+  }
+}
+
+void NodeCache::Erase(const dev::h256& key) {
+  if (!Enabled()) {
+    return;
+  }
+
+  Shard& shard = ShardFor(key);
+  std::lock_guard<std::mutex> g(shard.mutex);
+  auto it = shard.index.find(key);
+  if (it == shard.index.end()) {
+    return;
+  }
+  shard.bytes -= it->second->second.size() + ENTRY_OVERHEAD;
+  shard.lru.erase(it->second);
+  shard.index.erase(it);
+}
+
+void NodeCache::Clear() {
+  for (auto& shard : m_shards) {
+    std::lock_guard<std::mutex> g(shard->mutex);
+    shard->lru.clear();
+    shard->index.clear();
+    shard->bytes = 0;
+  }
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ZILLIQA_SRC_DEPENDS_LIBDATABASE_NODECACHE_H_
+#define ZILLIQA_SRC_DEPENDS_LIBDATABASE_NODECACHE_H_
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "depends/common/FixedHash.h"
+
+/// Size-bounded LRU of trie nodes read from or written to disk, keyed by
+/// node hash. Split into independently locked shards so that concurrent
+/// readers rarely contend. Nodes are content-addressed, so entries only
+/// need invalidating when the node is deleted from disk.
+class NodeCache {
+ public:
+  NodeCache(size_t capacityBytes, size_t numShards);
+
+  /// Returns true and fills value if the node is cached.
+  bool Get(const dev::h256& key, std::string& value);
+
+  void Put(const dev::h256& key, const std::string& value);
+
+  void Erase(const dev::h256& key);
+
+  void Clear();
+
+  bool Enabled() const { return !m_shards.empty(); }
+
+ private:
+  struct Shard {
+    std::mutex mutex;
+    std::list<std::pair<dev::h256, std::string>> lru;
+    std::unordered_map<dev::h256,
+                       std::list<std::pair<dev::h256, std::string>>::iterator>
+        index;
+    size_t bytes{0};
+  };
+
+  Shard& ShardFor(const dev::h256& key);
+
+  std::vector<std::unique_ptr<Shard>> m_shards;
+  size_t m_shardCapacity{0};
+};
+
+#endif  // ZILLIQA_SRC_DEPENDS_LIBDATABASE_NODECACHE_H_
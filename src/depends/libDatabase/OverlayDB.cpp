@@ -31,11 +31,13 @@ namespace dev
 	void OverlayDB::ResetDB()
 	{
 		m_levelDB.ResetDB();
+		m_nodeCache.Clear();
 		clear();
 	}
 
 	bool OverlayDB::RefreshDB()
 	{
+		m_nodeCache.Clear();
 		return m_levelDB.RefreshDB();
 	}
 
@@ -49,15 +51,22 @@ namespace dev
 
 			/// delete removed nodes in both mem and disk
 			purge(toPurge, false);
-			if (!keepHistory) {
-				m_levelDB.BatchDelete(toPurge);
-			}
+			static const std::vector<h256> keepAll;
+			const auto& toDelete = keepHistory ? keepAll : toPurge;
+			for (auto const& i: toDelete)
+				m_nodeCache.Erase(i);
 
-			/// add newly created nodes in disk
-			if (!m_levelDB.BatchInsert(*m_main, m_aux, inserted)) {
+			/// add newly created nodes in disk, in the same batch as the deletes
+			if (!m_levelDB.BatchInsert(*m_main, m_aux, inserted, toDelete)) {
 				LOG_GENERAL(WARNING, "BatchInsert failed");
 				return false;
 			}
+
+			/// keep the fresh nodes hot for the next epoch's reads
+			for (auto const& i: *m_main)
+				if (i.second.second)
+					m_nodeCache.Put(i.first, i.second.first);
+
 			/// clean temp files in leveldb
 			m_levelDB.Reopen();
 		}
@@ -110,8 +119,12 @@ namespace dev
 	{
 		std::string ret = MemoryDB::lookup(_h);
 	
-		if (ret.empty())
+		if (ret.empty() && !m_nodeCache.Get(_h, ret))
+		{
 			ret = m_levelDB.Lookup(_h);
+			if (!ret.empty())
+				m_nodeCache.Put(_h, ret);
+		}
 	
 		return ret;
 	}
@@ -121,7 +134,15 @@ namespace dev
 		if (MemoryDB::exists(_h))
 			return true;
 
-		return m_levelDB.Exists(_h);
+		return !lookup(_h).empty();
+	}
+
+	bool OverlayDB::deleteNodes(std::vector<h256> const& _keys)
+	{
+		for (auto const& i: _keys)
+			m_nodeCache.Erase(i);
+
+		return m_levelDB.BatchDelete(_keys);
 	}
 
 	void OverlayDB::kill(h256 const& _h)
@@ -26,6 +26,7 @@
 #include "depends/common/RLP.h"
 #include "LevelDB.h"
 #include "MemoryDB.h"
+#include "NodeCache.h"
 
 namespace dev
 {
@@ -36,7 +37,7 @@ namespace dev
 	class OverlayDB: public MemoryDB
 	{
 	public:
-		explicit OverlayDB(const std::string & dbName): m_levelDB(dbName) {}
+		explicit OverlayDB(const std::string & dbName): m_levelDB(dbName), m_nodeCache(size_t(STATE_NODE_CACHE_SIZE_MB) << 20, STATE_NODE_CACHE_SHARDS) {}
 		~OverlayDB() = default;
 
 		void ResetDB();
@@ -54,7 +55,13 @@ namespace dev
 	protected:
 		// using MemoryDB::clear;
 
+		/// Deletes nodes from disk and from the node cache.
+		bool deleteNodes(std::vector<h256> const& _keys);
+
 		LevelDB m_levelDB;
+
+		/// Hot nodes read from or committed to m_levelDB.
+		mutable NodeCache m_nodeCache;
 	};
 }
 
@@ -19,8 +19,14 @@
 #ifndef __TRIEDB_H__
 #define __TRIEDB_H__
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <map>
 #include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "TrieCommon.h"
 #include "libUtils/Logger.h"
@@ -32,6 +38,49 @@ struct InvalidTrie : virtual dev::Exception {};
 
 enum class Verification { Skip, Normal };
 
+/**
+ * @brief Node store used by one worker of GenericTrieDB::insertBatch.
+ * Reads fall through to the shared DB, writes are kept locally in order so
+ * that they can be replayed into the shared DB once all workers are done.
+ */
+template <class _DB>
+class TrieWriteBuffer {
+ public:
+  explicit TrieWriteBuffer(_DB const* _db) : m_db(_db) {}
+
+  std::string lookup(h256 const& _h) const {
+    auto it = m_nodes.find(_h);
+    return it != m_nodes.end() ? it->second : m_db->lookup(_h);
+  }
+
+  bool exists(h256 const& _h) const {
+    return m_nodes.count(_h) || m_db->exists(_h);
+  }
+
+  void insert(h256 const& _h, zbytesConstRef _v) {
+    m_nodes[_h] = _v.toString();
+    m_ops.emplace_back(true, _h);
+  }
+
+  void kill(h256 const& _h) { m_ops.emplace_back(false, _h); }
+
+  /// Applies the recorded writes to _db in the order they were made.
+  void replay(_DB* _db) const {
+    for (auto const& op : m_ops) {
+      if (op.first) {
+        _db->insert(op.second, zbytesConstRef(&m_nodes.at(op.second)));
+      } else {
+        _db->kill(op.second);
+      }
+    }
+  }
+
+ private:
+  _DB const* m_db;
+  std::unordered_map<h256, std::string> m_nodes;
+  std::vector<std::pair<bool, h256>> m_ops;
+};
+
 /**
  * @brief Merkle Patricia Tree "Trie": a modifed base-16 Radix tree.
  * This version uses a database backend.
@@ -128,6 +177,15 @@ class GenericTrieDB {
 
   void insert(zbytesConstRef _key, zbytesConstRef _value);
 
+  /// Inserts all entries in key order. Once the root is a branch node, the
+  /// batch is split along branch nodes, deeper where a subtree is large,
+  /// until there are _threads subtrees or no branch is left to split. The
+  /// subtrees are rebuilt and hashed on up to _threads workers. The resulting
+  /// trie and DB writes match inserting one by one. Returns the number of
+  /// subtrees the batch was split into, or 0 if it was inserted one by one.
+  size_t insertBatch(std::vector<std::pair<zbytes, zbytes>> _entries,
+                     unsigned _threads);
+
   void remove(zbytes const& _key) { remove(&_key); }
   void remove(zbytesConstRef _key);
 
@@ -265,8 +323,57 @@ class GenericTrieDB {
   DB* db() { return m_db; }
 
  private:
+  template <class>
+  friend class GenericTrieDB;
+
   RLPStream& streamNode(RLPStream& _s, zbytes const& _b);
 
+  /// A child of a branch node touched by insertBatch, along with the sorted
+  /// entries [begin, end) below it. Either rebuilt by one worker, or split
+  /// further into the children of the branch node it refers to.
+  struct BatchPart {
+    zbyte nibble;
+    size_t begin;
+    size_t end;
+    /// nibbles of the keys consumed to reach this part
+    unsigned depth;
+    /// RLP item in the parent: a hash, an inline node or empty
+    zbytes item{};
+    bool splittable = true;
+    std::vector<BatchPart> children{};
+    std::unique_ptr<TrieWriteBuffer<DB>> writes{};
+  };
+
+  /// The node _item refers to, or an empty string if there is none yet.
+  std::string batchNode(zbytes const& _item) const;
+
+  /// A branch node with all items empty.
+  static zbytes const& emptyBranch() {
+    static zbytes const s_branch = [] {
+      RLPStream s(17);
+      for (zbyte i = 0; i < 17; ++i) {
+        s << "";
+      }
+      return s.out();
+    }();
+    return s_branch;
+  }
+
+  /// Splits _part into the children of its branch node. A part without a
+  /// node yet is split as an empty branch if its keys diverge right away.
+  /// Returns false if it has a single entry, refers to a leaf or extension,
+  /// or a key ends there.
+  bool splitBatchPart(BatchPart& _part,
+                      std::vector<std::pair<zbytes, zbytes>> const& _entries)
+      const;
+
+  /// Writes the rebuilt _part to the DB, in the order mergeAt would, and
+  /// appends its new item to _out.
+  void assembleBatchPart(BatchPart& _part, RLPStream& _out);
+
+  /// The branch node _branch with the children of _part rebuilt.
+  zbytes assembleBatchBranch(BatchPart& _part, RLP const& _branch);
+
   std::string atAux(RLP const& _here, NibbleSlice _key) const;
 
   std::string getProof(RLP const& _here, NibbleSlice _key,
@@ -841,6 +948,191 @@ void GenericTrieDB<DB>::insert(zbytesConstRef _key, zbytesConstRef _value) {
   m_root = forceInsertNode(&b);
 }
 
+template <class DB>
+size_t GenericTrieDB<DB>::insertBatch(
+    std::vector<std::pair<zbytes, zbytes>> _entries, unsigned _threads) {
+  // Stable, so that a repeated key still ends up with its last value.
+  std::stable_sort(
+      _entries.begin(), _entries.end(),
+      [](auto const& _a, auto const& _b) { return _a.first < _b.first; });
+
+  // Go one by one until the root can be split; an empty key lives in the
+  // root, and a leaf or extension root has to branch first.
+  BatchPart root{0, 0, _entries.size(), 0};
+  for (; root.begin < root.end; ++root.begin) {
+    root.item = rlp(m_root);
+    if (_threads > 1 && splitBatchPart(root, _entries)) {
+      break;
+    }
+    insert(&_entries[root.begin].first, &_entries[root.begin].second);
+  }
+  if (root.children.empty()) {
+    return 0;
+  }
+
+  // Keys often share their first nibbles (hex strings only start with 3 or
+  // 6), so split the largest subtree further until every worker gets one.
+  std::vector<BatchPart*> subtrees;
+  for (auto& child : root.children) {
+    subtrees.push_back(&child);
+  }
+  while (subtrees.size() < _threads) {
+    auto largest = subtrees.end();
+    for (auto it = subtrees.begin(); it != subtrees.end(); ++it) {
+      if ((*it)->splittable &&
+          (largest == subtrees.end() ||
+           (*it)->end - (*it)->begin > (*largest)->end - (*largest)->begin)) {
+        largest = it;
+      }
+    }
+    if (largest == subtrees.end()) {
+      break;
+    }
+    BatchPart* part = *largest;
+    if (!splitBatchPart(*part, _entries)) {
+      part->splittable = false;
+      continue;
+    }
+    largest = subtrees.erase(largest);
+    for (auto& child : part->children) {
+      largest = subtrees.insert(largest, &child) + 1;
+    }
+  }
+
+  std::atomic<size_t> next{0};
+  std::vector<std::exception_ptr> errors(_threads);
+  auto worker = [&](unsigned _index) {
+    try {
+      for (size_t i = next++; i < subtrees.size(); i = next++) {
+        auto& subtree = *subtrees[i];
+        subtree.writes = std::make_unique<TrieWriteBuffer<DB>>(m_db);
+        GenericTrieDB<TrieWriteBuffer<DB>> trie(subtree.writes.get());
+        for (size_t j = subtree.begin; j < subtree.end; ++j) {
+          RLPStream s;
+          trie.mergeAtAux(s, RLP(subtree.item),
+                          NibbleSlice(&_entries[j].first).mid(subtree.depth),
+                          &_entries[j].second);
+          subtree.item = s.out();
+        }
+      }
+    } catch (...) {
+      errors[_index] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  unsigned numThreads = std::min<size_t>(_threads, subtrees.size());
+  for (unsigned i = 1; i < numThreads; ++i) {
+    threads.emplace_back(worker, i);
+  }
+  worker(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (auto const& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  // Same order of DB writes as insert: the old root goes first, then each
+  // child in turn, then the new root.
+  std::string rootValue = batchNode(root.item);
+  forceKillNode(m_root);
+  zbytes b = assembleBatchBranch(
+      root, rootValue.empty() ? RLP(emptyBranch()) : RLP(rootValue));
+  m_root = forceInsertNode(&b);
+
+  return subtrees.size();
+}
+
+template <class DB>
+std::string GenericTrieDB<DB>::batchNode(zbytes const& _item) const {
+  RLP item(_item);
+  if (item.isEmpty()) {
+    return std::string();
+  }
+  std::string value =
+      item.isList() ? item.data().toString() : node(item.toHash<h256>());
+  return RLP(value).isEmpty() ? std::string() : value;
+}
+
+template <class DB>
+bool GenericTrieDB<DB>::splitBatchPart(
+    BatchPart& _part,
+    std::vector<std::pair<zbytes, zbytes>> const& _entries) const {
+  if (_part.end - _part.begin < 2) {
+    return false;
+  }
+
+  // A key ending here would set the value of the branch itself. Being a
+  // prefix of the others it sorts first.
+  if (NibbleSlice(&_entries[_part.begin].first).size() <= _part.depth) {
+    return false;
+  }
+
+  std::string value = batchNode(_part.item);
+  RLP n = value.empty() ? RLP(emptyBranch()) : RLP(value);
+  if (!n.isList() || n.itemCount() != 17) {
+    return false;
+  }
+
+  std::vector<BatchPart> children;
+  for (size_t i = _part.begin; i < _part.end; ++i) {
+    zbyte nibble = NibbleSlice(&_entries[i].first)[_part.depth];
+    if (children.empty() || children.back().nibble != nibble) {
+      children.push_back(
+          {nibble, i, i, _part.depth + 1, n[nibble].data().toBytes()});
+    }
+    children.back().end = i + 1;
+  }
+
+  // Keys sharing their next nibble would go under a leaf or an extension.
+  if (value.empty() && children.size() < 2) {
+    return false;
+  }
+  _part.children = std::move(children);
+  return true;
+}
+
+template <class DB>
+void GenericTrieDB<DB>::assembleBatchPart(BatchPart& _part, RLPStream& _out) {
+  if (_part.children.empty()) {
+    _part.writes->replay(m_db);
+    _out.appendRaw(_part.item);
+    return;
+  }
+
+  std::string value = batchNode(_part.item);
+  if (value.empty()) {
+    streamNode(_out, assembleBatchBranch(_part, RLP(emptyBranch())));
+    return;
+  }
+
+  // Like mergeAtAux, a branch referred to by hash goes before its children.
+  RLP item(_part.item);
+  if (!item.isList()) {
+    killNode(RLP(value), item.toHash<h256>());
+  }
+  streamNode(_out, assembleBatchBranch(_part, RLP(value)));
+}
+
+template <class DB>
+zbytes GenericTrieDB<DB>::assembleBatchBranch(BatchPart& _part,
+                                              RLP const& _branch) {
+  RLPStream r(17);
+  auto child = _part.children.begin();
+  for (zbyte i = 0; i < 17; ++i) {
+    if (child != _part.children.end() && child->nibble == i) {
+      assembleBatchPart(*child, r);
+      ++child;
+    } else {
+      r.append(_branch[i]);
+    }
+  }
+  return r.out();
+}
+
 template <class DB>
 std::string GenericTrieDB<DB>::at(zbytesConstRef _key) const {
   return atAux(RLP(node(m_root)), _key);
@@ -147,6 +147,27 @@ std::optional<evm::EvmResult> CpsRunEvm::InvokeEvm() {
   using namespace zil::trace;
 
   evm::EvmResult result;
+  if (ENABLE_EVM_BINARY_TRANSPORT) {
+    // The binary transport bounds the call itself, so no worker thread is
+    // needed to enforce the timeout.
+    switch (EvmClient::GetInstance().CallRunner(
+        mProtoArgs, result, std::chrono::seconds(EVM_RPC_TIMEOUT_SECONDS))) {
+      case EvmBinaryTransport::Status::OK:
+        INC_STATUS(GetCPSMetric(), "unlock", "ok");
+        return result;
+      case EvmBinaryTransport::Status::FAILED:
+        INC_STATUS(GetCPSMetric(), "error", "binary transport");
+        return result;
+      case EvmBinaryTransport::Status::TIMEOUT:
+        LOG_GENERAL(WARNING, "Txn processing timeout!");
+        if (LAUNCH_EVM_DAEMON) {
+          EvmClient::GetInstance().Reset();
+        }
+        INC_STATUS(GetCPSMetric(), "unlock", "timeout");
+        return std::nullopt;
+    }
+  }
+
   const auto worker = [args = std::cref(mProtoArgs), &result,
                        trace_info =
                            Tracing::GetActiveSpan().GetIds()]() -> void {
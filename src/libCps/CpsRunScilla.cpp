@@ -28,6 +28,7 @@
 #include "libPersistence/BlockStorage.h"
 #include "libScilla/ScillaClient.h"
 #include "libScilla/ScillaUtils.h"
+#include "libScilla/ScillaWorkspace.h"
 #include "libUtils/DataConversion.h"
 #include "libUtils/DetachedFunction.h"
 #include "libUtils/TimeUtils.h"
@@ -151,8 +152,9 @@ CpsExecuteResult CpsRunScilla::runCreate(TransactionReceipt& receipt) {
     return {TxnStatus::FAIL_SCILLA_LIB, false, failedRetScillaVal};
   }
 
+  mWorkspace = std::make_shared<ScillaWorkspace>();
   if (!ScillaHelpers::ExportCreateContractFiles(
-          mAccountStore.GetContractCode(mArgs.dest),
+          *mWorkspace, mAccountStore.GetContractCode(mArgs.dest),
           mAccountStore.GetContractInitData(mArgs.dest), isLibrary,
           mAccountStore.GetScillaRootVersion(), scillaVersion,
           extlibsExports)) {
@@ -307,20 +309,21 @@ CpsExecuteResult CpsRunScilla::runCall(TransactionReceipt& receipt) {
     return {TxnStatus::FAIL_SCILLA_LIB, false, retScillaVal};
   }
 
+  mWorkspace = std::make_shared<ScillaWorkspace>();
   if (std::holds_alternative<ScillaArgs::CodeData>(mArgs.calldata)) {
     const auto& calldata = std::get<ScillaArgs::CodeData>(mArgs.calldata);
     if (!ScillaHelpers::ExportCallContractFiles(
-            mAccountStore, mArgs.from, mArgs.dest, calldata.data, mArgs.value,
-            scillaVersion, extlibsExports)) {
+            *mWorkspace, mAccountStore, mArgs.from, mArgs.dest, calldata.data,
+            mArgs.value, scillaVersion, extlibsExports)) {
       span.SetError("Unable to export call contract files");
       return {TxnStatus::FAIL_SCILLA_LIB, false, retScillaVal};
     }
 
   } else {
     const auto& jsonData = std::get<Json::Value>(mArgs.calldata);
-    if (!ScillaHelpers::ExportCallContractFiles(mAccountStore, mArgs.dest,
-                                                jsonData, scillaVersion,
-                                                extlibsExports)) {
+    if (!ScillaHelpers::ExportCallContractFiles(
+            *mWorkspace, mAccountStore, mArgs.dest, jsonData, scillaVersion,
+            extlibsExports)) {
       span.SetError("Unable to export call contract files");
       return {TxnStatus::FAIL_SCILLA_LIB, false, retScillaVal};
     }
@@ -440,10 +443,37 @@ ScillaInvokeResult CpsRunScilla::InvokeScillaInterpreter(INVOKE_TYPE type) {
           scillaVersion, mAccountStore.GetScillaRootVersion())) {
     return {};
   }
+  if (!mWorkspace) {
+    return {};
+  }
+
+  Json::Value request;
+  switch (type) {
+    case INVOKE_TYPE::CHECKER:
+      request = ScillaUtils::GetContractCheckerJson(
+          *mWorkspace, mAccountStore.GetScillaRootVersion(), isLibrary,
+          mCpsContext.gasTracker.GetCoreGas());
+      break;
+    case INVOKE_TYPE::RUNNER_CREATE:
+      request = ScillaUtils::GetCreateContractJson(
+          *mWorkspace, mAccountStore.GetScillaRootVersion(), isLibrary,
+          mCpsContext.gasTracker.GetCoreGas(), mArgs.value.toQa());
+      break;
+    case INVOKE_TYPE::RUNNER_CALL:
+      request = ScillaUtils::GetCallContractJson(
+          *mWorkspace, mAccountStore.GetScillaRootVersion(),
+          mCpsContext.gasTracker.GetCoreGas(),
+          mAccountStore.GetBalanceForAccountAtomic(mArgs.dest).toQa(),
+          isLibrary);
+      break;
+    case INVOKE_TYPE::DISAMBIGUATE:
+      request = ScillaUtils::GetDisambiguateJson(*mWorkspace);
+      break;
+  }
 
   using namespace zil::trace;
-  auto func2 = [this, &interprinterPrint, type, &scillaVersion, &isLibrary,
-                &callAlreadyFinished,
+  auto func2 = [this, &interprinterPrint, type, &scillaVersion,
+                &callAlreadyFinished, workspace = mWorkspace, request,
                 trace_info =
                     Tracing::GetActiveSpan().GetIds()]() mutable -> void {
     auto span = Tracing::CreateChildSpanOfRemoteTrace(
@@ -454,44 +484,29 @@ ScillaInvokeResult CpsRunScilla::InvokeScillaInterpreter(INVOKE_TYPE type) {
     switch (type) {
       case INVOKE_TYPE::CHECKER: {
         INC_STATUS(GetCPSMetric(), "ScillaInterpreterInvoke", "checker");
-        if (!ScillaClient::GetInstance().CallChecker(
-                scillaVersion,
-                ScillaUtils::GetContractCheckerJson(
-                    mAccountStore.GetScillaRootVersion(), isLibrary,
-                    mCpsContext.gasTracker.GetCoreGas()),
-                interprinterPrint)) {
+        if (!ScillaClient::GetInstance().CallChecker(scillaVersion, request,
+                                                     interprinterPrint)) {
         }
         break;
       }
       case INVOKE_TYPE::RUNNER_CREATE: {
         INC_STATUS(GetCPSMetric(), "ScillaInterpreterInvoke", "create");
-        if (!ScillaClient::GetInstance().CallRunner(
-                scillaVersion,
-                ScillaUtils::GetCreateContractJson(
-                    mAccountStore.GetScillaRootVersion(), isLibrary,
-                    mCpsContext.gasTracker.GetCoreGas(), mArgs.value.toQa()),
-                interprinterPrint)) {
+        if (!ScillaClient::GetInstance().CallRunner(scillaVersion, request,
+                                                    interprinterPrint)) {
         }
         break;
       }
       case INVOKE_TYPE::RUNNER_CALL: {
         INC_STATUS(GetCPSMetric(), "ScillaInterpreterInvoke", "call");
-        if (!ScillaClient::GetInstance().CallRunner(
-                scillaVersion,
-                ScillaUtils::GetCallContractJson(
-                    mAccountStore.GetScillaRootVersion(),
-                    mCpsContext.gasTracker.GetCoreGas(),
-                    mAccountStore.GetBalanceForAccountAtomic(mArgs.dest).toQa(),
-                    isLibrary),
-                interprinterPrint)) {
+        if (!ScillaClient::GetInstance().CallRunner(scillaVersion, request,
+                                                    interprinterPrint)) {
         }
         break;
       }
       case INVOKE_TYPE::DISAMBIGUATE: {
         INC_STATUS(GetCPSMetric(), "ScillaInterpreterInvoke", "disambiguate");
         if (!ScillaClient::GetInstance().CallDisambiguate(
-                scillaVersion, ScillaUtils::GetDisambiguateJson(),
-                interprinterPrint)) {
+                scillaVersion, request, interprinterPrint)) {
         }
         break;
       }
@@ -514,7 +529,7 @@ ScillaInvokeResult CpsRunScilla::InvokeScillaInterpreter(INVOKE_TYPE type) {
   if (mAccountStore.GetProcessTimeout()) {
     LOG_GENERAL(WARNING, "Txn processing timeout!");
 
-    ScillaClient::GetInstance().CheckClient(scillaVersion, true);
+    ScillaClient::GetInstance().ResetWorker(scillaVersion, request);
     return {};
   }
   return {true, std::move(interprinterPrint)};
@@ -23,8 +23,10 @@
 #include "libCps/CpsRun.h"
 
 #include <json/json.h>
+#include <memory>
 #include <variant>
 
+class ScillaWorkspace;
 class TransactionReceipt;
 
 namespace libCps {
@@ -89,6 +91,9 @@ class CpsRunScilla final : public CpsRun {
   ScillaArgs mArgs;
   CpsExecutor& mExecutor;
   CpsContext& mCpsContext;
+  // Files of the current interpreter invocation, shared with the thread
+  // talking to scilla-server.
+  std::shared_ptr<ScillaWorkspace> mWorkspace;
 };
 
 }  // namespace libCps
@@ -37,16 +37,16 @@ namespace libCps {
 
 constexpr auto MAX_SCILLA_OUTPUT_SIZE_IN_BYTES = 5120;
 
-void ScillaHelpers::ExportCommonFiles(
-    const std::vector<uint8_t> &contract_init_data, std::ofstream &os,
+bool ScillaHelpers::ExportCommonFiles(
+    ScillaWorkspace &workspace, const std::vector<uint8_t> &contract_init_data,
     const std::map<Address, std::pair<std::string, std::string>>
         &extlibs_exports) {
-  return ScillaUtils::ExportCommonFiles(contract_init_data, os,
+  return ScillaUtils::ExportCommonFiles(workspace, contract_init_data,
                                         extlibs_exports);
 }
 
 bool ScillaHelpers::ExportCreateContractFiles(
-    const std::vector<uint8_t> &contract_code,
+    ScillaWorkspace &workspace, const std::vector<uint8_t> &contract_code,
     const std::vector<uint8_t> &contract_init_data, bool is_library,
     std::string &scilla_root_version, uint32_t scilla_version,
     const std::map<Address, std::pair<std::string, std::string>>
@@ -54,21 +54,18 @@ bool ScillaHelpers::ExportCreateContractFiles(
   LOG_MARKER();
 
   return ScillaUtils::ExportCreateContractFiles(
-      contract_code, contract_init_data, is_library, scilla_root_version,
-      scilla_version, extlibs_exports);
+      workspace, contract_code, contract_init_data, is_library,
+      scilla_root_version, scilla_version, extlibs_exports);
 }
 
 bool ScillaHelpers::ExportContractFiles(
-    CpsAccountStoreInterface &acc_store, const Address &contract,
-    uint32_t scilla_version,
+    ScillaWorkspace &workspace, CpsAccountStoreInterface &acc_store,
+    const Address &contract, uint32_t scilla_version,
     const std::map<Address, std::pair<std::string, std::string>>
         &extlibs_exports) {
   LOG_MARKER();
   std::chrono::system_clock::time_point tpStart;
 
-  std::filesystem::remove_all("./" + SCILLA_FILES);
-  std::filesystem::create_directories("./" + SCILLA_FILES);
-
   if (!(std::filesystem::exists("./" + SCILLA_LOG))) {
     std::filesystem::create_directories("./" + SCILLA_LOG);
   }
@@ -83,13 +80,17 @@ bool ScillaHelpers::ExportContractFiles(
     return false;
   }
 
+  if (!workspace.IsReady()) {
+    LOG_GENERAL(WARNING, "Scilla workspace not available");
+    return false;
+  }
+
   try {
-    std::string scillaCodeExtension = CONTRACT_FILE_EXTENSION;
-    if (acc_store.IsAccountALibrary(contract)) {
-      scillaCodeExtension = LIBRARY_CODE_EXTENSION;
+    if (!CreateScillaCodeFiles(workspace, acc_store, contract, extlibs_exports,
+                               acc_store.IsAccountALibrary(contract))) {
+      LOG_GENERAL(WARNING, "CreateScillaCodeFiles failed");
+      return false;
     }
-    CreateScillaCodeFiles(acc_store, contract, extlibs_exports,
-                          scillaCodeExtension);
   } catch (const std::exception &e) {
     LOG_GENERAL(WARNING, "Exception caught: " << e.what());
     return false;
@@ -102,16 +103,16 @@ bool ScillaHelpers::ExportContractFiles(
 }
 
 bool ScillaHelpers::ExportCallContractFiles(
-    CpsAccountStoreInterface &acc_store, const Address &sender,
-    const Address &contract, const zbytes &data, const Amount &amount,
-    uint32_t scilla_version,
+    ScillaWorkspace &workspace, CpsAccountStoreInterface &acc_store,
+    const Address &sender, const Address &contract, const zbytes &data,
+    const Amount &amount, uint32_t scilla_version,
     const std::map<Address, std::pair<std::string, std::string>>
         &extlibs_exports) {
   LOG_MARKER();
   LOG_GENERAL(WARNING, "ExportCallContractFiles:, contract: "
                            << contract.hex() << ", sender: " << sender.hex()
                            << ", origin: " << sender.hex());
-  if (!ExportContractFiles(acc_store, contract, scilla_version,
+  if (!ExportContractFiles(workspace, acc_store, contract, scilla_version,
                            extlibs_exports)) {
     LOG_GENERAL(WARNING, "ExportContractFiles failed");
     return false;
@@ -130,7 +131,10 @@ bool ScillaHelpers::ExportCallContractFiles(
     msgObj["_origin"] = prepend + sender.hex();
     msgObj["_amount"] = amount.toQa().convert_to<std::string>();
 
-    JSONUtils::GetInstance().writeJsontoFile(INPUT_MESSAGE_JSON, msgObj);
+    if (!workspace.ExportInputMessageJson(msgObj)) {
+      LOG_GENERAL(WARNING, "Failed to export message json");
+      return false;
+    }
   } catch (const std::exception &e) {
     LOG_GENERAL(WARNING, "Exception caught: " << e.what());
     return false;
@@ -140,20 +144,24 @@ bool ScillaHelpers::ExportCallContractFiles(
 }
 
 bool ScillaHelpers::ExportCallContractFiles(
-    CpsAccountStoreInterface &acc_store, const Address &contract,
-    const Json::Value &contractData, uint32_t scilla_version,
+    ScillaWorkspace &workspace, CpsAccountStoreInterface &acc_store,
+    const Address &contract, const Json::Value &contractData,
+    uint32_t scilla_version,
     const std::map<Address, std::pair<std::string, std::string>>
         &extlibs_exports) {
   LOG_MARKER();
   LOG_GENERAL(WARNING, "ExportCallContractFiles: contract: " << contract.hex());
-  if (!ExportContractFiles(acc_store, contract, scilla_version,
+  if (!ExportContractFiles(workspace, acc_store, contract, scilla_version,
                            extlibs_exports)) {
     LOG_GENERAL(WARNING, "ExportContractFiles failed");
     return false;
   }
 
   try {
-    JSONUtils::GetInstance().writeJsontoFile(INPUT_MESSAGE_JSON, contractData);
+    if (!workspace.ExportInputMessageJson(contractData)) {
+      LOG_GENERAL(WARNING, "Failed to export message json");
+      return false;
+    }
   } catch (const std::exception &e) {
     LOG_GENERAL(WARNING, "Exception caught: " << e.what());
     return false;
@@ -162,19 +170,23 @@ bool ScillaHelpers::ExportCallContractFiles(
   return true;
 }
 
-void ScillaHelpers::CreateScillaCodeFiles(
-    CpsAccountStoreInterface &acc_store, const Address &contract,
+bool ScillaHelpers::CreateScillaCodeFiles(
+    ScillaWorkspace &workspace, CpsAccountStoreInterface &acc_store,
+    const Address &contract,
     const std::map<Address, std::pair<std::string, std::string>>
         &extlibs_exports,
-    const std::string &scillaCodeExtension) {
+    bool is_library) {
   LOG_MARKER();
   // Scilla code
-  std::ofstream os(INPUT_CODE + scillaCodeExtension);
-  os << DataConversion::CharArrayToString(acc_store.GetContractCode(contract));
-  os.close();
+  const std::string code =
+      DataConversion::CharArrayToString(acc_store.GetContractCode(contract));
+  if (!workspace.ExportCode(code, is_library)) {
+    LOG_GENERAL(WARNING, "Failed to export contract code");
+    return false;
+  }
 
-  ExportCommonFiles(acc_store.GetContractInitData(contract), os,
-                    extlibs_exports);
+  return ExportCommonFiles(workspace, acc_store.GetContractInitData(contract),
+                           extlibs_exports);
 }
 
 bool ScillaHelpers::ParseContractCheckerOutput(
@@ -305,15 +317,6 @@ bool ScillaHelpers::PopulateExtlibsExports(
         return false;
       }
 
-      /// Check whether there are caches
-      std::string code_path = EXTLIB_FOLDER + '/' + libAddr.hex();
-      code_path += LIBRARY_CODE_EXTENSION;
-      std::string json_path = EXTLIB_FOLDER + '/' + libAddr.hex() + ".json";
-      if (std::filesystem::exists(code_path) &&
-          std::filesystem::exists(json_path)) {
-        continue;
-      }
-
       uint32_t ext_scilla_version;
       bool ext_is_lib = false;
       std::vector<Address> ext_extlibs;
@@ -23,6 +23,7 @@
 
 #include <json/json.h>
 
+class ScillaWorkspace;
 class Transaction;
 class TransactionReceipt;
 
@@ -37,13 +38,14 @@ class ScillaHelpers final {
   using Address = dev::h160;
   /// export files that ExportCreateContractFiles and ExportContractFiles
   /// both needs
-  static void ExportCommonFiles(
-      const std::vector<uint8_t> &contract_init_data, std::ofstream &os,
+  static bool ExportCommonFiles(
+      ScillaWorkspace &workspace,
+      const std::vector<uint8_t> &contract_init_data,
       const std::map<Address, std::pair<std::string, std::string>>
           &extlibs_exports);
 
   static bool ExportCreateContractFiles(
-      const std::vector<uint8_t> &contract_code,
+      ScillaWorkspace &workspace, const std::vector<uint8_t> &contract_code,
       const std::vector<uint8_t> &contract_init_data, bool is_library,
       std::string &scilla_root_version, uint32_t scilla_version,
       const std::map<Address, std::pair<std::string, std::string>>
@@ -52,32 +54,34 @@ class ScillaHelpers final {
   /// generate the files for initdata, contract state, blocknum for interpreter
   /// to call contract
   static bool ExportContractFiles(
-      CpsAccountStoreInterface &acc_store, const Address &contract,
-      uint32_t scilla_version,
+      ScillaWorkspace &workspace, CpsAccountStoreInterface &acc_store,
+      const Address &contract, uint32_t scilla_version,
       const std::map<Address, std::pair<std::string, std::string>>
           &extlibs_exports);
 
   /// generate the files for message from txn for interpreter to call contract
   static bool ExportCallContractFiles(
-      CpsAccountStoreInterface &acc_store, const Address &sender,
-      const Address &contract, const zbytes &data, const Amount &amount,
-      uint32_t scilla_version,
+      ScillaWorkspace &workspace, CpsAccountStoreInterface &acc_store,
+      const Address &sender, const Address &contract, const zbytes &data,
+      const Amount &amount, uint32_t scilla_version,
       const std::map<Address, std::pair<std::string, std::string>>
           &extlibs_exports);
 
   /// generate the files for message from previous contract output for
   /// interpreter to call another contract
   static bool ExportCallContractFiles(
-      CpsAccountStoreInterface &acc_store, const Address &contract,
-      const Json::Value &contractData, uint32_t scilla_version,
+      ScillaWorkspace &workspace, CpsAccountStoreInterface &acc_store,
+      const Address &contract, const Json::Value &contractData,
+      uint32_t scilla_version,
       const std::map<Address, std::pair<std::string, std::string>>
           &extlibs_exports);
 
-  static void CreateScillaCodeFiles(
-      CpsAccountStoreInterface &acc_store, const Address &contract,
+  static bool CreateScillaCodeFiles(
+      ScillaWorkspace &workspace, CpsAccountStoreInterface &acc_store,
+      const Address &contract,
       const std::map<Address, std::pair<std::string, std::string>>
           &extlibs_exports,
-      const std::string &scillaCodeExtension);
+      bool is_library);
 
   static bool ParseContractCheckerOutput(
       CpsAccountStoreInterface &acc_store, const Address &addr,
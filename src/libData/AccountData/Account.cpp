@@ -497,29 +497,32 @@ bool Account::SetCode(const zbytes& code) {
     return false;
   }
 
-  m_codeCache = code;
+  m_codeCache = ContractBlobPool::GetInstance().Intern(code);
   return true;
 }
 
-const zbytes Account::GetCode() const {
+const zbytes Account::GetCode() const { return *GetCodeBlob(); }
+
+ContractBlob Account::GetCodeBlob() const {
   if (!isContract() && !IsLibrary()) {
-    return {};
+    return ContractBlobPool::Empty();
   }
 
-  if (m_codeCache.empty()) {
-    return ContractStorage::GetContractStorage().GetContractCode(m_address);
+  if (m_codeCache->empty()) {
+    return ContractBlobPool::GetInstance().Intern(
+        ContractStorage::GetContractStorage().GetContractCode(m_address));
   }
   return m_codeCache;
 }
 
 bool Account::GetContractCodeHash(dev::h256& contractCodeHash) const {
-  const auto& codeCache = GetCode();
-  if (codeCache.empty()) {
+  const auto codeCache = GetCodeBlob();
+  if (codeCache->empty()) {
     return false;
   }
 
   SHA256Calculator sha2;
-  sha2.Update(codeCache);
+  sha2.Update(*codeCache);
   contractCodeHash = dev::h256(sha2.Finalize());
 
   return true;
@@ -550,12 +553,12 @@ bool Account::RetrieveContractAuxiliaries() {
     return false;
   }
 
-  zbytes initData = GetInitData();
+  const auto initData = GetInitDataBlob();
   if (!JSONUtils::GetInstance().convertStrtoJson(
-          DataConversion::CharArrayToString(initData), m_initDataJson)) {
+          DataConversion::CharArrayToString(*initData), m_initDataJson)) {
     LOG_GENERAL(WARNING, "Convert InitData to Json failed"
                              << endl
-                             << DataConversion::CharArrayToString(initData));
+                             << DataConversion::CharArrayToString(*initData));
     return false;
   }
 
@@ -565,18 +568,21 @@ bool Account::RetrieveContractAuxiliaries() {
 
 bool Account::SetInitData(const zbytes& initData) {
   // LOG_MARKER();
-  m_initDataCache = initData;
+  m_initDataCache = ContractBlobPool::GetInstance().Intern(initData);
   return true;
 }
 
-const zbytes Account::GetInitData() const {
+const zbytes Account::GetInitData() const { return *GetInitDataBlob(); }
+
+ContractBlob Account::GetInitDataBlob() const {
   if (!isContract() && !IsLibrary()) {
     LOG_GENERAL(INFO, "Not a contract or library");
-    return {};
+    return ContractBlobPool::Empty();
   }
 
-  if (m_initDataCache.empty()) {
-    return ContractStorage::GetContractStorage().GetInitData(m_address);
+  if (m_initDataCache->empty()) {
+    return ContractBlobPool::GetInstance().Intern(
+        ContractStorage::GetContractStorage().GetInitData(m_address));
   }
   return m_initDataCache;
 }
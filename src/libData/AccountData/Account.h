@@ -21,6 +21,7 @@
 #include <json/json.h>
 
 #include "Address.h"
+#include "ContractBlob.h"
 #include "common/Constants.h"
 #include "common/Serializable.h"
 
@@ -96,9 +97,9 @@ inline std::ostream& operator<<(std::ostream& out,
 }
 
 class Account : public AccountBase {
-  // The associated code for this account.
-  zbytes m_codeCache;
-  zbytes m_initDataCache;
+  // The associated code for this account, shared between copies.
+  ContractBlob m_codeCache = ContractBlobPool::Empty();
+  ContractBlob m_initDataCache = ContractBlobPool::Empty();
 
   Address m_address;  // used by contract account only
   Json::Value m_initDataJson = Json::nullValue;
@@ -154,12 +155,18 @@ class Account : public AccountBase {
 
   const zbytes GetCode() const;
 
+  /// Returns the code without copying it. Never null.
+  ContractBlob GetCodeBlob() const;
+
   bool GetContractCodeHash(dev::h256& contractCodeHash) const;
 
   bool SetInitData(const zbytes& initData);
 
   const zbytes GetInitData() const;
 
+  /// Returns the init data without copying it. Never null.
+  ContractBlob GetInitDataBlob() const;
+
   bool GetContractAuxiliaries(bool& is_library, uint32_t& scilla_version,
                               std::vector<Address>& extlibs);
 
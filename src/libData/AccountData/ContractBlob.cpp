@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <string_view>
+
+#include "ContractBlob.h"
+
+namespace {
+
+size_t HashBytes(const zbytes& bytes) {
+  return std::hash<std::string_view>{}(std::string_view(
+      reinterpret_cast<const char*>(bytes.data()), bytes.size()));
+}
+
+}  // namespace
+
+ContractBlobPool& ContractBlobPool::GetInstance() {
+  static ContractBlobPool pool;
+  return pool;
+}
+
+const ContractBlob& ContractBlobPool::Empty() {
+  static const ContractBlob empty = std::make_shared<const zbytes>();
+  return empty;
+}
+
+template <typename Bytes>
+ContractBlob ContractBlobPool::InternImpl(Bytes&& bytes) {
+  if (bytes.empty()) {
+    return Empty();
+  }
+
+  const size_t hash = HashBytes(bytes);
+
+  std::lock_guard<std::mutex> g(m_mutex);
+
+  auto range = m_blobs.equal_range(hash);
+  for (auto it = range.first; it != range.second;) {
+    if (auto blob = it->second.lock()) {
+      if (*blob == bytes) {
+        return blob;
+      }
+      ++it;
+    } else {
+      it = m_blobs.erase(it);
+    }
+  }
+
+  ContractBlob blob =
+      std::make_shared<const zbytes>(std::forward<Bytes>(bytes));
+  m_blobs.emplace(hash, blob);
+
+  if (m_blobs.size() >= m_sweepThreshold) {
+    SweepExpired();
+  }
+  return blob;
+}
+
+ContractBlob ContractBlobPool::Intern(const zbytes& bytes) {
+  return InternImpl(bytes);
+}
+
+ContractBlob ContractBlobPool::Intern(zbytes&& bytes) {
+  return InternImpl(std::move(bytes));
+}
+
+void ContractBlobPool::SweepExpired() {
+  for (auto it = m_blobs.begin(); it != m_blobs.end();) {
+    if (it->second.expired()) {
+      it = m_blobs.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  // Sweep again once the live set has doubled
+  m_sweepThreshold = std::max<size_t>(1024, m_blobs.size() * 2);
+}
+
+size_t ContractBlobPool::Size() {
+  std::lock_guard<std::mutex> g(m_mutex);
+  SweepExpired();
+  return m_blobs.size();
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ZILLIQA_SRC_LIBDATA_ACCOUNTDATA_CONTRACTBLOB_H_
+#define ZILLIQA_SRC_LIBDATA_ACCOUNTDATA_CONTRACTBLOB_H_
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "common/BaseType.h"
+
+/// Immutable contract code or init data, shared by every copy of an account.
+using ContractBlob = std::shared_ptr<const zbytes>;
+
+/// Interns contract blobs by content, so that all accounts and account copies
+/// holding the same code point at a single buffer. Only weak references are
+/// kept; a blob is freed when the last account holding it goes away.
+class ContractBlobPool {
+ public:
+  static ContractBlobPool& GetInstance();
+
+  ContractBlob Intern(const zbytes& bytes);
+  ContractBlob Intern(zbytes&& bytes);
+
+  /// Shared empty blob, never null.
+  static const ContractBlob& Empty();
+
+  /// Number of distinct live blobs.
+  size_t Size();
+
+ private:
+  ContractBlobPool() = default;
+
+  template <typename Bytes>
+  ContractBlob InternImpl(Bytes&& bytes);
+
+  void SweepExpired();
+
+  std::mutex m_mutex;
+  std::unordered_multimap<size_t, std::weak_ptr<const zbytes>> m_blobs;
+  size_t m_sweepThreshold{1024};
+};
+
+#endif  // ZILLIQA_SRC_LIBDATA_ACCOUNTDATA_CONTRACTBLOB_H_
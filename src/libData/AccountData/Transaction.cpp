@@ -17,6 +17,8 @@
 
 #include "Transaction.h"
 #include <algorithm>
+#include <atomic>
+#include <thread>
 #include "Account.h"
 #include "libCrypto/EthCrypto.h"
 #include "libCrypto/Sha2.h"
@@ -349,6 +351,65 @@ bool Transaction::Verify(const Transaction &tran) {
   return result;
 }
 
+namespace {
+
+// Runs verify(i) for i in [0, count) on TXN_SIG_VERIFY_THREADS workers.
+template <typename Verify>
+std::vector<bool> VerifyInParallel(size_t count, const Verify &verify) {
+  // Below this many signatures per thread the spawn cost outweighs the gain.
+  constexpr size_t MIN_TXNS_PER_THREAD = 32;
+
+  const size_t maxThreads =
+      TXN_SIG_VERIFY_THREADS > 0
+          ? TXN_SIG_VERIFY_THREADS
+          : std::max(1u, std::thread::hardware_concurrency());
+  const size_t numThreads =
+      std::max<size_t>(1, std::min(maxThreads, count / MIN_TXNS_PER_THREAD));
+
+  // std::vector<bool> packs bits, so concurrent writes need separate bytes.
+  std::vector<uint8_t> valid(count, 0);
+  std::atomic<size_t> next{0};
+
+  auto worker = [&]() {
+    for (size_t i = next++; i < count; i = next++) {
+      valid[i] = verify(i) ? 1 : 0;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(numThreads - 1);
+  for (size_t i = 1; i < numThreads; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  return std::vector<bool>(valid.begin(), valid.end());
+}
+
+}  // namespace
+
+std::vector<bool> Transaction::VerifyBatch(
+    std::span<const Transaction> txns) {
+  return VerifyInParallel(txns.size(),
+                          [&txns](size_t i) { return Verify(txns[i]); });
+}
+
+std::vector<bool> Transaction::VerifyBatch(std::span<const Transaction> txns,
+                                           std::span<const zbytes> txnData) {
+  if (txns.size() != txnData.size()) {
+    LOG_GENERAL(WARNING, "Got " << txnData.size() << " signed payloads for "
+                                << txns.size() << " txns");
+    return std::vector<bool>(txns.size(), false);
+  }
+
+  return VerifyInParallel(txns.size(), [&txns, &txnData](size_t i) {
+    return txns[i].IsSigned(txnData[i]);
+  });
+}
+
 bool Transaction::operator==(const Transaction &tran) const {
   return ((m_tranID == tran.m_tranID) && (m_signature == tran.m_signature));
 }
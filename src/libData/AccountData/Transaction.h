@@ -19,6 +19,8 @@
 #define ZILLIQA_SRC_LIBDATA_ACCOUNTDATA_TRANSACTION_H_
 
 #include <Schnorr.h>
+#include <span>
+#include <vector>
 #include "Address.h"
 #include "common/Constants.h"
 #include "common/Hashes.h"
@@ -212,6 +214,15 @@ class Transaction : public SerializableDataBlock {
 
   static bool Verify(const Transaction& tx);
 
+  /// Verifies the signatures of a batch of transactions in parallel.
+  /// Returns one entry per transaction, true if its signature is valid.
+  static std::vector<bool> VerifyBatch(std::span<const Transaction> txns);
+
+  /// As above, but checks each signature against the matching entry of
+  /// txnData, i.e. the core fields exactly as they were received.
+  static std::vector<bool> VerifyBatch(std::span<const Transaction> txns,
+                                       std::span<const zbytes> txnData);
+
   /// Equality comparison operator.
   bool operator==(const Transaction& tran) const;
 
@@ -20,6 +20,7 @@
 
 #include <functional>
 #include <map>
+#include <memory>
 #include <unordered_map>
 
 #include "Account.h"
@@ -28,7 +29,12 @@
 
 using MempoolInsertionStatus = std::pair<TxnStatus, TxnHash>;
 
+// Every transaction in the pool is stored exactly once, behind a shared
+// immutable handle. HashIndex, GasIndex and NonceIndex all refer to the same
+// body, so copying a pool (see snapshot()) only copies the handles.
 struct TxnPool {
+  using TxnHandle = std::shared_ptr<const Transaction>;
+
   struct PubKeyNonceHash {
     std::size_t operator()(const std::pair<PubKey, uint128_t>& p) const {
       std::size_t seed = 0;
@@ -39,10 +45,10 @@ struct TxnPool {
     }
   };
 
-  std::unordered_map<TxnHash, Transaction> HashIndex;
-  std::map<uint128_t, std::map<TxnHash, Transaction>, std::greater<uint128_t>>
+  std::unordered_map<TxnHash, TxnHandle> HashIndex;
+  std::map<uint128_t, std::map<TxnHash, TxnHandle>, std::greater<uint128_t>>
       GasIndex;
-  std::unordered_map<std::pair<PubKey, uint64_t>, Transaction, PubKeyNonceHash>
+  std::unordered_map<std::pair<PubKey, uint64_t>, TxnHandle, PubKeyNonceHash>
       NonceIndex;
 
   void clear() {
@@ -53,19 +59,40 @@ struct TxnPool {
 
   unsigned int size() const { return HashIndex.size(); }
 
-  bool exist(const TxnHash& th) {
+  bool exist(const TxnHash& th) const {
     return HashIndex.find(th) != HashIndex.end();
   }
 
-  bool get(const TxnHash& th, Transaction& t) {
-    if (!exist(th)) {
+  // Returns the pooled transaction without copying it, or nullptr
+  const Transaction* find(const TxnHash& th) const {
+    auto it = HashIndex.find(th);
+    if (it == HashIndex.end()) {
+      return nullptr;
+    }
+    return it->second.get();
+  }
+
+  bool get(const TxnHash& th, Transaction& t) const {
+    const auto* found = find(th);
+    if (found == nullptr) {
       return false;
     }
-    t = HashIndex.at(th);
+    t = *found;
 
     return true;
   }
 
+  // Shallow copy of the pool: indexes are duplicated, transaction bodies are
+  // shared with this pool. Removing from the snapshot leaves this pool as is.
+  TxnPool snapshot() const { return *this; }
+
+  template <typename Func>
+  void forEach(Func&& func) const {
+    for (const auto& entry : HashIndex) {
+      func(*entry.second);
+    }
+  }
+
   bool insert(const Transaction& t, MempoolInsertionStatus& status) {
     if (exist(t.GetTranID())) {
       status = {TxnStatus::MEMPOOL_ALREADY_PRESENT, t.GetTranID()};
@@ -74,31 +101,17 @@ struct TxnPool {
 
     auto searchNonce = NonceIndex.find({t.GetSenderPubKey(), t.GetNonce()});
     if (searchNonce != NonceIndex.end()) {
-      if ((t.GetGasPriceQa() > searchNonce->second.GetGasPriceQa()) ||
-          (t.GetGasPriceQa() == searchNonce->second.GetGasPriceQa() &&
-           t.GetTranID() < searchNonce->second.GetTranID())) {
-        // erase from HashIdxTxns
-        TxnHash hashToBeRemoved = searchNonce->second.GetTranID();
-        auto searchHash = HashIndex.find(searchNonce->second.GetTranID());
-        if (searchHash != HashIndex.end()) {
-          HashIndex.erase(searchHash);
-        }
-        // erase from GasIdxTxns
-        auto smallerGasPrice = searchNonce->second.GetGasPriceQa();
-        auto searchGas = GasIndex.find(searchNonce->second.GetGasPriceQa());
-        if (searchGas != GasIndex.end()) {
-          auto searchGasHash =
-              searchGas->second.find(searchNonce->second.GetTranID());
-          if (searchGasHash != searchGas->second.end()) {
-            searchGas->second.erase(searchGasHash);
-          }
-          if (GasIndex[smallerGasPrice].empty()) {
-            GasIndex.erase(smallerGasPrice);
-          }
-        }
-        HashIndex[t.GetTranID()] = t;
-        GasIndex[t.GetGasPriceQa()][t.GetTranID()] = t;
-        searchNonce->second = t;
+      const auto& existing = *searchNonce->second;
+      if ((t.GetGasPriceQa() > existing.GetGasPriceQa()) ||
+          (t.GetGasPriceQa() == existing.GetGasPriceQa() &&
+           t.GetTranID() < existing.GetTranID())) {
+        TxnHash hashToBeRemoved = existing.GetTranID();
+        eraseFromHashAndGas(existing);
+
+        auto handle = std::make_shared<const Transaction>(t);
+        HashIndex[t.GetTranID()] = handle;
+        GasIndex[t.GetGasPriceQa()][t.GetTranID()] = handle;
+        searchNonce->second = std::move(handle);
 
         status = {TxnStatus::MEMPOOL_SAME_NONCE_LOWER_GAS, hashToBeRemoved};
         return true;
@@ -109,9 +122,10 @@ struct TxnPool {
         return false;
       }
     } else {
-      HashIndex[t.GetTranID()] = t;
-      GasIndex[t.GetGasPriceQa()][t.GetTranID()] = t;
-      NonceIndex[{t.GetSenderPubKey(), t.GetNonce()}] = t;
+      auto handle = std::make_shared<const Transaction>(t);
+      HashIndex[t.GetTranID()] = handle;
+      GasIndex[t.GetGasPriceQa()][t.GetTranID()] = handle;
+      NonceIndex[{t.GetSenderPubKey(), t.GetNonce()}] = std::move(handle);
     }
     status = {TxnStatus::NOT_PRESENT, t.GetTranID()};
     return true;
@@ -120,18 +134,16 @@ struct TxnPool {
   void findSameNonceButHigherGas(Transaction& t) {
     auto searchNonce = NonceIndex.find({t.GetSenderPubKey(), t.GetNonce()});
     if (searchNonce != NonceIndex.end()) {
-      if (searchNonce->second.GetGasPriceQa() > t.GetGasPriceQa()) {
-        t = std::move(searchNonce->second);
+      if (searchNonce->second->GetGasPriceQa() > t.GetGasPriceQa()) {
+        // Keep the handle alive until the indexes no longer refer to it
+        TxnHandle handle = std::move(searchNonce->second);
 
         // erase tx nonce map
         NonceIndex.erase(searchNonce);
-        // erase tx gas map
-        GasIndex[t.GetGasPriceQa()].erase(t.GetTranID());
-        if (GasIndex[t.GetGasPriceQa()].empty()) {
-          GasIndex.erase(t.GetGasPriceQa());
-        }
-        // erase tx hash map
-        HashIndex.erase(t.GetTranID());
+        // erase tx gas map and tx hash map
+        eraseFromHashAndGas(*handle);
+
+        t = *handle;
       }
     }
   }
@@ -145,7 +157,7 @@ struct TxnPool {
     auto firstHash = firstGas->second.begin();
 
     if (firstHash != firstGas->second.end()) {
-      t = std::move(firstHash->second);
+      TxnHandle handle = std::move(firstHash->second);
 
       // erase tx gas map
       firstGas->second.erase(firstHash);
@@ -153,21 +165,39 @@ struct TxnPool {
         GasIndex.erase(firstGas);
       }
       // erase tx nonce map
-      NonceIndex.erase({t.GetSenderPubKey(), t.GetNonce()});
-      // erase tx hash m ap
-      HashIndex.erase(t.GetTranID());
+      NonceIndex.erase({handle->GetSenderPubKey(), handle->GetNonce()});
+      // erase tx hash map
+      HashIndex.erase(handle->GetTranID());
+
+      t = *handle;
       return true;
     }
     return false;
   }
+
+ private:
+  void eraseFromHashAndGas(const Transaction& t) {
+    // Copy the keys first, as t may be owned by the handles erased below
+    const TxnHash tranID = t.GetTranID();
+    const uint128_t gasPrice = t.GetGasPriceQa();
+
+    auto searchGas = GasIndex.find(gasPrice);
+    if (searchGas != GasIndex.end()) {
+      searchGas->second.erase(tranID);
+      if (searchGas->second.empty()) {
+        GasIndex.erase(searchGas);
+      }
+    }
+    HashIndex.erase(tranID);
+  }
 };
 
 inline std::ostream& operator<<(std::ostream& os, const TxnPool& t) {
   os << "Txn in txnPool: " << std::endl;
   for (const auto& entry : t.HashIndex) {
     os << "TranID: " << entry.first.hex()
-       << " Sender:" << entry.second.GetSenderAddr()
-       << " Nonce: " << entry.second.GetNonce() << std::endl;
+       << " Sender:" << entry.second->GetSenderAddr()
+       << " Nonce: " << entry.second->GetNonce() << std::endl;
   }
   return os;
 }
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "AccountReadSnapshot.h"
+
+#include <mutex>
+
+using namespace std;
+
+AccountReadSnapshot::AccountReadSnapshot(uint64_t version,
+                                         const dev::h256& root, Cache cache)
+    : m_version(version), m_root(root), m_cache(std::move(cache)) {}
+
+shared_ptr<const Account> AccountReadSnapshot::Find(
+    const Address& address) const {
+  shared_lock<shared_mutex> lock(m_mutexCache);
+  const auto it = m_cache.find(address);
+  return it == m_cache.end() ? nullptr : it->second;
+}
+
+void AccountReadSnapshot::Insert(const Address& address,
+                                 shared_ptr<const Account> account,
+                                 size_t maxSize) const {
+  unique_lock<shared_mutex> lock(m_mutexCache);
+  if (m_cache.size() < maxSize) {
+    m_cache.emplace(address, std::move(account));
+  }
+}
+
+AccountReadSnapshot::Cache AccountReadSnapshot::Inherit(
+    const unordered_set<Address>& changed) const {
+  shared_lock<shared_mutex> lock(m_mutexCache);
+  Cache cache;
+  cache.reserve(m_cache.size());
+  for (const auto& entry : m_cache) {
+    if (changed.find(entry.first) == changed.end()) {
+      cache.emplace(entry);
+    }
+  }
+  return cache;
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ZILLIQA_SRC_LIBDATA_ACCOUNTSTORE_ACCOUNTREADSNAPSHOT_H_
+#define ZILLIQA_SRC_LIBDATA_ACCOUNTSTORE_ACCOUNTREADSNAPSHOT_H_
+
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "depends/common/FixedHash.h"
+#include "libData/AccountData/Account.h"
+#include "libData/AccountData/Address.h"
+
+/// Committed account state at one state root, published by AccountStore
+/// every time the committed state changes. Readers that hold a snapshot see
+/// the same root and accounts however many commits follow, and never touch
+/// the AccountStore locks that commits take.
+///
+/// Accounts decoded from the trie are cached in the snapshot. The cache is
+/// carried over to the next snapshot minus the accounts changed in between,
+/// so hot accounts are not decoded again on every block.
+class AccountReadSnapshot {
+ public:
+  using Cache = std::unordered_map<Address, std::shared_ptr<const Account>>;
+
+  AccountReadSnapshot(uint64_t version, const dev::h256& root,
+                      Cache cache = {});
+
+  /// Increases by one every time a snapshot is published
+  uint64_t GetVersion() const { return m_version; }
+
+  const dev::h256& GetRoot() const { return m_root; }
+
+  /// Returns the cached account, or nullptr if it has not been read yet
+  std::shared_ptr<const Account> Find(const Address& address) const;
+
+  /// Caches an account read from the trie at this snapshot's root, unless
+  /// the cache already holds maxSize accounts
+  void Insert(const Address& address, std::shared_ptr<const Account> account,
+              size_t maxSize) const;
+
+  /// Returns the cache to seed the next snapshot with, without the accounts
+  /// that changed since this one
+  Cache Inherit(const std::unordered_set<Address>& changed) const;
+
+ private:
+  const uint64_t m_version;
+  const dev::h256 m_root;
+
+  mutable std::shared_mutex m_mutexCache;
+  mutable Cache m_cache;
+};
+
+#endif  // ZILLIQA_SRC_LIBDATA_ACCOUNTSTORE_ACCOUNTREADSNAPSHOT_H_
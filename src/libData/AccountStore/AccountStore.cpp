@@ -16,7 +16,9 @@
  */
 
 #include <leveldb/db.h>
+#include <atomic>
 #include <regex>
+#include <thread>
 
 #include "libData/AccountStore/AccountStore.h"
 #include "libData/AccountStore/services/evm/EvmClient.h"
@@ -37,6 +39,7 @@
 
 #include "libData/AccountStore/services/evm/EvmClient.h"
 #include "libMetrics/Api.h"
+#include "libScilla/ScillaIPCBinaryServer.h"
 #include "libScilla/ScillaIPCServer.h"
 #include "libScilla/ScillaUtils.h"
 #include "libScilla/UnixDomainSocketServer.h"
@@ -97,6 +100,7 @@ AccountStore::AccountStore()
     : m_db("state"),
       m_state(&m_db),
       m_accountStoreTemp(*this),
+      m_readSnapshot(make_shared<const AccountReadSnapshot>(0, dev::h256())),
       m_scillaIPCServerConnector(SCILLA_IPC_SOCKET_PATH) {
   bool ipcScillaInit = false;
 
@@ -121,6 +125,13 @@ AccountStore::AccountStore()
       } else {
         LOG_GENERAL(WARNING, "Scilla IPC Server couldn't start");
       }
+      if (ENABLE_SCILLA_IPC_BINARY) {
+        m_scillaIPCBinaryServer = make_unique<ScillaIPCBinaryServer>(
+            *m_scillaIPCServer, SCILLA_IPC_BINARY_SOCKET_PATH);
+        if (!m_scillaIPCBinaryServer->StartListening()) {
+          LOG_GENERAL(WARNING, "Scilla binary IPC Server couldn't start");
+        }
+      }
     }
   }
   // EVM required to run on Lookup nodes too for view calls
@@ -135,6 +146,9 @@ AccountStore::AccountStore()
 
 AccountStore::~AccountStore() {
   // std::filesystem::remove_all("./state");
+  if (m_scillaIPCBinaryServer != nullptr) {
+    m_scillaIPCBinaryServer->StopListening();
+  }
   if (m_scillaIPCServer != nullptr) {
     m_scillaIPCServer->StopListening();
   }
@@ -148,6 +162,7 @@ void AccountStore::Init() {
   lock_guard<mutex> g(m_mutexDB);
 
   ContractStorage::GetContractStorage().Reset();
+  unique_lock<shared_mutex> g2(m_mutexDBHandle);
   m_db.ResetDB();
 }
 
@@ -162,6 +177,7 @@ void AccountStore::InitSoft() {
 
   AccountStoreBase::Init();
   InitTrie();
+  PublishReadSnapshot(false);
 
   InitRevertibles();
 
@@ -232,16 +248,94 @@ bool AccountStore::RefreshDB() {
   bool ret = true;
   {
     lock_guard<mutex> g(m_mutexDB);
+    unique_lock<shared_mutex> g2(m_mutexDBHandle);
     ret = ret && m_db.RefreshDB();
   }
   return ret;
 }
 
+void AccountStore::PublishReadSnapshot(bool keepCache) {
+  unordered_set<Address> changed;
+  dev::h256 root;
+  {
+    lock_guard<mutex> g(m_mutexTrie);
+    root = m_state.root();
+    changed.swap(m_changedSinceReadSnapshot);
+  }
+
+  lock_guard<mutex> g(m_mutexReadSnapshot);
+  if (m_readSnapshot->GetRoot() == root && keepCache) {
+    return;
+  }
+  m_readSnapshot = make_shared<const AccountReadSnapshot>(
+      m_readSnapshot->GetVersion() + 1, root,
+      keepCache ? m_readSnapshot->Inherit(changed)
+                : AccountReadSnapshot::Cache{});
+}
+
+shared_ptr<const AccountReadSnapshot> AccountStore::GetReadSnapshot() const {
+  lock_guard<mutex> g(m_mutexReadSnapshot);
+  return m_readSnapshot;
+}
+
+shared_ptr<const Account> AccountStore::GetCommittedAccount(
+    const Address &address, shared_ptr<const AccountReadSnapshot> snapshot) {
+  const bool latest = snapshot == nullptr;
+  if (latest) {
+    snapshot = GetReadSnapshot();
+  }
+
+  if (auto account = snapshot->Find(address)) {
+    return account;
+  }
+
+  if (snapshot->GetRoot() == dev::h256()) {
+    return nullptr;
+  }
+
+  std::string rawAccountBase;
+  try {
+    shared_lock<shared_mutex> lock(m_mutexDBHandle);
+    const dev::GenericTrieDB<TraceableDB> t_state(&m_db, snapshot->GetRoot());
+    rawAccountBase =
+        t_state.at(DataConversion::StringToCharArray(address.hex()));
+  } catch (std::exception &e) {
+    // Nodes of a root that has since been superseded may already be purged
+    if (latest && GetReadSnapshot() != snapshot) {
+      return GetCommittedAccount(address);
+    }
+    LOG_GENERAL(WARNING, "Reading " << address << " at "
+                                    << snapshot->GetRoot().hex()
+                                    << " failed, " << e.what());
+    return nullptr;
+  }
+
+  if (rawAccountBase.empty()) {
+    return nullptr;
+  }
+
+  auto account = make_shared<Account>();
+  if (!account->DeserializeBase(
+          zbytes(rawAccountBase.begin(), rawAccountBase.end()), 0)) {
+    LOG_GENERAL(WARNING, "Account::DeserializeBase failed");
+    return nullptr;
+  }
+
+  if (account->isContract()) {
+    account->SetAddress(address);
+  }
+
+  snapshot->Insert(address, account, ACCOUNT_READ_CACHE_SIZE);
+
+  return account;
+}
+
 void AccountStore::InitTemp() {
   lock_guard<mutex> g(m_mutexDelta);
 
   m_accountStoreTemp.Init();
   m_stateDeltaSerialized.clear();
+  m_speculativeResults.clear();
 
   ContractStorage::GetContractStorage().InitTempState();
 }
@@ -260,17 +354,24 @@ AccountStore &AccountStore::GetInstance() {
   return accountstore;
 }
 
+dev::h256 AccountStore::GetSerializeRootLocked() const {
+  // A lookup serves the state of the last block it fully committed
+  if (LOOKUP_NODE_MODE && m_prevRoot != dev::h256()) {
+    return m_prevRoot;
+  }
+  return m_state.root();
+}
+
 bool AccountStore::Serialize(zbytes &dst, unsigned int offset) const {
   LOG_MARKER();
   shared_lock<shared_timed_mutex> lock(m_mutexPrimary);
   std::lock_guard<std::mutex> g(m_mutexTrie);
-  if (LOOKUP_NODE_MODE) {
-    if (m_prevRoot != dev::h256()) {
-      try {
-        m_state.setRoot(m_prevRoot);
-      } catch (...) {
-        return false;
-      }
+  const auto root = GetSerializeRootLocked();
+  if (root != m_state.root()) {
+    try {
+      m_state.setRoot(root);
+    } catch (...) {
+      return false;
     }
   }
   if (!MessengerAccountStoreTrie::SetAccountStoreTrie(
@@ -282,6 +383,45 @@ bool AccountStore::Serialize(zbytes &dst, unsigned int offset) const {
   return true;
 }
 
+bool AccountStore::SerializeSnapshot(zbytes &dst, dev::h256 &stateRoot) {
+  LOG_MARKER();
+
+  // Only pin the root and the contract states committed with it; the walk
+  // below then runs without holding up the next block
+  shared_ptr<const ContractStorage::CommittedState> committedStates;
+  {
+    shared_lock<shared_timed_mutex> lock(m_mutexPrimary);
+    std::lock_guard<std::mutex> g(m_mutexTrie);
+    stateRoot = GetSerializeRootLocked();
+    committedStates =
+        ContractStorage::GetContractStorage().GetCommittedState();
+  }
+  if (!committedStates) {
+    LOG_GENERAL(WARNING, "No committed contract states to serialize");
+    return false;
+  }
+
+  try {
+    shared_lock<shared_mutex> lock(m_mutexDBHandle);
+    const dev::GenericTrieDB<TraceableDB> t_state(&m_db, stateRoot);
+    // Every account is read back from the trie at the pinned root
+    if (!MessengerAccountStoreTrie::SetAccountStoreTrie(
+            dst, 0, t_state, make_shared<unordered_map<Address, Account>>(),
+            committedStates.get())) {
+      LOG_GENERAL(WARNING, "Messenger::SetAccountStoreTrie failed.");
+      return false;
+    }
+  } catch (std::exception &e) {
+    // Nodes of a superseded root may be purged while walking it
+    LOG_GENERAL(WARNING, "Serializing the state at " << stateRoot.hex()
+                                                     << " failed, "
+                                                     << e.what());
+    return false;
+  }
+
+  return true;
+}
+
 bool AccountStore::Deserialize(const zbytes &src, unsigned int offset) {
   LOG_MARKER();
 
@@ -293,6 +433,8 @@ bool AccountStore::Deserialize(const zbytes &src, unsigned int offset) {
     LOG_GENERAL(WARNING, "Messenger::GetAccountStore failed.");
     return false;
   }
+  ContractStorage::GetContractStorage().PublishCommittedState();
+  PublishReadSnapshot(false);
 
   m_prevRoot = GetStateRootHash();
 
@@ -310,6 +452,8 @@ bool AccountStore::Deserialize(const string &src, unsigned int offset) {
     LOG_GENERAL(WARNING, "Messenger::GetAccountStore failed.");
     return false;
   }
+  ContractStorage::GetContractStorage().PublishCommittedState();
+  PublishReadSnapshot(false);
 
   return true;
 }
@@ -365,6 +509,10 @@ bool AccountStore::DeserializeDelta(const zbytes &src, unsigned int offset,
       LOG_GENERAL(WARNING, "Messenger::GetAccountStoreDelta failed.");
       return false;
     }
+    // Published under the primary lock so RPC readers never pair new
+    // balances with old contract state
+    ContractStorage::GetContractStorage().PublishCommittedState();
+    PublishReadSnapshot();
   } else {
     unique_lock<shared_timed_mutex> g(m_mutexPrimary);
 
@@ -373,6 +521,8 @@ bool AccountStore::DeserializeDelta(const zbytes &src, unsigned int offset,
       LOG_GENERAL(WARNING, "Messenger::GetAccountStoreDelta failed.");
       return false;
     }
+    ContractStorage::GetContractStorage().PublishCommittedState();
+    PublishReadSnapshot();
   }
 
   m_prevRoot = GetStateRootHash();
@@ -411,12 +561,13 @@ bool AccountStore::MoveUpdatesToDisk(uint64_t dsBlockNum) {
               .GetContractCode(i.first)
               .empty()) {
         code_batch.insert({i.first.hex(), DataConversion::CharArrayToString(
-                                              i.second.GetCode())});
+                                              *i.second.GetCodeBlob())});
       }
 
       if (ContractStorage::GetContractStorage().GetInitData(i.first).empty()) {
-        initdata_batch.insert({i.first.hex(), DataConversion::CharArrayToString(
-                                                  i.second.GetInitData())});
+        initdata_batch.insert(
+            {i.first.hex(), DataConversion::CharArrayToString(
+                                *i.second.GetInitDataBlob())});
       }
     }
   }
@@ -453,8 +604,12 @@ bool AccountStore::MoveUpdatesToDisk(uint64_t dsBlockNum) {
 
   try {
     lock_guard<mutex> g(m_mutexTrie);
-    if (!m_state.db()->commit(dsBlockNum)) {
-      LOG_GENERAL(WARNING, "LevelDB commit failed");
+    {
+      // The commit reopens the state LevelDB; keep snapshot reads out
+      unique_lock<shared_mutex> g2(m_mutexDBHandle);
+      if (!m_state.db()->commit(dsBlockNum)) {
+        LOG_GENERAL(WARNING, "LevelDB commit failed");
+      }
     }
 
     if (!MoveRootToDisk(m_state.root())) {
@@ -529,6 +684,7 @@ bool AccountStore::RetrieveFromDisk() {
                              << boost::diagnostic_information(e));
     return false;
   }
+  PublishReadSnapshot(false);
   return true;
 }
 
@@ -553,6 +709,22 @@ bool AccountStore::UpdateAccountsTemp(
 
   lock(g, g2);
 
+  if (!m_speculativeResults.empty()) {
+    auto it = m_speculativeResults.find(transaction.GetTranID());
+    if (it != m_speculativeResults.end()) {
+      SpeculativeTxnResult result = std::move(it->second);
+      m_speculativeResults.erase(it);
+      if (result.blockNum == blockNum && ApplySpeculativeResultTemp(result)) {
+        ++m_speculativeHits;
+        receipt = std::move(result.receipt);
+        error_code = result.errorCode;
+        return result.status;
+      }
+      // Something the transfer read has changed since; run it again.
+      ++m_speculativeMisses;
+    }
+  }
+
   bool isEvm{false};
 
   if (Transaction::GetTransactionType(transaction) ==
@@ -563,7 +735,7 @@ bool AccountStore::UpdateAccountsTemp(
     // simple transfer, it might actually be a call.
     Account *contractAccount = this->GetAccountTemp(transaction.GetToAddr());
     if (contractAccount != nullptr) {
-      isEvm = EvmUtils::isEvm(contractAccount->GetCode());
+      isEvm = EvmUtils::isEvm(*contractAccount->GetCodeBlob());
     }
   }
 
@@ -655,6 +827,154 @@ bool AccountStore::UpdateCoinbaseTemp(const Address &rewardee,
   // Should the nonce increase ??
 }
 
+const Account *AccountStore::PeekAccountTemp(const Address &address) {
+  const auto &tempAccounts = m_accountStoreTemp.GetAddressToAccount();
+  const auto it = tempAccounts->find(address);
+  if (it != tempAccounts->end()) {
+    return &it->second;
+  }
+  return GetAccount(address);
+}
+
+namespace {
+
+bool SameAccountState(const Account *current,
+                      const std::optional<Account> &expected) {
+  if (current == nullptr || !expected) {
+    return current == nullptr && !expected;
+  }
+  return current->GetBalance() == expected->GetBalance() &&
+         current->GetNonce() == expected->GetNonce() &&
+         current->GetStorageRoot() == expected->GetStorageRoot() &&
+         current->GetCodeHash() == expected->GetCodeHash();
+}
+
+}  // namespace
+
+bool AccountStore::ApplySpeculativeResultTemp(
+    const SpeculativeTxnResult &result) {
+  for (const auto &read : result.reads) {
+    if (!SameAccountState(PeekAccountTemp(read.first), read.second)) {
+      return false;
+    }
+  }
+  for (const auto &write : result.writes) {
+    if (write.second) {
+      m_accountStoreTemp.AddAccount(write.first, *write.second, true);
+    }
+  }
+  return true;
+}
+
+void AccountStore::SpeculateTransfersTemp(
+    const uint64_t &blockNum, const unsigned int &numShards, const bool &isDS,
+    const std::vector<std::vector<Transaction>> &senderGroups,
+    const TxnExtras &txnExtras) {
+  LOG_MARKER();
+
+  if (senderGroups.empty()) {
+    return;
+  }
+
+  // Copy every account the transfers may touch, so that the workers never
+  // reach into the shared stores.
+  AccountStoreView::Snapshot snapshot;
+  {
+    unique_lock<shared_timed_mutex> g(m_mutexPrimary, defer_lock);
+    unique_lock<mutex> g2(m_mutexDelta, defer_lock);
+    lock(g, g2);
+
+    m_speculativeResults.clear();
+    for (const auto &group : senderGroups) {
+      for (const auto &transaction : group) {
+        for (const auto &address :
+             {transaction.GetSenderAddr(), transaction.GetToAddr()}) {
+          if (snapshot.count(address) == 0) {
+            const Account *account = PeekAccountTemp(address);
+            snapshot.emplace(address, account != nullptr
+                                          ? std::optional<Account>(*account)
+                                          : std::nullopt);
+          }
+        }
+      }
+    }
+  }
+
+  const size_t numThreads = std::min<size_t>(
+      senderGroups.size(),
+      SPECULATIVE_TXN_EXECUTION_THREADS > 0
+          ? SPECULATIVE_TXN_EXECUTION_THREADS
+          : std::max(1u, std::thread::hardware_concurrency()));
+
+  std::vector<std::vector<std::pair<TxnHash, SpeculativeTxnResult>>> results(
+      numThreads);
+  std::atomic<size_t> nextGroup{0};
+
+  auto worker = [&](size_t index) {
+    try {
+      AccountStoreView view(snapshot);
+      for (size_t i = nextGroup++; i < senderGroups.size();
+           i = nextGroup++) {
+        for (const auto &transaction : senderGroups[i]) {
+          SpeculativeTxnResult result;
+          if (!view.Execute(blockNum, numShards, isDS, transaction,
+                            txnExtras, result)) {
+            // The sender's later nonces depend on this one.
+            break;
+          }
+          results[index].emplace_back(transaction.GetTranID(),
+                                      std::move(result));
+        }
+      }
+    } catch (const std::exception &e) {
+      // Whatever was not speculated is simply executed serially.
+      LOG_GENERAL(WARNING, "Speculative execution stopped: " << e.what());
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(numThreads - 1);
+  for (size_t i = 1; i < numThreads; ++i) {
+    threads.emplace_back(worker, i);
+  }
+  worker(0);
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  lock_guard<mutex> g(m_mutexDelta);
+  for (auto &workerResults : results) {
+    for (auto &entry : workerResults) {
+      m_speculativeResults.emplace(entry.first, std::move(entry.second));
+    }
+  }
+  LOG_GENERAL(INFO, "Speculatively executed " << m_speculativeResults.size()
+                                              << " transfers from "
+                                              << senderGroups.size()
+                                              << " senders on " << numThreads
+                                              << " threads");
+}
+
+void AccountStore::ClearSpeculativeResultsTemp() {
+  lock_guard<mutex> g(m_mutexDelta);
+  if (m_speculativeHits > 0 || m_speculativeMisses > 0 ||
+      !m_speculativeResults.empty()) {
+    LOG_GENERAL(INFO, "Speculative transfers reused: "
+                          << m_speculativeHits
+                          << " re-executed: " << m_speculativeMisses
+                          << " unused: " << m_speculativeResults.size());
+  }
+  m_speculativeResults.clear();
+  m_speculativeHits = 0;
+  m_speculativeMisses = 0;
+}
+
+void AccountStore::GetSpeculativeCountsTemp(size_t &hits, size_t &misses) {
+  lock_guard<mutex> g(m_mutexDelta);
+  hits = m_speculativeHits;
+  misses = m_speculativeMisses;
+}
+
 uint128_t AccountStore::GetNonceTemp(const Address &address) {
   lock_guard<mutex> g(m_mutexDelta);
 
@@ -718,6 +1038,7 @@ bool AccountStore::RevertCommitTemp() {
   }
 
   ContractStorage::GetContractStorage().RevertContractStates();
+  PublishReadSnapshot();
 
   return true;
 }
@@ -788,6 +1109,7 @@ bool AccountStore::UpdateStateTrie(const Address &address,
 
   std::lock_guard<std::mutex> g(m_mutexTrie);
   m_state.insert(DataConversion::StringToCharArray(address.hex()), rawBytes);
+  m_changedSinceReadSnapshot.insert(address);
 
   return true;
 }
@@ -797,6 +1119,7 @@ bool AccountStore::RemoveFromTrie(const Address &address) {
   std::lock_guard<std::mutex> g(m_mutexTrie);
 
   m_state.remove(DataConversion::StringToCharArray(address.hex()));
+  m_changedSinceReadSnapshot.insert(address);
 
   return true;
 }
@@ -814,7 +1137,7 @@ dev::h256 AccountStore::GetPrevRootHash() const {
 }
 
 bool AccountStore::UpdateStateTrieAll() {
-  std::lock_guard<std::mutex> g(m_mutexTrie);
+  std::unique_lock<std::mutex> g(m_mutexTrie);
   if (m_prevRoot != dev::h256()) {
     try {
       m_state.setRoot(m_prevRoot);
@@ -823,17 +1146,26 @@ bool AccountStore::UpdateStateTrieAll() {
       return false;
     }
   }
+  std::vector<std::pair<zbytes, zbytes>> entries;
+  entries.reserve(m_addressToAccount->size());
   for (auto const &entry : *(this->m_addressToAccount)) {
     zbytes rawBytes;
     if (!entry.second.SerializeBase(rawBytes, 0)) {
       LOG_GENERAL(WARNING, "Messenger::SetAccountBase failed");
       return false;
     }
-    m_state.insert(DataConversion::StringToCharArray(entry.first.hex()),
-                   rawBytes);
+    entries.emplace_back(DataConversion::StringToCharArray(entry.first.hex()),
+                         std::move(rawBytes));
   }
+  m_state.insertBatch(std::move(entries),
+                      STATE_TRIE_UPDATE_THREADS > 0
+                          ? STATE_TRIE_UPDATE_THREADS
+                          : std::max(1u, std::thread::hardware_concurrency()));
 
   m_prevRoot = m_state.root();
+  g.unlock();
+
+  PublishReadSnapshot(false);
 
   return true;
 }
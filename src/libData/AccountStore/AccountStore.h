@@ -23,8 +23,10 @@
 #include <set>
 #include <shared_mutex>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <Schnorr.h>
+#include "AccountReadSnapshot.h"
 #include "AccountStoreBase.h"
 #include "common/Constants.h"
 #include "common/Hashes.h"
@@ -35,6 +37,7 @@
 #include "libData/AccountData/TransactionReceipt.h"
 #include "libData/AccountStore/AccountStoreSC.h"
 #include "libData/AccountStore/AccountStoreTemp.h"
+#include "libData/AccountStore/AccountStoreView.h"
 #include "libData/DataStructures/TraceableDB.h"
 #include "libScilla/UnixDomainSocketServer.h"
 #include "libUtils/TxnExtras.h"
@@ -42,6 +45,7 @@
 #include "libMetrics/Api.h"
 
 class ScillaIPCServer;
+class ScillaIPCBinaryServer;
 
 class AccountStore : public AccountStoreBase {
   TraceableDB m_db;
@@ -65,32 +69,72 @@ class AccountStore : public AccountStoreBase {
   mutable std::shared_timed_mutex m_mutexPrimary;
   /// mutex used when manipulating with state delta
   std::mutex m_mutexDelta;
+  /// transfers executed ahead of the serial pass, guarded by m_mutexDelta
+  std::unordered_map<TxnHash, SpeculativeTxnResult> m_speculativeResults;
+  size_t m_speculativeHits{0};
+  size_t m_speculativeMisses{0};
   /// mutex related to revertibles
   std::mutex m_mutexRevertibles;
   /// buffer for the raw bytes of state delta serialized
   zbytes m_stateDeltaSerialized;
 
+  /// committed state last published for RPC reads
+  std::shared_ptr<const AccountReadSnapshot> m_readSnapshot;
+  mutable std::mutex m_mutexReadSnapshot;
+  /// accounts written to the trie since m_readSnapshot, guarded by
+  /// m_mutexTrie
+  std::unordered_set<Address> m_changedSinceReadSnapshot;
+  /// held exclusively while the state DB is reset or reopened, so that
+  /// snapshot reads never see a closed DB
+  mutable std::shared_mutex m_mutexDBHandle;
+
   /// Scilla IPC server related
   std::shared_ptr<ScillaIPCServer> m_scillaIPCServer;
 
   rpc::UnixDomainSocketServer m_scillaIPCServerConnector;
 
+  /// binary endpoint for state queries, served by m_scillaIPCServer
+  std::unique_ptr<ScillaIPCBinaryServer> m_scillaIPCBinaryServer;
+
   AccountStore();
   ~AccountStore();
 
   /// Store the trie root to leveldb
   bool MoveRootToDisk(const dev::h256& root);
 
+  /// Root that Serialize and SerializeSnapshot encode. Caller must hold
+  /// m_mutexPrimary and m_mutexTrie.
+  dev::h256 GetSerializeRootLocked() const;
+
   // From AccountStoreTrie
   bool UpdateStateTrie(const Address& address, const Account& account);
   bool RemoveFromTrie(const Address& address);
 
+  /// Returns the account as UpdateAccountsTemp would see it: from
+  /// AccountStoreTemp if present there, otherwise from the committed state.
+  /// Unlike GetAccountTemp it does not copy the account into the delta.
+  /// Caller must hold m_mutexDelta and m_mutexPrimary.
+  const Account* PeekAccountTemp(const Address& address);
+
+  /// Publishes the current trie root for RPC reads. Cached accounts that
+  /// did not change are carried over unless keepCache is false
+  void PublishReadSnapshot(bool keepCache = true);
+
+  /// Commits a speculative result if every account it read is still in the
+  /// same state. Caller must hold m_mutexDelta and m_mutexPrimary.
+  bool ApplySpeculativeResultTemp(const SpeculativeTxnResult& result);
+
  public:
   /// Returns the singleton AccountStore instance.
   static AccountStore& GetInstance();
 
   bool Serialize(zbytes& src, unsigned int offset) const override;
 
+  /// Serializes the full state together with the root it corresponds to.
+  /// Only pinning the root blocks the block path; the state is then read
+  /// from the trie at that root and the contract states committed with it
+  bool SerializeSnapshot(zbytes& dst, dev::h256& stateRoot);
+
   bool Deserialize(const zbytes& src, unsigned int offset) override;
 
   bool Deserialize(const std::string& src, unsigned int offset) override;
@@ -130,6 +174,16 @@ class AccountStore : public AccountStoreBase {
   Account* GetAccount(const Address& address) override;
   Account* GetAccount(const Address& address, bool resetRoot);
 
+  /// Returns the committed state last published for RPC reads
+  std::shared_ptr<const AccountReadSnapshot> GetReadSnapshot() const;
+
+  /// Reads an account as of the given snapshot, or the latest one if none is
+  /// given, without taking the primary lock. Returns nullptr if the account
+  /// does not exist there
+  std::shared_ptr<const Account> GetCommittedAccount(
+      const Address& address,
+      std::shared_ptr<const AccountReadSnapshot> snapshot = nullptr);
+
   /// Get the instance of an account from AccountStoreTemp
   /// [[[WARNING]]] Test utility function, don't use in core protocol
   Account* GetAccountTemp(const Address& address);
@@ -143,6 +197,24 @@ class AccountStore : public AccountStoreBase {
                           const TxnExtras& txnExtras,
                           TransactionReceipt& receipt, TxnStatus& error_code);
 
+  /// Executes plain transfers on worker threads, each sender's transactions
+  /// in nonce order against a private view of the temp state. The results
+  /// are picked up by UpdateAccountsTemp when the serial pass reaches each
+  /// transaction, provided the accounts it read have not changed since;
+  /// otherwise the transaction is executed again there. The temp state and
+  /// the receipts therefore match a purely serial run.
+  void SpeculateTransfersTemp(
+      const uint64_t& blockNum, const unsigned int& numShards,
+      const bool& isDS,
+      const std::vector<std::vector<Transaction>>& senderGroups,
+      const TxnExtras& txnExtras);
+
+  /// Drops speculative results that were not consumed.
+  void ClearSpeculativeResultsTemp();
+
+  /// Speculative results reused and re-executed since the last clear.
+  void GetSpeculativeCountsTemp(size_t& hits, size_t& misses);
+
   /// add account in AccountStoreTemp
   void AddAccountTemp(const Address& address, const Account& account) {
     std::lock_guard<std::mutex> g(m_mutexDelta);
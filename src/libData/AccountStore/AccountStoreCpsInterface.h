@@ -281,7 +281,7 @@ class AccountStoreCpsInterface : public libCps::CpsAccountStoreInterface {
     if (account == nullptr) {
       return false;
     }
-    return account->isContract() && EvmUtils::isEvm(account->GetCode());
+    return account->isContract() && EvmUtils::isEvm(*account->GetCodeBlob());
   }
 
  private:
@@ -91,11 +91,17 @@ Z_I64GAUGE &GetProcessorDSBNCounters() {
 }  // namespace local
 }  // namespace zil
 
-AccountStoreSC::AccountStoreSC() {
+AccountStoreSC::AccountStoreSC() : AccountStoreSC(true) {}
+
+AccountStoreSC::AccountStoreSC(bool registerMetrics) {
   Metrics::GetInstance();
   m_accountStoreAtomic = std::make_unique<AccountStoreAtomic>(*this);
   m_txnProcessTimeout = false;
 
+  if (!registerMetrics) {
+    return;
+  }
+
   zil::local::GetEvmLatencyCounter().SetCallback([this](auto &&result) {
     if (zil::local::GetEvmLatencyCounter().Enabled()) {
       if (m_stats.evmCall > 0) {
@@ -149,38 +155,49 @@ void AccountStoreSC::InvokeInterpreter(
     TransactionReceipt &receipt) {
   bool call_already_finished = false;
   std::chrono::system_clock::time_point tpStart = r_timer_start();
-  auto func2 = [this, &interprinterPrint, &invoke_type, &version, &is_library,
-                &available_gas, &balance,
-                &call_already_finished]() mutable -> void {
+  if (!m_scillaWorkspace) {
+    LOG_GENERAL(WARNING, "No Scilla workspace prepared");
+    ret = false;
+    return;
+  }
+  Json::Value request;
+  switch (invoke_type) {
+    case CHECKER:
+      request = ScillaUtils::GetContractCheckerJson(
+          *m_scillaWorkspace, m_root_w_version, is_library, available_gas);
+      break;
+    case RUNNER_CREATE:
+      request = ScillaUtils::GetCreateContractJson(
+          *m_scillaWorkspace, m_root_w_version, is_library, available_gas,
+          balance);
+      break;
+    case RUNNER_CALL:
+      request = ScillaUtils::GetCallContractJson(
+          *m_scillaWorkspace, m_root_w_version, available_gas, balance,
+          is_library);
+      break;
+    case DISAMBIGUATE:
+      request = ScillaUtils::GetDisambiguateJson(*m_scillaWorkspace);
+      break;
+  }
+  auto func2 = [this, &interprinterPrint, &invoke_type, &version,
+                &call_already_finished, workspace = m_scillaWorkspace,
+                request]() mutable -> void {
     switch (invoke_type) {
       case CHECKER:
-        if (!ScillaClient::GetInstance().CallChecker(
-                version,
-                ScillaUtils::GetContractCheckerJson(m_root_w_version,
-                                                    is_library, available_gas),
-                interprinterPrint)) {
+        if (!ScillaClient::GetInstance().CallChecker(version, request,
+                                                     interprinterPrint)) {
         }
         break;
       case RUNNER_CREATE:
-        if (!ScillaClient::GetInstance().CallRunner(
-                version,
-                ScillaUtils::GetCreateContractJson(m_root_w_version, is_library,
-                                                   available_gas, balance),
-                interprinterPrint)) {
-        }
-        break;
       case RUNNER_CALL:
-        if (!ScillaClient::GetInstance().CallRunner(
-                version,
-                ScillaUtils::GetCallContractJson(
-                    m_root_w_version, available_gas, balance, is_library),
-                interprinterPrint)) {
+        if (!ScillaClient::GetInstance().CallRunner(version, request,
+                                                    interprinterPrint)) {
         }
         break;
       case DISAMBIGUATE:
-        if (!ScillaClient::GetInstance().CallDisambiguate(
-                version, ScillaUtils::GetDisambiguateJson(),
-                interprinterPrint)) {
+        if (!ScillaClient::GetInstance().CallDisambiguate(version, request,
+                                                          interprinterPrint)) {
         }
         break;
     }
@@ -201,10 +218,16 @@ void AccountStoreSC::InvokeInterpreter(
   if (m_txnProcessTimeout) {
     LOG_GENERAL(WARNING, "Txn processing timeout!");
 
-    ScillaClient::GetInstance().CheckClient(version, true);
+    ScillaClient::GetInstance().ResetWorker(version, request);
     receipt.AddError(EXECUTE_CMD_TIMEOUT);
     ret = false;
   }
+  // The runner of a contract creation reads the files the checker just saw,
+  // any other invocation is done with its workspace. The worker thread keeps
+  // its own reference until it finishes.
+  if (invoke_type != CHECKER) {
+    m_scillaWorkspace.reset();
+  }
   if (METRICS_ENABLED(ACCOUNTSTORE_SCILLA)) {
     auto val = r_timer_end(tpStart);
     if (val > 0) m_stats.scillaCall = val;
@@ -522,6 +545,8 @@ bool AccountStoreSC::UpdateAccounts(
         gasRemained = std::min(transaction.GetGasLimitZil() - createGasPenalty,
                                gasRemained);
       }
+      // Also when the runner never got to use what the checker saw
+      m_scillaWorkspace.reset();
 
       // *************************************************************************
       // Summary
@@ -873,15 +898,6 @@ bool AccountStoreSC::PopulateExtlibsExports(
         return false;
       }
 
-      /// Check whether there are caches
-      std::string code_path = EXTLIB_FOLDER + '/' + libAddr.hex();
-      code_path += LIBRARY_CODE_EXTENSION;
-      std::string json_path = EXTLIB_FOLDER + '/' + libAddr.hex() + ".json";
-      if (std::filesystem::exists(code_path) &&
-          std::filesystem::exists(json_path)) {
-        continue;
-      }
-
       uint32_t ext_scilla_version;
       bool ext_is_lib = false;
       std::vector<Address> ext_extlibs;
@@ -924,9 +940,6 @@ bool AccountStoreSC::ExportCreateContractFiles(
         &extlibs_exports) {
   LOG_MARKER();
 
-  std::filesystem::remove_all("./" + SCILLA_FILES);
-  std::filesystem::create_directories("./" + SCILLA_FILES);
-
   if (!(std::filesystem::exists("./" + SCILLA_LOG))) {
     std::filesystem::create_directories("./" + SCILLA_LOG);
   }
@@ -936,53 +949,34 @@ bool AccountStoreSC::ExportCreateContractFiles(
     return false;
   }
 
+  m_scillaWorkspace = std::make_shared<ScillaWorkspace>();
+  if (!m_scillaWorkspace->IsReady()) {
+    LOG_GENERAL(WARNING, "Scilla workspace not available");
+    return false;
+  }
+
   try {
     // Scilla code
-    std::ofstream os(INPUT_CODE + (is_library ? LIBRARY_CODE_EXTENSION
-                                              : CONTRACT_FILE_EXTENSION));
-    os << DataConversion::CharArrayToString(contract.GetCode());
-    os.close();
+    if (!m_scillaWorkspace->ExportCode(
+            DataConversion::CharArrayToString(contract.GetCode()),
+            is_library)) {
+      LOG_GENERAL(WARNING, "Failed to export contract code");
+      return false;
+    }
 
-    ExportCommonFiles(os, contract, extlibs_exports);
+    return ExportCommonFiles(contract, extlibs_exports);
   } catch (const std::exception &e) {
     LOG_GENERAL(WARNING, "Exception caught: " << e.what());
     return false;
   }
-
-  return true;
 }
 
-void AccountStoreSC::ExportCommonFiles(
-    std::ofstream &os, const Account &contract,
+bool AccountStoreSC::ExportCommonFiles(
+    const Account &contract,
     const std::map<Address, std::pair<std::string, std::string>>
         &extlibs_exports) {
-  os.open(INIT_JSON);
-  if (LOG_SC) {
-    LOG_GENERAL(
-        INFO, "init data to export: "
-                  << DataConversion::CharArrayToString(contract.GetInitData()));
-  }
-  os << DataConversion::CharArrayToString(contract.GetInitData());
-  os.close();
-
-  for (const auto &extlib_export : extlibs_exports) {
-    std::string code_path =
-        EXTLIB_FOLDER + '/' + "0x" + extlib_export.first.hex();
-    code_path += LIBRARY_CODE_EXTENSION;
-    std::filesystem::remove(code_path);
-
-    os.open(code_path);
-    os << extlib_export.second.first;
-    os.close();
-
-    std::string init_path =
-        EXTLIB_FOLDER + '/' + "0x" + extlib_export.first.hex() + ".json";
-    std::filesystem::remove(init_path);
-
-    os.open(init_path);
-    os << extlib_export.second.second;
-    os.close();
-  }
+  return ScillaUtils::ExportCommonFiles(
+      *m_scillaWorkspace, contract.GetInitData(), extlibs_exports);
 }
 
 bool AccountStoreSC::ExportContractFiles(
@@ -992,9 +986,6 @@ bool AccountStoreSC::ExportContractFiles(
   LOG_MARKER();
   std::chrono::system_clock::time_point tpStart;
 
-  std::filesystem::remove_all("./" + SCILLA_FILES);
-  std::filesystem::create_directories("./" + SCILLA_FILES);
-
   if (!(std::filesystem::exists("./" + SCILLA_LOG))) {
     std::filesystem::create_directories("./" + SCILLA_LOG);
   }
@@ -1008,12 +999,18 @@ bool AccountStoreSC::ExportContractFiles(
     return false;
   }
 
+  m_scillaWorkspace = std::make_shared<ScillaWorkspace>();
+  if (!m_scillaWorkspace->IsReady()) {
+    LOG_GENERAL(WARNING, "Scilla workspace not available");
+    return false;
+  }
+
   try {
-    std::string scillaCodeExtension = CONTRACT_FILE_EXTENSION;
-    if (contract.IsLibrary()) {
-      scillaCodeExtension = LIBRARY_CODE_EXTENSION;
+    if (!CreateScillaCodeFiles(contract, extlibs_exports,
+                               contract.IsLibrary())) {
+      LOG_GENERAL(WARNING, "CreateScillaCodeFiles failed");
+      return false;
     }
-    CreateScillaCodeFiles(contract, extlibs_exports, scillaCodeExtension);
   } catch (const std::exception &e) {
     LOG_GENERAL(WARNING, "Exception caught: " << e.what());
     return false;
@@ -1025,18 +1022,20 @@ bool AccountStoreSC::ExportContractFiles(
   return true;
 }
 
-void AccountStoreSC::CreateScillaCodeFiles(
+bool AccountStoreSC::CreateScillaCodeFiles(
     Account &contract,
     const std::map<Address, std::pair<std::string, std::string>>
         &extlibs_exports,
-    const std::string &scillaCodeExtension) {
+    bool is_library) {
   LOG_MARKER();
   // Scilla code
-  std::ofstream os(INPUT_CODE + scillaCodeExtension);
-  os << DataConversion::CharArrayToString(contract.GetCode());
-  os.close();
+  if (!m_scillaWorkspace->ExportCode(
+          DataConversion::CharArrayToString(contract.GetCode()), is_library)) {
+    LOG_GENERAL(WARNING, "Failed to export contract code");
+    return false;
+  }
 
-  ExportCommonFiles(os, contract, extlibs_exports);
+  return ExportCommonFiles(contract, extlibs_exports);
 }
 
 bool AccountStoreSC::ExportCallContractFiles(
@@ -1065,7 +1064,10 @@ bool AccountStoreSC::ExportCallContractFiles(
     msgObj["_origin"] = prepend + m_originAddr.hex();
     msgObj["_amount"] = transaction.GetAmountQa().convert_to<std::string>();
 
-    JSONUtils::GetInstance().writeJsontoFile(INPUT_MESSAGE_JSON, msgObj);
+    if (!m_scillaWorkspace->ExportInputMessageJson(msgObj)) {
+      LOG_GENERAL(WARNING, "Failed to export message json");
+      return false;
+    }
   } catch (const std::exception &e) {
     LOG_GENERAL(WARNING, "Exception caught: " << e.what());
     return false;
@@ -1086,7 +1088,10 @@ bool AccountStoreSC::ExportCallContractFiles(
   }
 
   try {
-    JSONUtils::GetInstance().writeJsontoFile(INPUT_MESSAGE_JSON, contractData);
+    if (!m_scillaWorkspace->ExportInputMessageJson(contractData)) {
+      LOG_GENERAL(WARNING, "Failed to export message json");
+      return false;
+    }
   } catch (const std::exception &e) {
     LOG_GENERAL(WARNING, "Exception caught: " << e.what());
     return false;
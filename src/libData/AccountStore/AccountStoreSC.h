@@ -48,6 +48,7 @@ struct counter_t {
 };  // namespace zil
 
 class ScillaIPCServer;
+class ScillaWorkspace;
 
 class AccountStoreSC : public AccountStoreBase {
   friend class AccountStoreCpsInterface;
@@ -103,6 +104,9 @@ class AccountStoreSC : public AccountStoreBase {
   /// Scilla IPC server
   std::shared_ptr<ScillaIPCServer> m_scillaIPCServer;
 
+  /// files of the current interpreter invocation
+  std::shared_ptr<ScillaWorkspace> m_scillaWorkspace;
+
   /// A set of contract account address pending for storageroot updating
   std::set<Address> m_storageRootUpdateBuffer;
 
@@ -156,8 +160,8 @@ class AccountStoreSC : public AccountStoreBase {
 
   /// export files that ExportCreateContractFiles and ExportContractFiles
   /// both needs
-  void ExportCommonFiles(
-      std::ofstream &os, const Account &contract,
+  bool ExportCommonFiles(
+      const Account &contract,
       const std::map<Address, std::pair<std::string, std::string>>
           &extlibs_exports);
 
@@ -187,11 +191,11 @@ class AccountStoreSC : public AccountStoreBase {
                      bool &ret, TransactionReceipt &receipt,
                      evm::EvmResult &result);
 
-  void CreateScillaCodeFiles(
+  bool CreateScillaCodeFiles(
       Account &contract,
       const std::map<Address, std::pair<std::string, std::string>>
           &extlibs_exports,
-      const std::string &scillaCodeExtension);
+      bool is_library);
 
   /// Amount Transfer
   /// add amount transfer to the m_accountStoreAtomic
@@ -207,6 +211,9 @@ class AccountStoreSC : public AccountStoreBase {
 
  protected:
   AccountStoreSC();
+  /// registerMetrics is false for short-lived instances, whose metric
+  /// callbacks would otherwise outlive them.
+  explicit AccountStoreSC(bool registerMetrics);
 
   const uint64_t &getCurBlockNum() const { return m_curBlockNum; }
 
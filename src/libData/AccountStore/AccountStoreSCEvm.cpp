@@ -63,6 +63,29 @@ void AccountStoreSC::EvmCallRunner(const INVOKE_TYPE /*invoke_type*/,  //
 
   INC_CALLS(zil::local::GetEvmCallsCounter());
 
+  if (ENABLE_EVM_BINARY_TRANSPORT) {
+    switch (EvmClient::GetInstance().CallRunner(
+        args, result, std::chrono::seconds(EVM_RPC_TIMEOUT_SECONDS))) {
+      case EvmBinaryTransport::Status::OK:
+        INC_STATUS(zil::local::GetEvmCallsCounter(), "lock", "release-normal");
+        ret = true;
+        break;
+      case EvmBinaryTransport::Status::FAILED:
+        ret = false;
+        break;
+      case EvmBinaryTransport::Status::TIMEOUT:
+        LOG_GENERAL(WARNING, "Txn processing timeout!");
+        if (LAUNCH_EVM_DAEMON) {
+          EvmClient::GetInstance().Reset();
+        }
+        INC_STATUS(zil::local::GetEvmCallsCounter(), "lock", "release-timeout");
+        receipt.AddError(EXECUTE_CMD_TIMEOUT);
+        ret = false;
+        break;
+    }
+    return;
+  }
+
   //
   // create a worker to be executed in the async method
   const auto worker = [&args, &ret, &result,
@@ -344,8 +367,14 @@ bool AccountStoreSC::UpdateAccountsEvm(const uint64_t &blockNum,
   // eth_call in non-cps mode only
   if (!ENABLE_CPS && evmContext.GetDirect()) {
     evm::EvmResult res;
-    bool status = EvmClient::GetInstance().CallRunner(
-        EvmUtils::GetEvmCallJson(evmContext.GetEvmArgs()), res);
+    bool status =
+        ENABLE_EVM_BINARY_TRANSPORT
+            ? EvmClient::GetInstance().CallRunner(
+                  evmContext.GetEvmArgs(), res,
+                  std::chrono::seconds(EVM_RPC_TIMEOUT_SECONDS)) ==
+                  EvmBinaryTransport::Status::OK
+            : EvmClient::GetInstance().CallRunner(
+                  EvmUtils::GetEvmCallJson(evmContext.GetEvmArgs()), res);
     evmContext.SetEvmResult(res);
     return status;
   }
@@ -715,7 +744,7 @@ bool AccountStoreSC::UpdateAccountsEvm(const uint64_t &blockNum,
       m_curSenderAddr = fromAddr;
       m_curEdges = 0;
 
-      if (contractAccount->GetCode().empty()) {
+      if (contractAccount->GetCodeBlob()->empty()) {
         error_code = TxnStatus::NOT_PRESENT;
         auto constexpr str =
             "Trying to call a smart contract that has no code will fail";
@@ -762,7 +791,7 @@ bool AccountStoreSC::UpdateAccountsEvm(const uint64_t &blockNum,
         return false;
       }
 
-      evmContext.SetCode(contractAccount->GetCode());
+      evmContext.SetCode(*contractAccount->GetCodeBlob());
       // Give EVM only gas provided for code execution excluding constant fee
       evmContext.SetGasLimit(evmContext.GetTransaction().GetGasLimitEth() -
                              MIN_ETH_GAS);
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "AccountStoreView.h"
+
+AccountStoreView::AccountStoreView(const Snapshot& snapshot)
+    : AccountStoreSC(false), m_snapshot(snapshot) {}
+
+Account* AccountStoreView::GetAccount(const Address& address) {
+  Account* account = AccountStoreBase::GetAccount(address);
+  if (account == nullptr && m_touched.count(address) == 0) {
+    const auto it = m_snapshot.find(address);
+    if (it == m_snapshot.end()) {
+      m_escaped = true;
+      return nullptr;
+    }
+    if (it->second) {
+      account =
+          &m_addressToAccount->emplace(address, *it->second).first->second;
+    }
+  }
+
+  if (m_touched.insert(address).second) {
+    m_reads.emplace_back(address, account != nullptr
+                                      ? std::optional<Account>(*account)
+                                      : std::nullopt);
+  }
+  return account;
+}
+
+bool AccountStoreView::Execute(const uint64_t& blockNum,
+                               const unsigned int& numShards,
+                               const bool& isDS,
+                               const Transaction& transaction,
+                               const TxnExtras& txnExtras,
+                               SpeculativeTxnResult& result) {
+  m_reads.clear();
+  m_touched.clear();
+  m_escaped = false;
+
+  if (Transaction::GetTransactionType(transaction) !=
+      Transaction::NON_CONTRACT) {
+    return false;
+  }
+
+  // Mirrors the recipient lookup in AccountStore::UpdateAccountsTemp; a
+  // transfer to a contract is a call and is left to the serial pass.
+  const Account* toAccount = GetAccount(transaction.GetToAddr());
+  if (toAccount != nullptr && toAccount->isContract()) {
+    return false;
+  }
+
+  result.blockNum = blockNum;
+  result.receipt = TransactionReceipt();
+  result.receipt.SetEpochNum(blockNum);
+  result.status =
+      AccountStoreSC::UpdateAccounts(blockNum, numShards, isDS, transaction,
+                                     txnExtras, result.receipt, result.errorCode);
+  if (m_escaped) {
+    return false;
+  }
+
+  result.reads = std::move(m_reads);
+  result.writes.clear();
+  result.writes.reserve(result.reads.size());
+  for (const auto& read : result.reads) {
+    const Account* account = AccountStoreBase::GetAccount(read.first);
+    result.writes.emplace_back(read.first,
+                               account != nullptr
+                                   ? std::optional<Account>(*account)
+                                   : std::nullopt);
+  }
+  m_reads.clear();
+  return true;
+}
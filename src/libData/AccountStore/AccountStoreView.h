@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ZILLIQA_SRC_LIBDATA_ACCOUNTSTORE_ACCOUNTSTOREVIEW_H_
+#define ZILLIQA_SRC_LIBDATA_ACCOUNTSTORE_ACCOUNTSTOREVIEW_H_
+
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "AccountStoreSC.h"
+
+/// Result of running one transaction ahead of time against an
+/// AccountStoreView, kept until the serial pass reaches the same transaction.
+struct SpeculativeTxnResult {
+  using AccountStates = std::vector<std::pair<Address, std::optional<Account>>>;
+
+  uint64_t blockNum{0};
+  bool status{false};
+  TxnStatus errorCode{TxnStatus::NOT_PRESENT};
+  TransactionReceipt receipt;
+  /// Every account the transaction touched, as it was before (nullopt if the
+  /// account did not exist)...
+  AccountStates reads;
+  /// ...and as it was left afterwards.
+  AccountStates writes;
+};
+
+/// Private, single-threaded copy of the temp state used to execute plain
+/// transfers off the delta lock. Accounts are served from a snapshot taken
+/// under the lock; the first access of each account per transaction is
+/// recorded so the result can be validated before it is committed.
+class AccountStoreView : public AccountStoreSC {
+ public:
+  using Snapshot = std::unordered_map<Address, std::optional<Account>>;
+
+  explicit AccountStoreView(const Snapshot& snapshot);
+
+  Account* GetAccount(const Address& address) override;
+
+  /// Runs the transaction through the same path AccountStoreTemp uses.
+  /// Returns false if the result cannot be reused, e.g. because the
+  /// transaction is not a plain transfer or touched an account outside the
+  /// snapshot.
+  bool Execute(const uint64_t& blockNum, const unsigned int& numShards,
+               const bool& isDS, const Transaction& transaction,
+               const TxnExtras& txnExtras, SpeculativeTxnResult& result);
+
+ private:
+  const Snapshot& m_snapshot;
+  SpeculativeTxnResult::AccountStates m_reads;
+  std::unordered_set<Address> m_touched;
+  bool m_escaped{false};
+};
+
+#endif  // ZILLIQA_SRC_LIBDATA_ACCOUNTSTORE_ACCOUNTSTOREVIEW_H_
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "EvmBinaryTransport.h"
+
+#include <array>
+
+#include "libUtils/Logger.h"
+
+namespace {
+
+constexpr uint8_t RESPONSE_OK = 0;
+
+void EncodeLength(uint32_t length, std::array<uint8_t, 4>& out) {
+  out[0] = static_cast<uint8_t>(length >> 24);
+  out[1] = static_cast<uint8_t>(length >> 16);
+  out[2] = static_cast<uint8_t>(length >> 8);
+  out[3] = static_cast<uint8_t>(length);
+}
+
+uint32_t DecodeLength(const std::array<uint8_t, 4>& in) {
+  return (static_cast<uint32_t>(in[0]) << 24) |
+         (static_cast<uint32_t>(in[1]) << 16) |
+         (static_cast<uint32_t>(in[2]) << 8) | static_cast<uint32_t>(in[3]);
+}
+
+}  // namespace
+
+EvmBinaryTransport::EvmBinaryTransport(std::string socketPath,
+                                       size_t maxIdleConnections)
+    : m_socketPath(std::move(socketPath)),
+      m_maxIdleConnections(maxIdleConnections) {}
+
+EvmBinaryTransport::~EvmBinaryTransport() { Clear(); }
+
+void EvmBinaryTransport::Clear() {
+  std::lock_guard<std::mutex> g(m_mutexIdle);
+  m_idle.clear();
+}
+
+std::unique_ptr<EvmBinaryTransport::Connection> EvmBinaryTransport::Acquire() {
+  {
+    std::lock_guard<std::mutex> g(m_mutexIdle);
+    if (!m_idle.empty()) {
+      auto conn = std::move(m_idle.back());
+      m_idle.pop_back();
+      return conn;
+    }
+  }
+
+  auto conn = std::make_unique<Connection>();
+  boost::system::error_code ec;
+  conn->socket.connect(
+      boost::asio::local::stream_protocol::endpoint(m_socketPath), ec);
+  if (ec) {
+    LOG_GENERAL(WARNING, "Failed to connect to " << m_socketPath << ": "
+                                                 << ec.message());
+    return nullptr;
+  }
+  return conn;
+}
+
+void EvmBinaryTransport::Release(std::unique_ptr<Connection> conn) {
+  std::lock_guard<std::mutex> g(m_mutexIdle);
+  if (m_idle.size() < m_maxIdleConnections) {
+    m_idle.emplace_back(std::move(conn));
+  }
+}
+
+EvmBinaryTransport::Status EvmBinaryTransport::Call(
+    const std::string& request, std::string& response,
+    std::chrono::milliseconds deadline) {
+  if (request.size() > MAX_FRAME_SIZE) {
+    LOG_GENERAL(WARNING, "Request of " << request.size()
+                                       << " bytes exceeds the frame limit");
+    return Status::FAILED;
+  }
+
+  auto conn = Acquire();
+  if (!conn) {
+    return Status::FAILED;
+  }
+
+  std::array<uint8_t, 4> requestHeader;
+  EncodeLength(static_cast<uint32_t>(request.size()), requestHeader);
+  std::array<uint8_t, 4> responseHeader;
+  std::string frame;
+  boost::system::error_code error;
+  bool done = false;
+
+  const std::array<boost::asio::const_buffer, 2> requestBuffers{
+      boost::asio::buffer(requestHeader), boost::asio::buffer(request)};
+
+  auto onBody = [&](const boost::system::error_code& ec, size_t) {
+    error = ec;
+    done = true;
+  };
+  auto onHeader = [&](const boost::system::error_code& ec, size_t) {
+    if (ec) {
+      error = ec;
+      done = true;
+      return;
+    }
+    const uint32_t length = DecodeLength(responseHeader);
+    if (length == 0 || length > MAX_FRAME_SIZE) {
+      error = boost::asio::error::message_size;
+      done = true;
+      return;
+    }
+    frame.resize(length);
+    boost::asio::async_read(conn->socket, boost::asio::buffer(frame), onBody);
+  };
+  auto onWrite = [&](const boost::system::error_code& ec, size_t) {
+    if (ec) {
+      error = ec;
+      done = true;
+      return;
+    }
+    boost::asio::async_read(conn->socket,
+                            boost::asio::buffer(responseHeader), onHeader);
+  };
+
+  conn->ioContext.restart();
+  boost::asio::async_write(conn->socket, requestBuffers, onWrite);
+  conn->ioContext.run_for(deadline);
+
+  if (!done) {
+    // The connection is left mid-frame; close it so it is never reused.
+    LOG_GENERAL(WARNING, "Timed out waiting for evm-ds after "
+                             << deadline.count() << " ms");
+    return Status::TIMEOUT;
+  }
+  if (error) {
+    LOG_GENERAL(WARNING, "evm-ds binary call failed: " << error.message());
+    return Status::FAILED;
+  }
+
+  const bool ok = static_cast<uint8_t>(frame[0]) == RESPONSE_OK;
+  response.assign(frame, 1);
+  Release(std::move(conn));
+  return ok ? Status::OK : Status::FAILED;
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ZILLIQA_SRC_LIBDATA_ACCOUNTSTORE_SERVICES_EVM_EVMBINARYTRANSPORT_H_
+#define ZILLIQA_SRC_LIBDATA_ACCOUNTSTORE_SERVICES_EVM_EVMBINARYTRANSPORT_H_
+
+#include <boost/asio.hpp>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/*
+ * EvmBinaryTransport
+ * Pool of persistent unix socket connections to the binary endpoint of
+ * evm-ds. Each request is a u32 big-endian length followed by the serialized
+ * EvmArgs; each response is a u32 big-endian length followed by a status byte
+ * (0 = EvmResult bytes, 1 = UTF-8 error text) and the payload.
+ *
+ * A call runs on the calling thread and is bounded by its deadline; a
+ * connection that times out is closed rather than returned to the pool.
+ */
+
+class EvmBinaryTransport {
+ public:
+  enum class Status { OK, FAILED, TIMEOUT };
+
+  EvmBinaryTransport(std::string socketPath, size_t maxIdleConnections);
+  ~EvmBinaryTransport();
+
+  EvmBinaryTransport(const EvmBinaryTransport&) = delete;
+  EvmBinaryTransport& operator=(const EvmBinaryTransport&) = delete;
+
+  // Call
+  // Sends one framed request and waits for its response until the deadline.
+  // On FAILED, response holds the error reported by evm-ds (if any).
+  Status Call(const std::string& request, std::string& response,
+              std::chrono::milliseconds deadline);
+
+  // Clear
+  // Drops every idle connection, e.g. after evm-ds has been restarted.
+  void Clear();
+
+  static constexpr uint32_t MAX_FRAME_SIZE = 256 * 1024 * 1024;
+
+ private:
+  struct Connection {
+    boost::asio::io_context ioContext;
+    boost::asio::local::stream_protocol::socket socket{ioContext};
+  };
+
+  std::unique_ptr<Connection> Acquire();
+  void Release(std::unique_ptr<Connection> conn);
+
+  const std::string m_socketPath;
+  const size_t m_maxIdleConnections;
+  std::mutex m_mutexIdle;
+  std::vector<std::unique_ptr<Connection>> m_idle;
+};
+
+#endif  // ZILLIQA_SRC_LIBDATA_ACCOUNTSTORE_SERVICES_EVM_EVMBINARYTRANSPORT_H_
@@ -36,15 +36,31 @@ Z_I64METRIC& GetCallsCounter() {
 }
 
 const std::vector<std::string>& GetEvmDaemonArgs() {
-  static const std::vector<std::string> args = {"--socket",
-    EVM_SERVER_SOCKET_PATH,
-    "--zil-scaling-factor",
-    std::to_string(EVM_ZIL_SCALING_FACTOR),
-    "--log4rs",
-    EVM_LOG_CONFIG};
+  static const std::vector<std::string> args = [] {
+    std::vector<std::string> args = {"--socket",
+      EVM_SERVER_SOCKET_PATH,
+      "--zil-scaling-factor",
+      std::to_string(EVM_ZIL_SCALING_FACTOR),
+      "--log4rs",
+      EVM_LOG_CONFIG};
+    if (ENABLE_EVM_BINARY_TRANSPORT) {
+      args.emplace_back("--binary-socket");
+      args.emplace_back(EVM_SERVER_BINARY_SOCKET_PATH);
+    }
+    return args;
+  }();
   return args;
 }
 
+void AwaitSocket(const std::filesystem::path& socket_path) {
+  int counter{0};
+  while (not std::filesystem::exists(socket_path)) {
+    if ((counter++ % 10) == 0)
+      LOG_GENERAL(WARNING, "Awaiting Launch of the evm-ds daemon ");
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+}
+
 bool LaunchEvmDaemon(boost::process::child& child,
                      const std::string& binaryPath,
                      const std::string& socketPath) {
@@ -58,10 +74,16 @@ bool LaunchEvmDaemon(boost::process::child& child,
   std::filesystem::path socket_path(socketPath);
   boost::system::error_code ec;
 
-  if (std::filesystem::exists(socket_path)) {
-    std::filesystem::remove(socket_path, ec);
-    if (ec.failed()) {
-      TRACE_ERROR("Problem removing filesystem entry for socket ");
+  std::vector<std::filesystem::path> socket_paths{socket_path};
+  if (ENABLE_EVM_BINARY_TRANSPORT) {
+    socket_paths.emplace_back(EVM_SERVER_BINARY_SOCKET_PATH);
+  }
+  for (const auto& path : socket_paths) {
+    if (std::filesystem::exists(path)) {
+      std::filesystem::remove(path, ec);
+      if (ec.failed()) {
+        TRACE_ERROR("Problem removing filesystem entry for socket ");
+      }
     }
   }
   if (not std::filesystem::exists(bin_path)) {
@@ -82,11 +104,9 @@ bool LaunchEvmDaemon(boost::process::child& child,
     LOG_GENERAL(WARNING, "child is not valid " << thread_id);
     return false;
   }
-  int counter{0};
-  while (not std::filesystem::exists(socket_path)) {
-    if ((counter++ % 10) == 0)
-      LOG_GENERAL(WARNING, "Awaiting Launch of the evm-ds daemon ");
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  AwaitSocket(socket_path);
+  if (ENABLE_EVM_BINARY_TRANSPORT) {
+    AwaitSocket(EVM_SERVER_BINARY_SOCKET_PATH);
   }
   return true;
 }
@@ -156,6 +176,9 @@ void EvmClient::Reset() {
 
   Terminate(m_child, m_client);
   CleanupPreviousInstances();
+  if (m_binaryTransport) {
+    m_binaryTransport->Clear();
+  }
 }
 
 EvmClient::~EvmClient() { LOG_MARKER(); }
@@ -187,6 +210,11 @@ bool EvmClient::OpenServer() {
         std::make_unique<rpc::UnixDomainSocketClient>(EVM_SERVER_SOCKET_PATH);
     m_client = std::make_unique<jsonrpc::Client>(*m_connector,
                                                  jsonrpc::JSONRPC_CLIENT_V2);
+    if (ENABLE_EVM_BINARY_TRANSPORT) {
+      // A freshly launched daemon invalidates any pooled connection.
+      m_binaryTransport = std::make_shared<EvmBinaryTransport>(
+          EVM_SERVER_BINARY_SOCKET_PATH, EVM_CONNECTION_POOL_SIZE);
+    }
   } catch (...) {
     TRACE_ERROR("Unhandled Exception initialising client");
     GetCallsCounter().IncrementAttr(
@@ -231,3 +259,51 @@ bool EvmClient::CallRunner(const Json::Value& _json, evm::EvmResult& result) {
     return false;
   }
 }
+
+EvmBinaryTransport::Status EvmClient::CallRunner(
+    const evm::EvmArgs& args, evm::EvmResult& result,
+    std::chrono::milliseconds deadline) {
+  LOG_MARKER();
+  TRACE(zil::trace::FilterClass::DEMO);
+
+  std::shared_ptr<EvmBinaryTransport> transport;
+  {
+    // Only launching the daemon is serialised; calls themselves run
+    // concurrently, each on its own pooled connection.
+    std::lock_guard<std::mutex> g(m_mutexMain);
+    if (not m_binaryTransport || (LAUNCH_EVM_DAEMON && not m_child.running())) {
+      if (not EvmClient::OpenServer()) {
+        TRACE_ERROR("Failed to establish connection to evmd-ds");
+        return EvmBinaryTransport::Status::FAILED;
+      }
+    }
+    transport = m_binaryTransport;
+  }
+  if (not transport) {
+    TRACE_ERROR("Binary transport to evm-ds is not enabled");
+    return EvmBinaryTransport::Status::FAILED;
+  }
+
+  std::string request;
+  if (not args.SerializeToString(&request)) {
+    TRACE_ERROR("Failed to serialise EvmArgs");
+    return EvmBinaryTransport::Status::FAILED;
+  }
+
+  std::string response;
+  const auto status = transport->Call(request, response, deadline);
+  if (status == EvmBinaryTransport::Status::OK) {
+    if (not result.ParseFromString(response)) {
+      TRACE_ERROR("Failed to parse EvmResult from evm-ds");
+      return EvmBinaryTransport::Status::FAILED;
+    }
+    if (LOG_SC) {
+      LOG_GENERAL(INFO, "<============ Call EVM result: ");
+      EvmUtils::PrintDebugEvmResult(result);
+    }
+  } else if (status == EvmBinaryTransport::Status::FAILED &&
+             not response.empty()) {
+    LOG_GENERAL(WARNING, "evm-ds returned error: " << response);
+  }
+  return status;
+}
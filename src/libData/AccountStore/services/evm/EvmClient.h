@@ -24,6 +24,7 @@
 #include <memory>
 #include "common/Constants.h"
 #include "common/Singleton.h"
+#include "EvmBinaryTransport.h"
 #include "libScilla/UnixDomainSocketClient.h"
 #include "libUtils/Evm.pb.h"
 #include "libUtils/Logger.h"
@@ -61,6 +62,15 @@ class EvmClient : public Singleton<EvmClient> {
 
   virtual bool CallRunner(const Json::Value& _json, evm::EvmResult& result);
 
+  // CallRunner
+  // Runs the given arguments on the evm-ds binary endpoint over a pooled
+  // persistent connection, bounded by the deadline on the calling thread.
+  // Only used when ENABLE_EVM_BINARY_TRANSPORT is set.
+
+  virtual EvmBinaryTransport::Status CallRunner(
+      const evm::EvmArgs& args, evm::EvmResult& result,
+      std::chrono::milliseconds deadline);
+
  protected:
   // OpenServer
   //
@@ -70,6 +80,7 @@ class EvmClient : public Singleton<EvmClient> {
  private:
   std::unique_ptr<jsonrpc::Client> m_client;
   std::unique_ptr<rpc::UnixDomainSocketClient> m_connector;
+  std::shared_ptr<EvmBinaryTransport> m_binaryTransport;
   boost::process::child m_child;
   // In case we need to protect unsafe code in future.
   std::mutex m_mutexMain;
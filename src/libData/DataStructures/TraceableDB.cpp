@@ -113,7 +113,7 @@ bool TraceableDB::ExecutePurge(const uint64_t& dsBlockNum,
       }
     }
     if ((t_dsBlockNum + NUM_DS_EPOCHS_STATE_HISTORY < dsBlockNum) || purgeAll) {
-      m_levelDB.BatchDelete(toPurge);
+      deleteNodes(toPurge);
       m_purgeDB.DeleteKey(iter->key().ToString());
       // compact/cleanup for this key immediately.
       leveldb::Slice k(iter->key());
@@ -141,7 +141,7 @@ bool TraceableDB::ExecutePurge(const uint64_t& dsBlockNum,
 }
 
 bool TraceableDB::RefreshDB() {
-  return m_levelDB.RefreshDB() && m_purgeDB.RefreshDB();
+  return OverlayDB::RefreshDB() && m_purgeDB.RefreshDB();
 }
 
 void TraceableDB::DetachedExecutePurge() {
@@ -81,6 +81,11 @@ DirectoryService::DirectoryService(Mediator& mediator) : m_mediator(mediator) {
   if (!LOOKUP_NODE_MODE) {
     SetState(POW_SUBMISSION);
     cv_POWSubmission.notify_all();
+    m_powVerifyPool = std::make_unique<ThreadPool>(
+        POW_VERIFY_THREADS > 0
+            ? POW_VERIFY_THREADS
+            : std::max(std::thread::hardware_concurrency(), 1U),
+        "PoWVerify");
   }
   m_mode = IDLE;
   SetConsensusLeaderID(0);
@@ -90,7 +95,10 @@ DirectoryService::DirectoryService(Mediator& mediator) : m_mediator(mediator) {
   zil::local::variables.SetIsLeader(int(m_mode));
 }
 
-DirectoryService::~DirectoryService() {}
+DirectoryService::~DirectoryService() {
+  // Stop the verification workers before the state they touch goes away
+  m_powVerifyPool.reset();
+}
 
 void DirectoryService::StartSynchronization(bool clean) {
   if (LOOKUP_NODE_MODE) {
@@ -18,6 +18,9 @@
 #ifndef ZILLIQA_SRC_LIBDIRECTORYSERVICE_DIRECTORYSERVICE_H_
 #define ZILLIQA_SRC_LIBDIRECTORYSERVICE_DIRECTORYSERVICE_H_
 
+#include <functional>
+#include <set>
+
 #include "libBlockchain/Block.h"
 #include "libConsensus/Consensus.h"
 #include "libData/MiningData/DSPowSolution.h"
@@ -25,6 +28,7 @@
 #include "libNetwork/DataSender.h"
 #include "libNetwork/Executable.h"
 #include "libNetwork/ShardStruct.h"
+#include "libUtils/ThreadPool.h"
 #include "libUtils/TimeUtils.h"
 
 class Mediator;
@@ -213,6 +217,12 @@ class DirectoryService : public Executable {
   std::vector<DSPowSolution> m_powSolutions;
   std::mutex m_mutexPowSolution;
 
+  // pow solutions queued for or under verification, keyed by submitter and
+  // resulting hash so copies relayed by several DS members are verified once
+  std::set<std::pair<PubKey, std::string>> m_powVerifyInFlight;
+  std::mutex m_mutexPowVerifyInFlight;
+  std::unique_ptr<ThreadPool> m_powVerifyPool;
+
   const uint32_t RESHUFFLE_INTERVAL = 500;
 
   // Message handlers
@@ -226,6 +236,9 @@ class DirectoryService : public Executable {
       const zbytes& message, unsigned int offset, const Peer& from,
       [[gnu::unused]] const unsigned char& startByte);
   bool VerifyPoWSubmission(const DSPowSolution& sol);
+  bool ClaimPoWVerification(const DSPowSolution& sol);
+  void ReleasePoWVerification(const DSPowSolution& sol);
+  void QueuePoWVerification(const std::function<void()>& job);
 
   bool ProcessDSBlockConsensus(const zbytes& message, unsigned int offset,
                                const Peer& from,
@@ -273,8 +286,8 @@ class DirectoryService : public Executable {
                                    const Peer& submitterPeer);
 
   // For PoW submission counter
-  bool CheckPoWSubmissionExceedsLimitsForNode(const PubKey& key);
-  void UpdatePoWSubmissionCounterforNode(const PubKey& key);
+  bool ReservePoWSubmissionForNode(const PubKey& key);
+  void ReleasePoWSubmissionForNode(const PubKey& key);
   void ResetPoWSubmissionCounter();
   void ClearReputationOfNodeWithoutPoW();
   static void RemoveReputationOfNodeFailToJoin(
@@ -723,6 +736,16 @@ class DirectoryService : public Executable {
       unsigned int maxByzantineRemoved, DequeOfNode& dsComm,
       const std::map<PubKey, uint32_t>& dsMemberPerformance);
 
+  // PoW verification dispatch with no state access.
+  static bool ClaimPoWVerificationCore(
+      const DSPowSolution& sol, const MapOfPubKeyPoW& allPoWs,
+      std::set<std::pair<PubKey, std::string>>& inFlight);
+  static void QueuePoWVerificationCore(ThreadPool* pool,
+                                       unsigned int queueSize,
+                                       const std::function<void()>& job);
+  static bool ReservePoWSubmissionCore(std::map<PubKey, uint8_t>& counter,
+                                       const PubKey& key, unsigned int limit);
+
  private:
   static std::map<DirState, std::string> DirStateStrings;
 
@@ -30,6 +30,7 @@
 #include "libNetwork/Guard.h"
 #include "libNode/Node.h"
 #include "libPersistence/ContractStorage.h"
+#include "libPersistence/StateSnapshot.h"
 #include "libUtils/CommonUtils.h"
 #include "libUtils/DataConversion.h"
 #include "libUtils/DetachedFunction.h"
@@ -79,6 +80,8 @@ bool DirectoryService::StoreFinalBlockToDisk() {
     return true;
   }
 
+  auto writeTxn = BlockStorage::GetBlockStorage().BeginWriteTransaction();
+
   if (m_mediator.m_node->m_microblock != nullptr &&
       m_mediator.m_node->m_microblock->GetHeader().GetTxRootHash() !=
           TxnHash()) {
@@ -87,7 +90,7 @@ bool DirectoryService::StoreFinalBlockToDisk() {
                                       << *(m_mediator.m_node->m_microblock));
     zbytes body;
     m_mediator.m_node->m_microblock->Serialize(body, 0);
-    if (!BlockStorage::GetBlockStorage().PutMicroBlock(
+    if (!writeTxn.PutMicroBlock(
             m_mediator.m_node->m_microblock->GetBlockHash(),
             m_mediator.m_node->m_microblock->GetHeader().GetEpochNum(),
             m_mediator.m_node->m_microblock->GetHeader().GetShardId(), body)) {
@@ -119,20 +122,24 @@ bool DirectoryService::StoreFinalBlockToDisk() {
   zil::local::variables.SetMbInFinal(m_finalBlock->GetMicroBlockInfos().size());
   zbytes serializedTxBlock;
   m_finalBlock->Serialize(serializedTxBlock, 0);
-  if (!BlockStorage::GetBlockStorage().PutTxBlock(m_finalBlock->GetHeader(),
-                                                  serializedTxBlock)) {
+  if (!writeTxn.PutTxBlock(m_finalBlock->GetHeader(), serializedTxBlock)) {
     LOG_GENERAL(WARNING, "Failed to put microblock in persistence");
     return false;
   }
 
   zbytes stateDelta;
   AccountStore::GetInstance().GetSerializedDelta(stateDelta);
-  if (!BlockStorage::GetBlockStorage().PutStateDelta(
+  if (!writeTxn.PutStateDelta(
           m_mediator.m_txBlockChain.GetLastBlock().GetHeader().GetBlockNum(),
           stateDelta)) {
     LOG_GENERAL(WARNING, "Failed to put statedelta in persistence");
     return false;
   }
+
+  if (!writeTxn.Commit()) {
+    LOG_GENERAL(WARNING, "Failed to commit final block to persistence");
+    return false;
+  }
   return true;
 }
 
@@ -249,6 +256,9 @@ void DirectoryService::ProcessFinalBlockConsensusWhenDone() {
                                         .GetBlockNum() +
                                     1
                              << "] FINISH WRITE STATE TO DISK");
+        StateSnapshot::OnStateCommitted(
+            m_mediator.m_dsBlockChain.GetLastBlock().GetHeader().GetBlockNum(),
+            m_mediator.m_txBlockChain.GetLastBlock());
       }
       if (ENABLE_ACCOUNTS_POPULATING &&
           m_mediator.m_dsBlockChain.GetLastBlock().GetHeader().GetBlockNum() <
@@ -112,13 +112,26 @@ bool DirectoryService::ProcessPoWPacketSubmission(
   }
 
   LOG_GENERAL(INFO, "PoW solutions received in this packet: " << tmp.size());
+  unsigned int numSkipped = 0;
   for (auto& sol : tmp) {
     // No point processing the other solutions if DS Block consensus is starting
     if ((m_state == DSBLOCK_CONSENSUS_PREP) || (m_state == DSBLOCK_CONSENSUS)) {
       LOG_GENERAL(INFO, "Too late");
       break;
     }
-    VerifyPoWSubmission(sol);
+    if (!ClaimPoWVerification(sol)) {
+      ++numSkipped;
+      continue;
+    }
+    QueuePoWVerification([this, sol]() {
+      VerifyPoWSubmission(sol);
+      ReleasePoWVerification(sol);
+    });
+  }
+
+  if (numSkipped > 0) {
+    LOG_GENERAL(INFO, "PoW solutions already verified or being verified: "
+                          << numSkipped);
   }
 
   return true;
@@ -235,23 +248,79 @@ bool DirectoryService::ProcessPoWSubmission(
                         gasPrice, std::make_pair(govProposalId, govVoteValue),
                         signature);
 
-  if (VerifyPoWSubmission(powSoln)) {
-    std::unique_lock<std::mutex> lk(m_mutexPowSolution);
-    auto submittedNumber =
-        std::count_if(m_powSolutions.begin(), m_powSolutions.end(),
-                      [&submitterKey](const DSPowSolution& soln) {
-                        return submitterKey == soln.GetSubmitterKey();
-                      });
-    if (submittedNumber >= POW_SUBMISSION_LIMIT) {
-      LOG_EPOCH(WARNING, m_mediator.m_currentEpochNum,
-                "Node " << submitterKey
-                        << " submitted pow count already reach limit");
+  if (!ClaimPoWVerification(powSoln)) {
+    LOG_GENERAL(INFO, "PoW submission from " << submitterKey
+                                             << " is already verified");
+    return true;
+  }
+
+  QueuePoWVerification([this, powSoln]() {
+    if (VerifyPoWSubmission(powSoln)) {
+      const PubKey& submitterKey = powSoln.GetSubmitterKey();
+      std::unique_lock<std::mutex> lk(m_mutexPowSolution);
+      auto submittedNumber =
+          std::count_if(m_powSolutions.begin(), m_powSolutions.end(),
+                        [&submitterKey](const DSPowSolution& soln) {
+                          return submitterKey == soln.GetSubmitterKey();
+                        });
+      if (submittedNumber >= POW_SUBMISSION_LIMIT) {
+        LOG_EPOCH(WARNING, m_mediator.m_currentEpochNum,
+                  "Node " << submitterKey
+                          << " submitted pow count already reach limit");
+      } else {
+        m_powSolutions.emplace_back(powSoln);
+      }
+    }
+    ReleasePoWVerification(powSoln);
+  });
+
+  return true;
+}
+
+bool DirectoryService::ClaimPoWVerification(const DSPowSolution& sol) {
+  lock(m_mutexAllPOW, m_mutexPowVerifyInFlight);
+  lock_guard<mutex> g(m_mutexAllPOW, adopt_lock);
+  lock_guard<mutex> g2(m_mutexPowVerifyInFlight, adopt_lock);
+  return ClaimPoWVerificationCore(sol, m_allPoWs, m_powVerifyInFlight);
+}
+
+void DirectoryService::ReleasePoWVerification(const DSPowSolution& sol) {
+  lock_guard<mutex> g(m_mutexPowVerifyInFlight);
+  m_powVerifyInFlight.erase({sol.GetSubmitterKey(), sol.GetResultingHash()});
+}
+
+void DirectoryService::QueuePoWVerification(const std::function<void()>& job) {
+  QueuePoWVerificationCore(m_powVerifyPool.get(), POW_VERIFY_QUEUE_SIZE, job);
+}
+
+bool DirectoryService::ClaimPoWVerificationCore(
+    const DSPowSolution& sol, const MapOfPubKeyPoW& allPoWs,
+    std::set<std::pair<PubKey, std::string>>& inFlight) {
+  // An identical solution already accepted for this node cannot change
+  // anything, so don't spend an ethash verification on it
+  array<uint8_t, 32> resultingHashArr{};
+  if (DataConversion::HexStrToStdArray(sol.GetResultingHash(),
+                                       resultingHashArr)) {
+    auto it = allPoWs.find(sol.GetSubmitterKey());
+    if (it != allPoWs.end() && it->second.m_result == resultingHashArr) {
       return false;
     }
-    m_powSolutions.emplace_back(powSoln);
   }
 
-  return true;
+  return inFlight.emplace(sol.GetSubmitterKey(), sol.GetResultingHash())
+      .second;
+}
+
+void DirectoryService::QueuePoWVerificationCore(
+    ThreadPool* pool, unsigned int queueSize,
+    const std::function<void()>& job) {
+  // Once the backlog is full, verify on the receiving thread so that senders
+  // are slowed down rather than queued without bound
+  if (!pool || pool->GetJobsLeft() >= static_cast<int>(queueSize)) {
+    job();
+    return;
+  }
+  pool->AddJob(job);
 }
 
 bool DirectoryService::VerifyPoWSubmission(const DSPowSolution& sol) {
@@ -319,11 +388,6 @@ bool DirectoryService::VerifyPoWSubmission(const DSPowSolution& sol) {
   LOG_GENERAL(INFO, "GovProposalId  = " << to_string(govProposalId));
   LOG_GENERAL(INFO, "GovVoteValue   = " << to_string(govVoteValue));
 
-  if (CheckPoWSubmissionExceedsLimitsForNode(submitterPubKey)) {
-    LOG_GENERAL(WARNING, "Max PoW sent");
-    return false;
-  }
-
   // Define the PoW parameters
   array<unsigned char, 32> rand1 = m_mediator.m_dsBlockRand;
   array<unsigned char, 32> rand2 = m_mediator.m_txBlockRand;
@@ -371,12 +435,23 @@ bool DirectoryService::VerifyPoWSubmission(const DSPowSolution& sol) {
     }
   }
 
+  // Solutions of the same node may be verified by several workers at once,
+  // so a slot is taken before verifying and handed back unless recorded
+  if (!ReservePoWSubmissionForNode(submitterPubKey)) {
+    LOG_GENERAL(WARNING, "Max PoW sent");
+    return false;
+  }
+  bool recorded = false;
+
   // m_timespec = r_timer_start();
 
   auto headerHash = POW::GenHeaderHash(rand1, rand2, submitterPeer,
                                        submitterPubKey, lookupId, gasPrice);
-  bool result = POW::GetInstance().PoWVerify(
-      blockNumber, difficultyLevel, headerHash, nonce, resultingHash, mixHash);
+  // Verification workers share the epoch context held by POW rather than
+  // reconfiguring the client for every submission
+  auto epochContext = POW::GetInstance().GetLightEpochContext(blockNumber);
+  bool result = POW::PoWVerify(*epochContext, difficultyLevel, headerHash,
+                               nonce, resultingHash, mixHash);
 
   // LOG_GENERAL(INFO, "[POWSTAT] " << r_timer_end(m_timespec));
 
@@ -409,6 +484,7 @@ bool DirectoryService::VerifyPoWSubmission(const DSPowSolution& sol) {
         m_allPoWs[submitterPubKey] = soln;
       } else if (m_allPoWs[submitterPubKey].m_result == soln.m_result) {
         LOG_GENERAL(INFO, "Duplicated");
+        ReleasePoWSubmissionForNode(submitterPubKey);
         return true;
       }
 
@@ -424,7 +500,7 @@ bool DirectoryService::VerifyPoWSubmission(const DSPowSolution& sol) {
         AddDSPoWs(submitterPubKey, soln);
       }
 
-      UpdatePoWSubmissionCounterforNode(submitterPubKey);
+      recorded = true;
     }
   } else {
     string rand1Str, rand2Str;
@@ -437,6 +513,10 @@ bool DirectoryService::VerifyPoWSubmission(const DSPowSolution& sol) {
                           << " Rand1: " << rand1Str << " Rand2: " << rand2Str);
   }
 
+  if (!recorded) {
+    ReleasePoWSubmissionForNode(submitterPubKey);
+  }
+
   return result;
 }
 
@@ -463,25 +543,31 @@ bool DirectoryService::CheckSolnFromNonDSCommittee(
   return true;
 }
 
-bool DirectoryService::CheckPoWSubmissionExceedsLimitsForNode(
-    const PubKey& key) {
+bool DirectoryService::ReservePoWSubmissionForNode(const PubKey& key) {
   lock_guard<mutex> g(m_mutexAllPoWCounter);
-  if (m_AllPoWCounter.find(key) == m_AllPoWCounter.end()) {
-    return false;
-  } else if (m_AllPoWCounter[key] < POW_SUBMISSION_LIMIT) {
-    return false;
-  }
-  return true;
+  return ReservePoWSubmissionCore(m_AllPoWCounter, key, POW_SUBMISSION_LIMIT);
 }
 
-void DirectoryService::UpdatePoWSubmissionCounterforNode(const PubKey& key) {
+void DirectoryService::ReleasePoWSubmissionForNode(const PubKey& key) {
   lock_guard<mutex> g(m_mutexAllPoWCounter);
+  auto it = m_AllPoWCounter.find(key);
+  if (it == m_AllPoWCounter.end()) {
+    return;
+  }
+  if (--it->second == 0) {
+    m_AllPoWCounter.erase(it);
+  }
+}
 
-  if (m_AllPoWCounter.find(key) == m_AllPoWCounter.end()) {
-    m_AllPoWCounter.emplace(key, 1);
-  } else {
-    m_AllPoWCounter[key] = m_AllPoWCounter[key] + 1;
+bool DirectoryService::ReservePoWSubmissionCore(
+    std::map<PubKey, uint8_t>& counter, const PubKey& key,
+    unsigned int limit) {
+  auto& submitted = counter[key];
+  if (submitted >= limit) {
+    return false;
   }
+  ++submitted;
+  return true;
 }
 
 void DirectoryService::ResetPoWSubmissionCounter() {
@@ -334,6 +334,28 @@ Json::Value GetLogsFromReceipt(const TransactionReceipt &receipt) {
   return logs;
 }
 
+LogBloom BuildBloomForAddress(const Address &address) {
+  const auto addressHash =
+      ethash::keccak256(address.ref().data(), address.ref().size());
+  dev::h256 addressBloom{dev::zbytesConstRef{boost::begin(addressHash.bytes),
+                                             boost::size(addressHash.bytes)}};
+
+  LogBloom bloom;
+  bloom.shiftBloom<3>(addressBloom);
+  return bloom;
+}
+
+LogBloom BuildBloomForTopic(const dev::h256 &topic) {
+  const auto topicHash =
+      ethash::keccak256(topic.ref().data(), topic.ref().size());
+  dev::h256 topicBloom{dev::zbytesConstRef{boost::begin(topicHash.bytes),
+                                           boost::size(topicHash.bytes)}};
+
+  LogBloom bloom;
+  bloom.shiftBloom<3>(topicBloom);
+  return bloom;
+}
+
 LogBloom BuildBloomForLogObject(const Json::Value &logObject) {
   const std::string addressStr =
       logObject.get("address", Json::nullValue).asString();
@@ -345,26 +367,10 @@ LogBloom BuildBloomForLogObject(const Json::Value &logObject) {
   Address address{addressStr};
   const auto topicsArray = logObject.get("topics", Json::arrayValue);
 
-  std::vector<dev::h256> topics;
+  LogBloom bloom = BuildBloomForAddress(address);
 
   for (const auto &topic : topicsArray) {
-    topics.push_back(dev::h256{topic.asString()});
-  }
-
-  const auto addressHash =
-      ethash::keccak256(address.ref().data(), address.ref().size());
-  dev::h256 addressBloom{dev::zbytesConstRef{boost::begin(addressHash.bytes),
-                                             boost::size(addressHash.bytes)}};
-
-  LogBloom bloom;
-  bloom.shiftBloom<3>(addressBloom);
-
-  for (const auto &topic : topics) {
-    const auto topicHash =
-        ethash::keccak256(topic.ref().data(), topic.ref().size());
-    dev::h256 topicBloom{dev::zbytesConstRef{boost::begin(topicHash.bytes),
-                                             boost::size(topicHash.bytes)}};
-    bloom.shiftBloom<3>(topicBloom);
+    bloom |= BuildBloomForTopic(dev::h256{topic.asString()});
   }
 
   return bloom;
@@ -77,6 +77,8 @@ Json::Value GetBloomFromReceiptHex(const TransactionReceipt &receipt);
 
 Json::Value GetLogsFromReceipt(const TransactionReceipt &receipt);
 
+LogBloom BuildBloomForAddress(const Address &address);
+LogBloom BuildBloomForTopic(const dev::h256 &topic);
 LogBloom BuildBloomForLogObject(const Json::Value &logObject);
 LogBloom BuildBloomForLogs(const Json::Value &logsArray);
 uint32_t GetBaseLogIndexForReceiptInBlock(const TxnHash &txnHash,
@@ -18,8 +18,10 @@
 #include "BlocksCache.h"
 #include "FiltersImpl.h"
 #include "FiltersUtils.h"
+#include "LogIndex.h"
 #include "PendingTxnCache.h"
 #include "SubscriptionsImpl.h"
+#include "common/Constants.h"
 #include "libUtils/Logger.h"
 
 namespace evmproj {
@@ -90,10 +92,23 @@ class APICacheImpl : public APICache, public APICacheUpdate, public TxCache {
     return m_pendingTxnCache.GetPendingTxnsFilterChanges(after_counter, result);
   }
 
+  bool GetLogsFromIndex(const EventFilterParams& filter,
+                        EpochNumber latest_epoch, PollResult& result) override {
+    if (!LOOKUP_NODE_MODE || !ENABLE_EVENT_LOG_INDEX) {
+      return false;
+    }
+    m_logIndex.GetLogs(filter, latest_epoch, GET_LOGS_MAX_RESULTS, result);
+    return true;
+  }
+
   void EpochFinalized(const BlocksCache::EpochMetadata& meta) {
     uint64_t epoch = meta.epoch;
     LOG_GENERAL(INFO, "Finalized epoch " << epoch);
 
+    if (LOOKUP_NODE_MODE && ENABLE_EVENT_LOG_INDEX) {
+      m_logIndex.EpochFinalized(meta);
+    }
+
     m_subscriptions.OnNewHead(meta.blockHash);
     for (const auto& event : meta.meta) {
       m_subscriptions.OnEventLog(event.address, event.topics, event.response);
@@ -107,6 +122,7 @@ class APICacheImpl : public APICache, public APICacheUpdate, public TxCache {
   SubscriptionsImpl m_subscriptions;
   PendingTxnCache m_pendingTxnCache;
   BlocksCache m_blocksCache;
+  LogIndex m_logIndex;
 };
 
 std::shared_ptr<APICache> APICache::Create() {
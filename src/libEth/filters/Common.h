@@ -75,6 +75,12 @@ class TxCache {
 
   virtual EpochNumber GetPendingTxnsFilterChanges(EpochNumber after_counter,
                                                   PollResult &result) = 0;
+
+  /// Answers eth_getLogs from the persistent log index. Returns false if the
+  /// index is not available on this node
+  virtual bool GetLogsFromIndex(const EventFilterParams &filter,
+                                EpochNumber latest_epoch,
+                                PollResult &result) = 0;
 };
 
 }  // namespace filters
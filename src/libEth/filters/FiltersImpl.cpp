@@ -316,6 +316,15 @@ PollResult FilterAPIBackendImpl::GetLogs(const Json::Value &params) {
     return ret;
   }
 
+  // Ranges starting before the cached epochs are served from the persistent
+  // log index, if this node keeps one
+  bool beforeCache =
+      filter.fromBlock == EARLIEST_EPOCH ||
+      (filter.fromBlock >= 0 && filter.fromBlock < m_earliestEpoch);
+  if (beforeCache && m_cache.GetLogsFromIndex(filter, m_latestEpoch, ret)) {
+    return ret;
+  }
+
   std::ignore = m_cache.GetEventFilterChanges(SEEN_NOTHING, filter, ret);
 
   return ret;
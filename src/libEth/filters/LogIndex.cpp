@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+
+#include "LogIndex.h"
+
+#include "FiltersUtils.h"
+#include "common/Constants.h"
+#include "libEth/Eth.h"
+#include "libPersistence/BlockStorage.h"
+#include "libUtils/Logger.h"
+
+namespace evmproj {
+namespace filters {
+
+namespace {
+
+/// Blooms of the filter criteria. A bloom may hold a matching log only if it
+/// contains one of the addresses and, for every constrained topic position,
+/// one of the topic variants
+struct FilterBlooms {
+  std::vector<Eth::LogBloom> addresses;
+  std::vector<std::vector<Eth::LogBloom>> topics;
+
+  explicit FilterBlooms(const EventFilterParams &filter) {
+    for (const auto &address : filter.address) {
+      addresses.emplace_back(Eth::BuildBloomForAddress(::Address{address}));
+    }
+    for (const auto &variants : filter.topicMatches) {
+      if (variants.empty()) {
+        continue;
+      }
+      auto &blooms = topics.emplace_back();
+      for (const auto &topic : variants) {
+        blooms.emplace_back(Eth::BuildBloomForTopic(dev::h256{topic}));
+      }
+    }
+  }
+
+  bool MayMatch(const Eth::LogBloom &bloom) const {
+    auto containsAny = [&bloom](const std::vector<Eth::LogBloom> &variants) {
+      return variants.empty() ||
+             std::any_of(variants.begin(), variants.end(),
+                         [&bloom](const auto &b) { return bloom.contains(b); });
+    };
+    return containsAny(addresses) &&
+           std::all_of(topics.begin(), topics.end(), containsAny);
+  }
+};
+
+EpochNumber ResolveEpoch(EpochNumber epoch, EpochNumber latest_epoch) {
+  if (epoch == EARLIEST_EPOCH) {
+    return 0;
+  }
+  if (epoch < 0) {
+    return latest_epoch;
+  }
+  return std::min(epoch, latest_epoch);
+}
+
+}  // namespace
+
+void LogIndex::EpochFinalized(const BlocksCache::EpochMetadata &meta) {
+  if (meta.meta.empty() || meta.epoch < 0) {
+    return;
+  }
+
+  Eth::LogBloom bloom;
+  Json::Value logs(Json::arrayValue);
+  for (const auto &event : meta.meta) {
+    bloom |= Eth::BuildBloomForLogObject(event.response);
+    logs.append(event.response);
+  }
+
+  if (!BlockStorage::GetBlockStorage().PutEventLogs(meta.epoch, bloom,
+                                                    JsonWrite(logs))) {
+    LOG_GENERAL(WARNING, "Cannot index event logs of epoch " << meta.epoch);
+  }
+}
+
+EpochNumber LogIndex::Scan(const EventFilterParams &filter,
+                           EpochNumber from_epoch, EpochNumber to_epoch,
+                           const OnLog &onLog) {
+  const FilterBlooms blooms(filter);
+  const auto sectionSize = static_cast<EpochNumber>(
+      std::max<uint64_t>(EVENT_LOG_INDEX_SECTION_SIZE, 1));
+
+  auto &storage = BlockStorage::GetBlockStorage();
+
+  Eth::LogBloom bloom;
+  std::string logs;
+  std::string error;
+  std::vector<Quantity> topics;
+
+  EpochNumber epoch = std::max<EpochNumber>(from_epoch, 0);
+  while (epoch <= to_epoch) {
+    const EpochNumber section = epoch / sectionSize;
+    const EpochNumber sectionEnd =
+        std::min(to_epoch, (section + 1) * sectionSize - 1);
+
+    if (!storage.GetEventLogsSectionBloom(section, bloom) ||
+        !blooms.MayMatch(bloom)) {
+      epoch = sectionEnd + 1;
+      continue;
+    }
+
+    for (; epoch <= sectionEnd; ++epoch) {
+      if (!storage.GetEventLogsBloom(epoch, bloom) || !blooms.MayMatch(bloom) ||
+          !storage.GetEventLogs(epoch, logs)) {
+        continue;
+      }
+
+      auto items = JsonRead(logs, error);
+      if (!error.empty() || !items.isArray()) {
+        LOG_GENERAL(WARNING,
+                    "Corrupted event logs of epoch " << epoch << ": " << error);
+        continue;
+      }
+
+      for (const auto &item : items) {
+        topics.clear();
+        for (const auto &topic : item[TOPICS_STR]) {
+          topics.emplace_back(topic.asString());
+        }
+        if (!Match(filter, item[ADDRESS_STR].asString(), topics)) {
+          continue;
+        }
+        if (!onLog(epoch, item)) {
+          return epoch - 1;
+        }
+      }
+    }
+  }
+
+  return to_epoch;
+}
+
+void LogIndex::GetLogs(const EventFilterParams &filter,
+                       EpochNumber latest_epoch, size_t max_results,
+                       PollResult &result) {
+  result.result = Json::Value(Json::arrayValue);
+
+  if (filter.fromBlock > latest_epoch) {
+    result.error = "Block " + NumberAsString(filter.fromBlock) +
+                   " is after the latest block " +
+                   NumberAsString(latest_epoch);
+    return;
+  }
+
+  const auto from_epoch = ResolveEpoch(filter.fromBlock, latest_epoch);
+  const auto to_epoch = ResolveEpoch(filter.toBlock, latest_epoch);
+  if (from_epoch > to_epoch) {
+    result.error = "Invalid block range [" + NumberAsString(from_epoch) +
+                   ", " + NumberAsString(to_epoch) + "]";
+    return;
+  }
+
+  const auto last_epoch = Scan(
+      filter, from_epoch, to_epoch,
+      [&result, max_results](EpochNumber, const Json::Value &log) {
+        if (result.result.size() >= max_results) {
+          return false;
+        }
+        result.result.append(log);
+        return true;
+      });
+
+  if (last_epoch < to_epoch) {
+    result.result = Json::Value(Json::arrayValue);
+    result.error =
+        "Query returned more than " + std::to_string(max_results) + " results";
+    if (last_epoch >= from_epoch) {
+      result.error += ". Try with this block range [" +
+                      NumberAsString(from_epoch) + ", " +
+                      NumberAsString(last_epoch) + "]";
+    }
+    return;
+  }
+
+  result.success = true;
+}
+
+}  // namespace filters
+}  // namespace evmproj
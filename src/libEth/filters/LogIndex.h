@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ZILLIQA_SRC_LIBETH_FILTERS_LOGINDEX_H_
+#define ZILLIQA_SRC_LIBETH_FILTERS_LOGINDEX_H_
+
+#include <functional>
+
+#include "BlocksCache.h"
+
+namespace evmproj {
+namespace filters {
+
+/// Persistent event log index on top of BlockStorage. Each finalized epoch
+/// with logs is stored together with a bloom over its addresses and topics,
+/// and blooms are also merged per section of EVENT_LOG_INDEX_SECTION_SIZE
+/// epochs, so that range queries skip whole sections without reading them.
+class LogIndex {
+ public:
+  /// Called for every matching log in epoch order, returns false to stop
+  using OnLog =
+      std::function<bool(EpochNumber epoch, const Json::Value &log)>;
+
+  /// Stores the logs of a finalized epoch
+  void EpochFinalized(const BlocksCache::EpochMetadata &meta);
+
+  /// Passes every log in [from_epoch, to_epoch] matching the filter to the
+  /// callback. Returns the last epoch scanned completely
+  EpochNumber Scan(const EventFilterParams &filter, EpochNumber from_epoch,
+                   EpochNumber to_epoch, const OnLog &onLog);
+
+  /// eth_getLogs over the index. At most max_results logs are returned: if
+  /// the range holds more, the result is an error telling the caller up to
+  /// which epoch the query fits, so that it can be continued page by page.
+  /// A range starting after latest_epoch or after its own end is an error,
+  /// one ending after latest_epoch is clamped to it
+  void GetLogs(const EventFilterParams &filter, EpochNumber latest_epoch,
+               size_t max_results, PollResult &result);
+};
+
+}  // namespace filters
+}  // namespace evmproj
+
+#endif  // ZILLIQA_SRC_LIBETH_FILTERS_LOGINDEX_H_
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "SubscriptionIndex.h"
+
+#include <boost/algorithm/string.hpp>
+
+#include "FiltersUtils.h"
+
+namespace evmproj {
+namespace filters {
+
+namespace {
+
+void EraseFromBucket(
+    std::unordered_map<std::string, std::unordered_set<std::string>>& buckets,
+    const std::string& key, const std::string& id) {
+  auto it = buckets.find(key);
+  if (it == buckets.end()) {
+    return;
+  }
+  it->second.erase(id);
+  if (it->second.empty()) {
+    buckets.erase(it);
+  }
+}
+
+bool HasFirstTopic(const EventFilterParams& filter) {
+  return !filter.topicMatches.empty() && !filter.topicMatches[0].empty();
+}
+
+}  // namespace
+
+void SubscriptionIndex::Add(const SubscriptionId& id,
+                            EventFilterParams filter) {
+  Remove(id);
+
+  if (!filter.address.empty()) {
+    for (const auto& address : filter.address) {
+      m_byAddress[boost::to_lower_copy(address)].insert(id);
+    }
+  } else if (HasFirstTopic(filter)) {
+    for (const auto& topic : filter.topicMatches[0]) {
+      m_byFirstTopic[boost::to_lower_copy(topic)].insert(id);
+    }
+  } else {
+    m_wildcards.insert(id);
+  }
+
+  m_filters.emplace(id, std::move(filter));
+}
+
+bool SubscriptionIndex::Remove(const SubscriptionId& id) {
+  auto it = m_filters.find(id);
+  if (it == m_filters.end()) {
+    return false;
+  }
+  Unindex(id, it->second);
+  m_filters.erase(it);
+  return true;
+}
+
+void SubscriptionIndex::Unindex(const SubscriptionId& id,
+                                const EventFilterParams& filter) {
+  if (!filter.address.empty()) {
+    for (const auto& address : filter.address) {
+      EraseFromBucket(m_byAddress, boost::to_lower_copy(address), id);
+    }
+  } else if (HasFirstTopic(filter)) {
+    for (const auto& topic : filter.topicMatches[0]) {
+      EraseFromBucket(m_byFirstTopic, boost::to_lower_copy(topic), id);
+    }
+  } else {
+    m_wildcards.erase(id);
+  }
+}
+
+std::vector<SubscriptionIndex::SubscriptionId> SubscriptionIndex::Find(
+    const Address& address, const std::vector<Quantity>& topics) const {
+  std::vector<SubscriptionId> result;
+
+  auto check = [&](const Bucket& bucket) {
+    for (const auto& id : bucket) {
+      auto it = m_filters.find(id);
+      if (it != m_filters.end() && Match(it->second, address, topics)) {
+        result.push_back(id);
+      }
+    }
+  };
+
+  auto it = m_byAddress.find(boost::to_lower_copy(address));
+  if (it != m_byAddress.end()) {
+    check(it->second);
+  }
+
+  if (!topics.empty()) {
+    auto topicIt = m_byFirstTopic.find(boost::to_lower_copy(topics[0]));
+    if (topicIt != m_byFirstTopic.end()) {
+      check(topicIt->second);
+    }
+  } else {
+    // Match() accepts events with fewer topics than the filter has
+    // positions, so every topic bucket applies to an event without topics.
+    // A subscription may sit in several of them
+    Bucket all;
+    for (const auto& bucket : m_byFirstTopic) {
+      all.insert(bucket.second.begin(), bucket.second.end());
+    }
+    check(all);
+  }
+
+  check(m_wildcards);
+
+  return result;
+}
+
+}  // namespace filters
+}  // namespace evmproj
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ZILLIQA_SRC_LIBETH_FILTERS_SUBSCRIPTIONINDEX_H_
+#define ZILLIQA_SRC_LIBETH_FILTERS_SUBSCRIPTIONINDEX_H_
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Common.h"
+
+namespace evmproj {
+namespace filters {
+
+/// Inverted index over eth_subscribe("logs") filters. Filters naming
+/// addresses are keyed by address, the rest by their first topic (or kept as
+/// wildcards), so an event is only checked against subscriptions which can
+/// possibly accept it
+class SubscriptionIndex {
+ public:
+  using SubscriptionId = std::string;
+
+  /// Adds or replaces the filter of a subscription
+  void Add(const SubscriptionId& id, EventFilterParams filter);
+
+  /// Removes a subscription, returns false if it was not indexed
+  bool Remove(const SubscriptionId& id);
+
+  /// Returns ids of all subscriptions whose filters match the event
+  std::vector<SubscriptionId> Find(const Address& address,
+                                   const std::vector<Quantity>& topics) const;
+
+  bool Empty() const { return m_filters.empty(); }
+
+  size_t Size() const { return m_filters.size(); }
+
+ private:
+  using Bucket = std::unordered_set<SubscriptionId>;
+
+  void Unindex(const SubscriptionId& id, const EventFilterParams& filter);
+
+  /// Subscription id -> filter, used for the exact Match of candidates
+  std::unordered_map<SubscriptionId, EventFilterParams> m_filters;
+
+  /// Lowercase address -> subscriptions filtering by that address
+  std::unordered_map<std::string, Bucket> m_byAddress;
+
+  /// Lowercase first topic -> subscriptions with no address filter
+  std::unordered_map<std::string, Bucket> m_byFirstTopic;
+
+  /// Subscriptions with neither an address nor a first topic filter
+  Bucket m_wildcards;
+};
+
+}  // namespace filters
+}  // namespace evmproj
+
+#endif  // ZILLIQA_SRC_LIBETH_FILTERS_SUBSCRIPTIONINDEX_H_
@@ -154,8 +154,6 @@ void SubscriptionsImpl::Start(
 
   m_newHeadTemplate = m_pendingTxnTemplate;
   m_newHeadTemplate["params"]["subscription"] = "0x1";
-
-  m_eventTemplate = m_newHeadTemplate;
 }
 
 void SubscriptionsImpl::OnNewHead(const std::string& blockHash) {
@@ -205,30 +203,53 @@ void SubscriptionsImpl::OnPendingTransaction(const std::string& hash) {
 void SubscriptionsImpl::OnEventLog(const Address& address,
                                    const std::vector<Quantity>& topics,
                                    const Json::Value& log_response) {
-  Lock lk(m_mutex);
+  std::vector<std::pair<Id, OutMessage>> messages;
+
+  {
+    Lock lk(m_mutex);
+
+    if (m_logSubscriptions.Empty()) {
+      return;
+    }
+
+    auto matches = m_logSubscriptions.Find(address, topics);
+    if (matches.empty()) {
+      return;
+    }
 
-  Json::Value& json = m_eventTemplate["params"];
-  bool prepared = false;
-
-  for (const auto& conn : m_subscribedToLogs) {
-    for (const auto& pair : conn->eventFilters) {
-      if (Match(pair.second, address, topics)) {
-        if (!prepared) {
-          json["params"] = Json::Value{};
-          json["params"]["result"] = log_response;
-          json["params"]["subscription"] = pair.first;
-          prepared = true;
-        }
-        json["subscription"] = pair.first;
-        json["method"] = "eth_subscription";
-        m_websocketServer->SendMessage(
-            conn->id, std::make_shared<std::string>(JsonWrite(json)));
-
-        // Don't send the same message to the same connection
-        break;
+    // The log is serialized once, only the subscription id differs between
+    // messages
+    const auto result = JsonWrite(log_response);
+
+    std::unordered_set<Id> notified;
+    for (const auto& subId : matches) {
+      auto it = m_logSubscriptionOwners.find(subId);
+      if (it == m_logSubscriptionOwners.end()) {
+        continue;
+      }
+
+      // Don't send the same message to the same connection
+      if (!notified.insert(it->second).second) {
+        continue;
       }
+
+      auto msg = std::make_shared<std::string>();
+      msg->reserve(result.size() + subId.size() + 96);
+      *msg += R"({"jsonrpc":"2.0","method":"eth_subscription",)";
+      *msg += R"("params":{"result":)";
+      *msg += result;
+      *msg += R"(,"subscription":")";
+      *msg += subId;
+      *msg += R"("}})";
+      messages.emplace_back(it->second, std::move(msg));
     }
   }
+
+  // Sending happens outside the lock so that fan-out does not hold up
+  // (un)subscribe requests
+  for (auto& msg : messages) {
+    m_websocketServer->SendMessage(msg.first, std::move(msg.second));
+  }
 }
 
 bool SubscriptionsImpl::OnIncomingMessage(
@@ -309,7 +330,10 @@ void SubscriptionsImpl::OnSessionDisconnected(Id conn_id) {
     return;
   }
   const auto& conn = it->second;
-  m_subscribedToLogs.erase(conn);
+  for (const auto& subId : conn->eventSubscriptions) {
+    m_logSubscriptions.Remove(subId);
+    m_logSubscriptionOwners.erase(subId);
+  }
   m_connections.erase(it);
 }
 
@@ -340,13 +364,9 @@ SubscriptionsImpl::OutMessage SubscriptionsImpl::OnUnsubscribe(
     }
   }
 
-  auto& filters = conn->eventFilters;
-  auto it = filters.find(subscription_id);
-  if (it != filters.end()) {
-    filters.erase(it);
-    if (filters.empty()) {
-      m_subscribedToLogs.erase(conn);
-    }
+  if (conn->eventSubscriptions.erase(subscription_id) > 0) {
+    m_logSubscriptions.Remove(subscription_id);
+    m_logSubscriptionOwners.erase(subscription_id);
     result = true;
   }
 
@@ -385,10 +405,9 @@ SubscriptionsImpl::OutMessage SubscriptionsImpl::OnSubscribeToEvents(
     const ConnectionPtr& conn, Json::Value&& request_id,
     EventFilterParams&& filter) {
   auto subscriptionId = NumberAsString(++m_eventSubscriptionCounter);
-  conn->eventFilters[subscriptionId] = std::move(filter);
-  if (conn->eventFilters.size() == 1) {
-    m_subscribedToLogs.insert(conn);
-  }
+  conn->eventSubscriptions.insert(subscriptionId);
+  m_logSubscriptions.Add(subscriptionId, std::move(filter));
+  m_logSubscriptionOwners[subscriptionId] = conn->id;
 
   Json::Value json;
   json["jsonrpc"] = "2.0";
@@ -23,6 +23,7 @@
 #include <unordered_set>
 
 #include "Common.h"
+#include "SubscriptionIndex.h"
 #include "libServer/WebsocketServer.h"
 
 
@@ -81,8 +82,8 @@ class SubscriptionsImpl {
     /// populated if this conn subscribed to new heads
     std::unordered_set<uint64_t> subscribedToNewHeads;
 
-    /// Event subscription -> filter
-    std::unordered_map<std::string, EventFilterParams> eventFilters;
+    /// Event subscription ids, filters are kept in m_logSubscriptions
+    std::unordered_set<std::string> eventSubscriptions;
 
     uint64_t index = 0;
 
@@ -134,8 +135,11 @@ class SubscriptionsImpl {
   /// All active connections
   std::unordered_map<Id, ConnectionPtr> m_connections;
 
-  /// Connections who subscribed to event logs
-  std::unordered_set<ConnectionPtr> m_subscribedToLogs;
+  /// Event log filters of all connections
+  SubscriptionIndex m_logSubscriptions;
+
+  /// Event subscription id -> owning connection
+  std::unordered_map<std::string, Id> m_logSubscriptionOwners;
 
   /// Template for pending txn message
   Json::Value m_pendingTxnTemplate;
@@ -143,9 +147,6 @@ class SubscriptionsImpl {
   /// Template for new head message
   Json::Value m_newHeadTemplate;
 
-  /// Template for event log message
-  Json::Value m_eventTemplate;
-
   /// Incremental counter for event logs subscriptions (not starting from 1
   /// because there are special values for other types of subscriptions)
   uint64_t m_eventSubscriptionCounter = 100;
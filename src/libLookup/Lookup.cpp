@@ -1061,21 +1061,153 @@ bool Lookup::GetStateDeltaFromSeedNodes(const uint64_t& blockNum)
   return true;
 }
 
-bool Lookup::GetStateDeltasFromSeedNodes(uint64_t lowBlockNum,
-                                         uint64_t highBlockNum)
+VectorOfPeer Lookup::GetStateDeltaSyncPeers(bool& viaL2l) const {
+  VectorOfPeer peers;
+  viaL2l = false;
 
-{
+  // Lookups sync from the other lookups, archival lookups from the level 2
+  // lookups and everyone else from the seed nodes
   if (m_syncType == SyncType::LOOKUP_SYNC) {
-    SendMessageToRandomLookupNode(
-        ComposeGetStateDeltasMessage(lowBlockNum, highBlockNum));
+    peers = GetOtherLookupPeers();
   } else if (LOOKUP_NODE_MODE && ARCHIVAL_LOOKUP && !MULTIPLIER_SYNC_MODE) {
-    SendMessageToRandomL2lDataProvider(
-        ComposeGetStateDeltasMessage(lowBlockNum, highBlockNum));
+    viaL2l = true;
+    peers = GetL2lDataProviderPeers();
   } else {
-    SendMessageToRandomSeedNode(
-        ComposeGetStateDeltasMessage(lowBlockNum, highBlockNum));
+    lock_guard<mutex> lock(m_mutexSeedNodes);
+    for (const auto& node : m_seedNodes) {
+      auto resolved_ip = TryGettingResolvedIP(node.second);
+      if (!Blacklist::GetInstance().Exist(resolved_ip) &&
+          (m_mediator.m_selfPeer.GetIpAddress() != resolved_ip)) {
+        peers.emplace_back(resolved_ip, node.second.GetListenPortHost());
+      }
+    }
+  }
+
+  // Spread the windows of different syncs over different peers first
+  std::shuffle(peers.begin(), peers.end(),
+               std::mt19937(std::random_device{}()));
+  return peers;
+}
+
+VectorOfPeer Lookup::GetOtherLookupPeers() const {
+  VectorOfPeer peers;
+  lock_guard<mutex> lock(m_mutexLookupNodes);
+  for (const auto& node : m_lookupNodes) {
+    if (node.second == m_mediator.m_selfPeer ||
+        find_if(m_multipliers.begin(), m_multipliers.end(),
+                [&node](const PairOfNode& mult) {
+                  return node.second == mult.second;
+                }) != m_multipliers.end()) {
+      continue;
+    }
+    auto resolved_ip = TryGettingResolvedIP(node.second);
+    Blacklist::GetInstance().Whitelist(resolved_ip);
+    peers.emplace_back(resolved_ip, node.second.GetListenPortHost());
+  }
+  return peers;
+}
+
+VectorOfPeer Lookup::GetL2lDataProviderPeers() const {
+  VectorOfPeer peers;
+  lock_guard<mutex> lock(m_mutexL2lDataProviders);
+  for (const auto& node : m_l2lDataProviders) {
+    auto resolved_ip = TryGettingResolvedIP(node.second);
+    Blacklist::GetInstance().Whitelist(resolved_ip);
+    peers.emplace_back(resolved_ip, node.second.GetListenPortHost());
+  }
+  return peers;
+}
+
+bool Lookup::FetchStateDeltasFromSeedNodes(uint64_t lowBlockNum,
+                                           uint64_t highBlockNum) {
+  unique_lock<mutex> lock(m_mutexSetStateDeltasFromSeed);
+
+  m_stateDeltaSyncPeers = GetStateDeltaSyncPeers(m_stateDeltaSyncViaL2l);
+  if (m_stateDeltaSyncPeers.empty()) {
+    LOG_GENERAL(WARNING, "No peers to fetch state deltas from");
+    return false;
+  }
+
+  m_stateDeltaSync = make_unique<SyncScheduler>(
+      lowBlockNum, highBlockNum, SEED_SYNC_WINDOW_BLOCKS,
+      m_stateDeltaSyncPeers.size(),
+      min<size_t>(SEED_SYNC_MAX_PARALLEL_REQUESTS,
+                  m_stateDeltaSyncPeers.size()),
+      chrono::seconds(GETSTATEDELTAS_TIMEOUT_IN_SECONDS),
+      RETRY_GETSTATEDELTAS_COUNT);
+
+  unsigned char startByte = zil::p2p::START_BYTE_NORMAL;
+  if (m_stateDeltaSyncViaL2l && ENABLE_SEED_TO_SEED_COMMUNICATION) {
+    startByte = zil::p2p::START_BYTE_SEED_TO_SEED_REQUEST;
+  }
+
+  while (!m_stateDeltaSync->Done() && !m_stateDeltaSync->Failed()) {
+    for (const auto& request :
+         m_stateDeltaSync->NextRequests(SyncScheduler::Clock::now())) {
+      const auto& peer = m_stateDeltaSyncPeers.at(request.peer);
+      LOG_GENERAL(INFO, "Requesting state deltas " << request.lowBlockNum
+                                                   << "-"
+                                                   << request.highBlockNum
+                                                   << " from " << peer);
+      auto message = ComposeGetStateDeltasMessage(request.lowBlockNum,
+                                                  request.highBlockNum);
+      if (m_stateDeltaSyncViaL2l) {
+        P2PComm::GetInstance().SendMessage(peer, peer, message, startByte);
+      } else {
+        P2PComm::GetInstance().SendMessage(peer, message);
+      }
+    }
+
+    // Woken by every delivered window, otherwise wakes up once a second to
+    // reassign stalled ones
+    m_setStateDeltasFromSeedSignal = false;
+    cv_setStateDeltasFromSeed.wait_for(
+        lock, chrono::seconds(1),
+        [this]() { return m_setStateDeltasFromSeedSignal; });
   }
 
+  bool done = m_stateDeltaSync->Done();
+  m_stateDeltaSync.reset();
+  m_stateDeltaSyncPeers.clear();
+  return done;
+}
+
+bool Lookup::ApplyStateDeltas(uint64_t lowBlockNum, uint64_t rangeHigh,
+                              const vector<zbytes>& stateDeltas) {
+  int txBlkNum = lowBlockNum;
+  zbytes tmp;
+  for (const auto& delta : stateDeltas) {
+    // TBD - To verify state delta hash against one from TxBlk.
+    // But not crucial right now since we do verify sender i.e lookup and
+    // trust it.
+
+    if (!BlockStorage::GetBlockStorage().GetStateDelta(txBlkNum, tmp)) {
+      if (!AccountStore::GetInstance().DeserializeDelta(delta, 0)) {
+        LOG_GENERAL(WARNING,
+                    "AccountStore::GetInstance().DeserializeDelta failed");
+        return false;
+      }
+      if (txBlkNum % RELEASE_CACHE_INTERVAL == 0) {
+        DetachedFunction(1, CommonUtils::ReleaseSTLMemoryCache);
+      }
+      if (!BlockStorage::GetBlockStorage().PutStateDelta(txBlkNum, delta)) {
+        LOG_GENERAL(WARNING, "BlockStorage::PutStateDelta failed");
+        return false;
+      }
+      m_prevStateRootHashTemp = AccountStore::GetInstance().GetStateRootHash();
+
+      if ((txBlkNum + 1) % NUM_FINAL_BLOCK_PER_POW == 0) {
+        if (txBlkNum + NUM_FINAL_BLOCK_PER_POW > rangeHigh) {
+          if (!AccountStore::GetInstance().MoveUpdatesToDisk(
+                  txBlkNum / NUM_FINAL_BLOCK_PER_POW)) {
+            LOG_GENERAL(WARNING, "AccountStore::MoveUpdatesToDisk()");
+            return false;
+          }
+        }
+      }
+      txBlkNum++;
+    }
+  }
   return true;
 }
 
@@ -2341,9 +2473,12 @@ bool Lookup::AddMicroBlockToStorage(const MicroBlock& microblock) {
 
   zbytes body;
   microblock.Serialize(body, 0);
-  if (!BlockStorage::GetBlockStorage().PutMicroBlock(
-          microblock.GetBlockHash(), microblock.GetHeader().GetEpochNum(),
-          microblock.GetHeader().GetShardId(), body)) {
+  // Writes the body before the key that indexes it
+  auto writeTxn = BlockStorage::GetBlockStorage().BeginWriteTransaction();
+  if (!writeTxn.PutMicroBlock(microblock.GetBlockHash(),
+                              microblock.GetHeader().GetEpochNum(),
+                              microblock.GetHeader().GetShardId(), body) ||
+      !writeTxn.Commit()) {
     LOG_GENERAL(WARNING, "Failed to put microblock in body");
     return false;
   }
@@ -2567,7 +2702,8 @@ bool Lookup::ProcessSetMicroBlockFromLookup(
   return true;
 }
 
-void Lookup::SendGetMicroBlockFromLookup(const vector<BlockHash>& mbHashes) {
+void Lookup::SendGetMicroBlockFromLookup(const vector<BlockHash>& mbHashes,
+                                         const Peer& peer) {
   zbytes msg = {MessageType::LOOKUP,
                 LookupInstructionType::GETMICROBLOCKFROMLOOKUP};
 
@@ -2583,10 +2719,12 @@ void Lookup::SendGetMicroBlockFromLookup(const vector<BlockHash>& mbHashes) {
     return;
   }
 
-  SendMessageToRandomLookupNode(msg);
+  LOG_GENERAL(INFO, "Sending to lookup: " << peer);
+  P2PComm::GetInstance().SendMessage(peer, msg);
 }
 
-void Lookup::SendGetMicroBlockFromL2l(const vector<BlockHash>& mbHashes) {
+void Lookup::SendGetMicroBlockFromL2l(const vector<BlockHash>& mbHashes,
+                                      const Peer& peer) {
   zbytes msg = {MessageType::LOOKUP,
                 LookupInstructionType::GETMICROBLOCKFROML2LDATAPROVIDER};
 
@@ -2602,7 +2740,41 @@ void Lookup::SendGetMicroBlockFromL2l(const vector<BlockHash>& mbHashes) {
     return;
   }
 
-  SendMessageToRandomL2lDataProvider(msg);
+  LOG_GENERAL(INFO, "Sending message to l2l: " << peer);
+  unsigned char startByte = zil::p2p::START_BYTE_NORMAL;
+  if (ENABLE_SEED_TO_SEED_COMMUNICATION) {
+    startByte = zil::p2p::START_BYTE_SEED_TO_SEED_REQUEST;
+  }
+  P2PComm::GetInstance().SendMessage(peer, peer, msg, startByte);
+}
+
+void Lookup::SendGetMicroBlocksInWindows(
+    const vector<vector<BlockHash>>& windows) {
+  if (windows.empty()) {
+    return;
+  }
+
+  const bool viaL2l = !MULTIPLIER_SYNC_MODE;
+  VectorOfPeer peers =
+      viaL2l ? GetL2lDataProviderPeers() : GetOtherLookupPeers();
+  if (peers.empty()) {
+    LOG_GENERAL(WARNING, "No peers to fetch missing microblocks from");
+    return;
+  }
+  std::shuffle(peers.begin(), peers.end(),
+               std::mt19937(std::random_device{}()));
+
+  // Windows go round robin to distinct peers, so one slow peer holds back
+  // only its share. Whatever doesn't arrive is requested again next epoch
+  const size_t numPeers = min<size_t>(
+      max(SEED_SYNC_MAX_PARALLEL_REQUESTS, 1U), peers.size());
+  for (size_t i = 0; i < windows.size(); ++i) {
+    if (viaL2l) {
+      SendGetMicroBlockFromL2l(windows[i], peers[i % numPeers]);
+    } else {
+      SendGetMicroBlockFromLookup(windows[i], peers[i % numPeers]);
+    }
+  }
 }
 
 bool Lookup::ProcessGetCosigsRewardsFromSeed(
@@ -3204,28 +3376,8 @@ bool Lookup::CommitTxBlocks(const vector<TxBlock>& txBlocks) {
   uint64_t highBlockNum = txBlocks.back().GetHeader().GetBlockNum();
   bool placeholder = false;
   if (m_syncType != SyncType::RECOVERY_ALL_SYNC) {
-    unsigned int retry = 1;
-    while (retry <= RETRY_GETSTATEDELTAS_COUNT) {
-      {
-        std::unique_lock<std::mutex> cv_lk(m_mutexSetStateDeltasFromSeed);
-        m_setStateDeltasFromSeedSignal = false;
-      }
-      // Get the state-delta for all txBlocks from random lookup nodes
-      GetStateDeltasFromSeedNodes(lowBlockNum, highBlockNum);
-      std::unique_lock<std::mutex> cv_lk(m_mutexSetStateDeltasFromSeed);
-      if (!cv_setStateDeltasFromSeed.wait_for(
-              cv_lk, std::chrono::seconds(GETSTATEDELTAS_TIMEOUT_IN_SECONDS),
-              [this]() { return m_setStateDeltasFromSeedSignal; })) {
-        LOG_GENERAL(
-            WARNING,
-            "[Retry: " << retry
-                       << "] Didn't receive statedeltas! Will try again");
-        retry++;
-      } else {
-        break;
-      }
-    }
-    if (retry > RETRY_GETSTATEDELTAS_COUNT) {
+    // Get the state-delta for all txBlocks from several lookup nodes at once
+    if (!FetchStateDeltasFromSeedNodes(lowBlockNum, highBlockNum)) {
       LOG_GENERAL(WARNING, "Failed to receive state-deltas for txBlks: "
                                << lowBlockNum << "-" << highBlockNum);
       cv_setTxBlockFromSeed.notify_all();
@@ -3252,8 +3404,9 @@ bool Lookup::CommitTxBlocks(const vector<TxBlock>& txBlocks) {
     txBlock.Serialize(serializedTxBlock, 0);
     uint64_t blockNum = txBlock.GetHeader().GetBlockNum();
 
-    if (!BlockStorage::GetBlockStorage().PutTxBlock(txBlock.GetHeader(),
-                                                    serializedTxBlock)) {
+    auto writeTxn = BlockStorage::GetBlockStorage().BeginWriteTransaction();
+    if (!writeTxn.PutTxBlock(txBlock.GetHeader(), serializedTxBlock) ||
+        !writeTxn.Commit()) {
       LOG_GENERAL(WARNING, "BlockStorage::PutTxBlock failed " << txBlock);
       return false;
     }
@@ -3653,42 +3806,34 @@ bool Lookup::ProcessSetStateDeltasFromSeed(
     LOG_GENERAL(WARNING,
                 "StateDeltas recvd:" << stateDeltas.size() << " , Expected: "
                                      << highBlockNum - lowBlockNum + 1);
+    if (m_stateDeltaSync) {
+      // Ask another peer right away instead of waiting for the timeout
+      m_stateDeltaSync->Reject(lowBlockNum, highBlockNum);
+      m_setStateDeltasFromSeedSignal = true;
+      cv_setStateDeltasFromSeed.notify_all();
+    }
     return false;
   }
 
-  int txBlkNum = lowBlockNum;
-  zbytes tmp;
-  for (const auto& delta : stateDeltas) {
-    // TBD - To verify state delta hash against one from TxBlk.
-    // But not crucial right now since we do verify sender i.e lookup and
-    // trust it.
-
-    if (!BlockStorage::GetBlockStorage().GetStateDelta(txBlkNum, tmp)) {
-      if (!AccountStore::GetInstance().DeserializeDelta(delta, 0)) {
-        LOG_GENERAL(WARNING,
-                    "AccountStore::GetInstance().DeserializeDelta failed");
-        return false;
-      }
-      if (txBlkNum % RELEASE_CACHE_INTERVAL == 0) {
-        DetachedFunction(1, CommonUtils::ReleaseSTLMemoryCache);
-      }
-      if (!BlockStorage::GetBlockStorage().PutStateDelta(txBlkNum, delta)) {
-        LOG_GENERAL(WARNING, "BlockStorage::PutStateDelta failed");
-        return false;
-      }
-      m_prevStateRootHashTemp = AccountStore::GetInstance().GetStateRootHash();
-
-      if ((txBlkNum + 1) % NUM_FINAL_BLOCK_PER_POW == 0) {
-        if (txBlkNum + NUM_FINAL_BLOCK_PER_POW > highBlockNum) {
-          if (!AccountStore::GetInstance().MoveUpdatesToDisk(
-                  txBlkNum / NUM_FINAL_BLOCK_PER_POW)) {
-            LOG_GENERAL(WARNING, "AccountStore::MoveUpdatesToDisk()");
-            return false;
-          }
-        }
+  if (m_stateDeltaSync) {
+    // Windows may arrive in any order, apply whatever now continues the
+    // range applied so far
+    if (!m_stateDeltaSync->Deliver(lowBlockNum, highBlockNum,
+                                   std::move(stateDeltas))) {
+      LOG_GENERAL(INFO, "Ignoring unrequested or duplicate state deltas "
+                            << lowBlockNum << "-" << highBlockNum);
+      return false;
+    }
+    for (const auto& ready : m_stateDeltaSync->PopReady()) {
+      if (!ApplyStateDeltas(ready.lowBlockNum,
+                            m_stateDeltaSync->HighBlockNum(),
+                            ready.payload)) {
+        m_stateDeltaSync->Abort();
+        break;
       }
-      txBlkNum++;
     }
+  } else if (!ApplyStateDeltas(lowBlockNum, highBlockNum, stateDeltas)) {
+    return false;
   }
 
   m_setStateDeltasFromSeedSignal = true;
@@ -3964,18 +4109,21 @@ bool Lookup::ProcessSetTxnsFromLookup(
     epochNum = microBlockPtr->GetHeader().GetEpochNum();
   }
 
+  auto writeTxn = BlockStorage::GetBlockStorage().BeginWriteTransaction();
   for (const auto& txn : txns) {
     zbytes serializedTxBody;
     txn.Serialize(serializedTxBody, 0);
 
-    if (!BlockStorage::GetBlockStorage().PutTxBody(
-            epochNum, txn.GetTransaction().GetTranID(), serializedTxBody)) {
+    if (!writeTxn.PutTxBody(epochNum, txn.GetTransaction().GetTranID(),
+                            serializedTxBody)) {
       LOG_GENERAL(WARNING, "BlockStorage::PutTxBody failed "
                                << txn.GetTransaction().GetTranID());
-      continue;  // Transaction already existed locally. Move on so as to delete
-                 // the entry from unavailable list
     }
   }
+  if (!writeTxn.Commit()) {
+    // Move on regardless so as to delete the entry from unavailable list
+    LOG_GENERAL(WARNING, "Failed to store txn bodies of microblock " << mbHash);
+  }
 
   // Delete the mb from unavailable list here
   std::lock_guard<mutex> lock(m_mediator.m_node->m_mutexUnavailableMicroBlocks);
@@ -5962,6 +6110,8 @@ void Lookup::CheckAndFetchUnavailableMBs(bool skipLatestTxBlk) {
     auto& unavailableMBs = m_mediator.m_node->GetUnavailableMicroBlocks();
     unsigned int count = 0;
     bool limitReached = false;
+    // One window per final block
+    vector<vector<BlockHash>> windows;
     for (auto& m : unavailableMBs) {
       // skip mbs from latest final block
       if (skipLatestTxBlk && (m.first == m_mediator.m_currentEpochNum - 1)) {
@@ -6002,16 +6152,16 @@ void Lookup::CheckAndFetchUnavailableMBs(bool skipLatestTxBlk) {
                   "BlockHash = " << mb.first << ", TxnHash = " << mb.second);
         mbHashes.emplace_back(mb.first);
       }
+      if (!mbHashes.empty()) {
+        windows.emplace_back(std::move(mbHashes));
+      }
       if (limitReached) {
         break;
       }
-      if (!MULTIPLIER_SYNC_MODE) {
-        SendGetMicroBlockFromL2l(mbHashes);
-      } else {
-        SendGetMicroBlockFromLookup(mbHashes);
-      }
     }
 
+    SendGetMicroBlocksInWindows(windows);
+
     // Delete the entry for those fb with no pending mbs
     for (auto it = unavailableMBs.begin(); it != unavailableMBs.end();) {
       if (it->second.empty()) {
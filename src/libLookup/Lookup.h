@@ -32,6 +32,7 @@
 #include "libBlockchain/MicroBlock.h"
 #include "libBlockchain/TxBlock.h"
 #include "libData/AccountData/Transaction.h"
+#include "libLookup/SyncScheduler.h"
 #include "libNetwork/Executable.h"
 #include "libNetwork/ShardStruct.h"
 #include "libUtils/IPConverter.h"
@@ -125,6 +126,11 @@ class Lookup : public Executable {
   std::mutex m_mutexSetStateDeltasFromSeed;
   std::condition_variable cv_setStateDeltasFromSeed;
   bool m_setStateDeltasFromSeedSignal;
+  // Parallel state delta fetch in progress, if any. Guarded by
+  // m_mutexSetStateDeltasFromSeed
+  std::unique_ptr<SyncScheduler> m_stateDeltaSync;
+  VectorOfPeer m_stateDeltaSyncPeers;
+  bool m_stateDeltaSyncViaL2l = false;
 
   // TxBlockBuffer
   std::vector<TxBlock> m_txBlockBuffer;
@@ -238,7 +244,26 @@ class Lookup : public Executable {
   bool GetTxBlockFromLookupNodes(uint64_t lowBlockNum, uint64_t highBlockNum);
   bool GetTxBlockFromSeedNodes(uint64_t lowBlockNum, uint64_t highBlockNum);
   bool GetStateDeltaFromSeedNodes(const uint64_t& blockNum);
-  bool GetStateDeltasFromSeedNodes(uint64_t lowBlockNum, uint64_t highBlockNum);
+
+  /// Peers state deltas are fetched from in the current sync mode
+  VectorOfPeer GetStateDeltaSyncPeers(bool& viaL2l) const;
+
+  /// Lookups other than multipliers and this node, resolved and whitelisted
+  VectorOfPeer GetOtherLookupPeers() const;
+
+  /// L2l data providers, resolved and whitelisted
+  VectorOfPeer GetL2lDataProviderPeers() const;
+
+  /// Fetches the state deltas of [lowBlockNum, highBlockNum] in windows from
+  /// several peers at once and applies them in block order. Blocks until the
+  /// whole range is applied or the fetch gives up
+  bool FetchStateDeltasFromSeedNodes(uint64_t lowBlockNum,
+                                     uint64_t highBlockNum);
+
+  /// Applies consecutive state deltas starting at lowBlockNum. rangeHigh is
+  /// the end of the whole range being synced
+  bool ApplyStateDeltas(uint64_t lowBlockNum, uint64_t rangeHigh,
+                        const std::vector<zbytes>& stateDeltas);
 
   // UNUSED
   bool ProcessGetShardFromSeed([[gnu::unused]] const zbytes& message,
@@ -357,9 +382,16 @@ class Lookup : public Executable {
   void SendGetTxnsFromL2l(const BlockHash& mbHash,
                           const std::vector<TxnHash>& txnhashes);
 
-  void SendGetMicroBlockFromLookup(const std::vector<BlockHash>& mbHashes);
+  void SendGetMicroBlockFromLookup(const std::vector<BlockHash>& mbHashes,
+                                   const Peer& peer);
+
+  void SendGetMicroBlockFromL2l(const std::vector<BlockHash>& mbHashes,
+                                const Peer& peer);
 
-  void SendGetMicroBlockFromL2l(const std::vector<BlockHash>& mbHashes);
+  /// Requests every window of missing microblocks at once, spread over up to
+  /// SEED_SYNC_MAX_PARALLEL_REQUESTS peers
+  void SendGetMicroBlocksInWindows(
+      const std::vector<std::vector<BlockHash>>& windows);
 
   bool ProcessGetMicroBlockFromLookup(const zbytes& message,
                                       unsigned int offset, const Peer& from,
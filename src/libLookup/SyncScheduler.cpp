@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "SyncScheduler.h"
+
+#include <algorithm>
+
+SyncScheduler::SyncScheduler(uint64_t lowBlockNum, uint64_t highBlockNum,
+                             uint64_t windowSize, size_t numPeers,
+                             size_t maxInFlight, Clock::duration timeout,
+                             unsigned int maxAttempts)
+    : m_lowBlockNum(lowBlockNum),
+      m_highBlockNum(highBlockNum),
+      m_numPeers(std::max<size_t>(numPeers, 1)),
+      m_maxInFlight(std::max<size_t>(maxInFlight, 1)),
+      m_timeout(timeout),
+      m_maxAttempts(std::max(maxAttempts, 1u)) {
+  windowSize = std::max<uint64_t>(windowSize, 1);
+  for (uint64_t low = lowBlockNum; low <= highBlockNum;) {
+    uint64_t high = std::min(highBlockNum, low + windowSize - 1);
+    m_windows[low].highBlockNum = high;
+    if (high == highBlockNum) {
+      break;
+    }
+    low = high + 1;
+  }
+}
+
+std::vector<SyncScheduler::Request> SyncScheduler::NextRequests(
+    Clock::time_point now) {
+  std::vector<Request> requests;
+  if (m_aborted) {
+    return requests;
+  }
+
+  for (auto& entry : m_windows) {
+    auto& window = entry.second;
+    if (window.state == State::IN_FLIGHT && window.deadline <= now) {
+      window.state = State::PENDING;
+      --m_inFlight;
+    }
+  }
+
+  for (auto& [low, window] : m_windows) {
+    if (m_inFlight >= m_maxInFlight) {
+      break;
+    }
+    if (window.state != State::PENDING) {
+      continue;
+    }
+    if (window.attempts >= m_maxAttempts) {
+      m_aborted = true;
+      return {};
+    }
+
+    auto peer = m_nextPeer++ % m_numPeers;
+    // A retry goes to a different peer than the one which let us down
+    if (window.attempts > 0 && peer == window.peer && m_numPeers > 1) {
+      peer = m_nextPeer++ % m_numPeers;
+    }
+
+    window.peer = peer;
+    window.attempts++;
+    window.deadline = now + m_timeout;
+    window.state = State::IN_FLIGHT;
+    ++m_inFlight;
+    requests.push_back({low, window.highBlockNum, peer});
+  }
+
+  return requests;
+}
+
+SyncScheduler::Window* SyncScheduler::Find(uint64_t lowBlockNum,
+                                           uint64_t highBlockNum) {
+  auto it = m_windows.find(lowBlockNum);
+  if (it == m_windows.end() || it->second.highBlockNum != highBlockNum) {
+    return nullptr;
+  }
+  return &it->second;
+}
+
+bool SyncScheduler::Deliver(uint64_t lowBlockNum, uint64_t highBlockNum,
+                            Payload&& payload) {
+  auto* window = Find(lowBlockNum, highBlockNum);
+  if (!window || window->state == State::DELIVERED) {
+    return false;
+  }
+
+  // A late reply from a peer we already gave up on is as good as any
+  if (window->state == State::IN_FLIGHT) {
+    --m_inFlight;
+  }
+  window->state = State::DELIVERED;
+  window->payload = std::move(payload);
+  return true;
+}
+
+void SyncScheduler::Reject(uint64_t lowBlockNum, uint64_t highBlockNum) {
+  auto* window = Find(lowBlockNum, highBlockNum);
+  if (window && window->state == State::IN_FLIGHT) {
+    window->state = State::PENDING;
+    --m_inFlight;
+  }
+}
+
+std::vector<SyncScheduler::Ready> SyncScheduler::PopReady() {
+  std::vector<Ready> ready;
+  while (!m_windows.empty() &&
+         m_windows.begin()->second.state == State::DELIVERED) {
+    auto node = m_windows.extract(m_windows.begin());
+    ready.push_back({node.key(), node.mapped().highBlockNum,
+                     std::move(node.mapped().payload)});
+  }
+  return ready;
+}
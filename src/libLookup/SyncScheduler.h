@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ZILLIQA_SRC_LIBLOOKUP_SYNCSCHEDULER_H_
+#define ZILLIQA_SRC_LIBLOOKUP_SYNCSCHEDULER_H_
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "common/BaseType.h"
+
+/// Splits a block range into windows which are fetched from several peers
+/// at once. Replies may arrive in any order but are handed out strictly in
+/// block order, and a window whose peer stalls or sends an incomplete reply
+/// is handed to the next peer. Not thread safe, the owner serializes access.
+class SyncScheduler {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /// One entry per block of the window
+  using Payload = std::vector<zbytes>;
+
+  struct Request {
+    uint64_t lowBlockNum;
+    uint64_t highBlockNum;
+    /// Index into the peer list the owner synchronizes from
+    size_t peer;
+  };
+
+  struct Ready {
+    uint64_t lowBlockNum;
+    uint64_t highBlockNum;
+    Payload payload;
+  };
+
+  SyncScheduler(uint64_t lowBlockNum, uint64_t highBlockNum,
+                uint64_t windowSize, size_t numPeers, size_t maxInFlight,
+                Clock::duration timeout, unsigned int maxAttempts);
+
+  /// Windows to request now, including stalled ones moved to another peer
+  std::vector<Request> NextRequests(Clock::time_point now);
+
+  /// Stores a reply. Returns false if no such window is outstanding
+  bool Deliver(uint64_t lowBlockNum, uint64_t highBlockNum, Payload&& payload);
+
+  /// Marks an outstanding window as failed so it is requested again
+  void Reject(uint64_t lowBlockNum, uint64_t highBlockNum);
+
+  /// Removes and returns the delivered windows which extend the block range
+  /// applied so far, in block order
+  std::vector<Ready> PopReady();
+
+  /// Stops scheduling, e.g. after a window could not be applied
+  void Abort() { m_aborted = true; }
+
+  /// Every window was handed out by PopReady
+  bool Done() const { return m_windows.empty(); }
+
+  /// Aborted, or some window ran out of attempts
+  bool Failed() const { return m_aborted; }
+
+  uint64_t LowBlockNum() const { return m_lowBlockNum; }
+  uint64_t HighBlockNum() const { return m_highBlockNum; }
+
+ private:
+  enum class State { PENDING, IN_FLIGHT, DELIVERED };
+
+  struct Window {
+    uint64_t highBlockNum = 0;
+    State state = State::PENDING;
+    size_t peer = 0;
+    unsigned int attempts = 0;
+    Clock::time_point deadline;
+    Payload payload;
+  };
+
+  Window* Find(uint64_t lowBlockNum, uint64_t highBlockNum);
+
+  const uint64_t m_lowBlockNum;
+  const uint64_t m_highBlockNum;
+  const size_t m_numPeers;
+  const size_t m_maxInFlight;
+  const Clock::duration m_timeout;
+  const unsigned int m_maxAttempts;
+
+  /// Windows not yet handed out, by low block number
+  std::map<uint64_t, Window> m_windows;
+  size_t m_inFlight = 0;
+  size_t m_nextPeer = 0;
+  bool m_aborted = false;
+};
+
+#endif  // ZILLIQA_SRC_LIBLOOKUP_SYNCSCHEDULER_H_
@@ -97,8 +97,9 @@ bool Synchronizer::AddGenesisTxBlockToBlockChain(TxBlockChain& txBlockChain,
   // Store Tx Block to disk
   zbytes serializedTxBlock;
   txBlock.Serialize(serializedTxBlock, 0);
-  if (!BlockStorage::GetBlockStorage().PutTxBlock(txBlock.GetHeader(),
-                                                  serializedTxBlock)) {
+  auto writeTxn = BlockStorage::GetBlockStorage().BeginWriteTransaction();
+  if (!writeTxn.PutTxBlock(txBlock.GetHeader(), serializedTxBlock) ||
+      !writeTxn.Commit()) {
     LOG_GENERAL(WARNING, "BlockStorage::PutTxBlock failed " << txBlock);
     return false;
   }
@@ -22,11 +22,14 @@
 #include "libData/AccountStore/AccountStore.h"
 #include "libData/BlockChainData/BlockLinkChain.h"
 #include "libDirectoryService/DirectoryService.h"
+#include "libPersistence/ContractStorage.h"
 #include "libUtils/SafeMath.h"
 
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <algorithm>
+#include <limits>
 #include <map>
 #include <random>
 #include <unordered_set>
@@ -62,6 +65,70 @@ void NumberToArray(const T& number, zbytes& dst, const unsigned int offset) {
   Serializable::SetNumber<T>(dst, offset, number, S);
 }
 
+/// Decodes a serialized ProtoAccountStore one entry at a time and hands each
+/// entry to onEntry, so that only a single account delta is held in memory
+/// at once regardless of the total size of the state delta
+template <class OnEntry>
+bool ForEachAccountStoreEntry(const zbytes& src, const unsigned int offset,
+                              OnEntry&& onEntry, size_t& numEntries) {
+  using google::protobuf::internal::WireFormatLite;
+
+  numEntries = 0;
+
+  if (offset > src.size()) {
+    LOG_GENERAL(WARNING, "Invalid data and offset, data size "
+                             << src.size() << ", offset " << offset);
+    return false;
+  }
+
+  google::protobuf::io::ArrayInputStream arrayIn(src.data() + offset,
+                                                 src.size() - offset);
+  google::protobuf::io::CodedInputStream codedIn(&arrayIn);
+  codedIn.SetTotalBytesLimit(std::numeric_limits<int>::max());
+
+  ProtoAccountStore::AddressAccount entry;
+
+  while (true) {
+    const uint32_t tag = codedIn.ReadTag();
+    if (tag == 0) {
+      break;
+    }
+
+    if (WireFormatLite::GetTagFieldNumber(tag) !=
+            ProtoAccountStore::kEntriesFieldNumber ||
+        WireFormatLite::GetTagWireType(tag) !=
+            WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+      if (!WireFormatLite::SkipField(&codedIn, tag)) {
+        LOG_GENERAL(WARNING, "ProtoAccountStore unknown field skip failed");
+        return false;
+      }
+      continue;
+    }
+
+    uint32_t length = 0;
+    if (!codedIn.ReadVarint32(&length)) {
+      LOG_GENERAL(WARNING, "ProtoAccountStore entry length read failed");
+      return false;
+    }
+
+    const auto limit = codedIn.PushLimit(length);
+    entry.Clear();
+    if (!entry.MergeFromCodedStream(&codedIn) ||
+        codedIn.BytesUntilLimit() != 0 || !entry.IsInitialized()) {
+      LOG_GENERAL(WARNING, "ProtoAccountStore entry initialization failed");
+      return false;
+    }
+    codedIn.PopLimit(limit);
+
+    ++numEntries;
+    if (!onEntry(static_cast<const ProtoAccountStore::AddressAccount&>(entry))) {
+      return false;
+    }
+  }
+
+  return codedIn.ConsumedEntireMessage();
+}
+
 // ============================================================================
 // Functions to check for fields in primitives that are used for persistent
 // storage. Remove fields from the checks once they are deprecated.
@@ -280,24 +347,29 @@ bool ProtobufToAccountBase(const ProtoAccountBase& protoAccountBase,
   return true;
 }
 
-bool AccountToProtobuf(const Account& account, ProtoAccount& protoAccount) {
+bool AccountToProtobuf(const Account& account, ProtoAccount& protoAccount,
+                       const ContractStorage::CommittedState* committed) {
   ZilliqaMessage::ProtoAccountBase* protoAccountBase =
       protoAccount.mutable_base();
 
   AccountBaseToProtobuf(account, *protoAccountBase);
 
   if (!protoAccountBase->codehash().empty()) {
-    zbytes codebytes = account.GetCode();
-    protoAccount.set_code(codebytes.data(), codebytes.size());
+    const auto codebytes = account.GetCodeBlob();
+    protoAccount.set_code(codebytes->data(), codebytes->size());
 
     // set initdata
-    zbytes initbytes = account.GetInitData();
-    protoAccount.set_initdata(initbytes.data(), initbytes.size());
+    const auto initbytes = account.GetInitDataBlob();
+    protoAccount.set_initdata(initbytes->data(), initbytes->size());
 
     // set data
     map<std::string, zbytes> t_states;
     set<std::string> deletedIndices;
-    if (!account.GetUpdatedStates(t_states, deletedIndices, false)) {
+    if (committed != nullptr) {
+      // Deletions are already applied to a committed state
+      ContractStorage::FetchStateDataForKey(*committed, t_states,
+                                            account.GetAddress().hex());
+    } else if (!account.GetUpdatedStates(t_states, deletedIndices, false)) {
       LOG_GENERAL(WARNING, "Account::GetUpdatedStates failed");
       return false;
     }
@@ -313,6 +385,10 @@ bool AccountToProtobuf(const Account& account, ProtoAccount& protoAccount) {
   return true;
 }
 
+bool AccountToProtobuf(const Account& account, ProtoAccount& protoAccount) {
+  return AccountToProtobuf(account, protoAccount, nullptr);
+}
+
 bool ProtobufToAccount(const ProtoAccount& protoAccount, Account& account,
                        const Address& addr) {
   if (!CheckRequiredFieldsProtoAccount(protoAccount)) {
@@ -417,10 +493,10 @@ bool AccountDeltaToProtobuf(const Account* oldAccount,
   if (newAccount.isContract() || newAccount.IsLibrary()) {
     if (fullCopy) {
       accbase.SetCodeHash(newAccount.GetCodeHash());
-      protoAccount.set_code(newAccount.GetCode().data(),
-                            newAccount.GetCode().size());
-      protoAccount.set_initdata(newAccount.GetInitData().data(),
-                                newAccount.GetInitData().size());
+      const auto code = newAccount.GetCodeBlob();
+      const auto initData = newAccount.GetInitDataBlob();
+      protoAccount.set_code(code->data(), code->size());
+      protoAccount.set_initdata(initData->data(), initData->size());
     }
 
     if (fullCopy ||
@@ -511,8 +587,8 @@ bool ProtobufToAccountDelta(const ProtoAccount& protoAccount, Account& account,
       initDataBytes.resize(protoAccount.initdata().size());
       copy(protoAccount.initdata().begin(), protoAccount.initdata().end(),
            initDataBytes.begin());
-      if (codeBytes != account.GetCode() ||
-          initDataBytes != account.GetInitData()) {
+      if (codeBytes != *account.GetCodeBlob() ||
+          initDataBytes != *account.GetInitDataBlob()) {
         if (!account.SetImmutable(codeBytes, initDataBytes)) {
           LOG_GENERAL(WARNING, "Account::SetImmutable failed");
           return false;
@@ -564,6 +640,29 @@ bool ProtobufToAccountDelta(const ProtoAccount& protoAccount, Account& account,
   return true;
 }
 
+// The checks of ProtobufToAccountDelta that do not depend on the account
+bool CheckAccountDelta(const ProtoAccount& protoAccount) {
+  if (!CheckRequiredFieldsProtoAccount(protoAccount)) {
+    LOG_GENERAL(WARNING, "CheckRequiredFieldsProtoAccount failed");
+    return false;
+  }
+
+  AccountBase accbase;
+  if (!ProtobufToAccountBase(protoAccount.base(), accbase)) {
+    LOG_GENERAL(WARNING, "ProtobufToAccountBase failed");
+    return false;
+  }
+
+  if (accbase.GetVersion() != Account::VERSION) {
+    LOG_GENERAL(WARNING, "Account delta version doesn't match, expected "
+                             << Account::VERSION << " received "
+                             << accbase.GetVersion());
+    return false;
+  }
+
+  return true;
+}
+
 void DSCommitteeToProtobuf(const uint32_t version,
                            const DequeOfNode& dsCommittee,
                            ProtoDSCommittee& protoDSCommittee) {
@@ -825,8 +924,10 @@ void TransactionToProtobuf(const Transaction& transaction,
                                   *protoTransaction.mutable_signature());
 }
 
+// Decodes a transaction without checking its signature. txnData is set to
+// the serialized core info the signature is over.
 bool ProtobufToTransaction(const ProtoTransaction& protoTransaction,
-                           Transaction& transaction) {
+                           Transaction& transaction, zbytes& txnData) {
   if (!CheckRequiredFieldsProtoTransaction(protoTransaction)) {
     LOG_GENERAL(WARNING, "CheckRequiredFieldsProtoTransaction failed");
     return false;
@@ -849,12 +950,6 @@ bool ProtobufToTransaction(const ProtoTransaction& protoTransaction,
 
   PROTOBUFBYTEARRAYTOSERIALIZABLE(protoTransaction.signature(), signature);
 
-  zbytes txnData;
-  if (!SerializeToArray(protoTransaction.info(), txnData, 0)) {
-    LOG_GENERAL(WARNING, "Serialize protoTransaction core info failed");
-    return false;
-  }
-
   transaction = Transaction(
       txnCoreInfo.version, txnCoreInfo.nonce, txnCoreInfo.toAddr,
       txnCoreInfo.senderPubKey, txnCoreInfo.amount, txnCoreInfo.gasPrice,
@@ -867,6 +962,21 @@ bool ProtobufToTransaction(const ProtoTransaction& protoTransaction,
     return false;
   }
 
+  if (!SerializeToArray(protoTransaction.info(), txnData, 0)) {
+    LOG_GENERAL(WARNING, "Serialize protoTransaction core info failed");
+    return false;
+  }
+
+  return true;
+}
+
+bool ProtobufToTransaction(const ProtoTransaction& protoTransaction,
+                           Transaction& transaction) {
+  zbytes txnData;
+  if (!ProtobufToTransaction(protoTransaction, transaction, txnData)) {
+    return false;
+  }
+
   if (!transaction.IsSigned(txnData)) {
     LOG_GENERAL(WARNING,
                 "Signature verification failed when converting tx to protobuf");
@@ -876,6 +986,26 @@ bool ProtobufToTransaction(const ProtoTransaction& protoTransaction,
   return true;
 }
 
+// Checks the signatures of freshly decoded txns in one parallel batch,
+// failing the whole packet if any of them is invalid.
+bool VerifyTransactionSignatures(std::span<const Transaction> txns,
+                                 std::span<const zbytes> txnData) {
+  if (txns.empty()) {
+    return true;
+  }
+
+  const auto valid = Transaction::VerifyBatch(txns, txnData);
+  const auto numInvalid = std::count(valid.begin(), valid.end(), false);
+  if (numInvalid > 0) {
+    LOG_GENERAL(WARNING, "Signature verification failed for "
+                             << numInvalid << " of " << txns.size()
+                             << " txns");
+    return false;
+  }
+
+  return true;
+}
+
 void TransactionOffsetToProtobuf(const std::vector<uint32_t>& txnOffsets,
                                  ProtoTxnFileOffset& protoTxnFileOffset) {
   for (const auto& offset : txnOffsets) {
@@ -909,16 +1039,21 @@ void TransactionArrayToProtobuf(const deque<pair<Transaction, uint32_t>>& txns,
 bool ProtobufToTransactionArray(
     const ProtoTransactionArray& protoTransactionArray,
     std::vector<Transaction>& txns) {
+  const size_t firstNew = txns.size();
+  txns.reserve(firstNew + protoTransactionArray.transactions().size());
+  std::vector<zbytes> txnData(protoTransactionArray.transactions().size());
   for (const auto& protoTransaction : protoTransactionArray.transactions()) {
     Transaction txn;
-    if (!ProtobufToTransaction(protoTransaction, txn)) {
+    if (!ProtobufToTransaction(protoTransaction, txn,
+                               txnData[txns.size() - firstNew])) {
       LOG_GENERAL(WARNING, "ProtobufToTransaction failed");
       return false;
     }
-    txns.push_back(txn);
+    txns.push_back(std::move(txn));
   }
 
-  return true;
+  return VerifyTransactionSignatures(std::span(txns).subspan(firstNew),
+                                     txnData);
 }
 
 void TransactionReceiptToProtobuf(const TransactionReceipt& transReceipt,
@@ -1677,147 +1812,149 @@ bool Messenger::StateDeltaToAddressMap(
     return false;
   }
 
-  ProtoAccountStore result;
-  result.ParseFromArray(src.data() + offset, src.size() - offset);
-
-  if (!result.IsInitialized()) {
-    LOG_GENERAL(WARNING, "ProtoAccountStore initialization failed");
-    return false;
-  }
-
-  for (const auto& entry : result.entries()) {
-    Address address;
-    Account account;
+  size_t numEntries = 0;
+  return ForEachAccountStoreEntry(
+      src, offset,
+      [&accountMap](const ProtoAccountStore::AddressAccount& entry) {
+        Address address;
 
-    copy(entry.address().begin(),
-         entry.address().begin() + min((unsigned int)entry.address().size(),
-                                       (unsigned int)address.size),
-         address.asArray().begin());
+        copy(entry.address().begin(),
+             entry.address().begin() +
+                 min((unsigned int)entry.address().size(),
+                     (unsigned int)address.size),
+             address.asArray().begin());
 
-    uint128_t tmpNumber;
+        uint128_t tmpNumber;
 
-    ProtobufByteArrayToNumber<uint128_t, UINT128_SIZE>(
-        entry.account().base().balance(), tmpNumber);
+        ProtobufByteArrayToNumber<uint128_t, UINT128_SIZE>(
+            entry.account().base().balance(), tmpNumber);
 
-    int256_t balanceDelta = entry.account().numbersign()
-                                ? tmpNumber.convert_to<int256_t>()
-                                : 0 - tmpNumber.convert_to<int256_t>();
+        int256_t balanceDelta = entry.account().numbersign()
+                                    ? tmpNumber.convert_to<int256_t>()
+                                    : 0 - tmpNumber.convert_to<int256_t>();
 
-    accountMap.insert(make_pair(address, balanceDelta));
-  }
-
-  return true;
+        accountMap.insert(make_pair(address, balanceDelta));
+        return true;
+      },
+      numEntries);
 }
 
 bool Messenger::GetAccountStoreDelta(const zbytes& src,
                                      const unsigned int offset,
                                      AccountStore& accountStore,
                                      const bool revertible, bool temp) {
-  ProtoAccountStore result;
-  result.ParseFromArray(src.data() + offset, src.size() - offset);
-
-  if (!result.IsInitialized()) {
-    LOG_GENERAL(WARNING, "ProtoAccountStore initialization failed");
-    return false;
-  }
-
-  LOG_GENERAL(INFO,
-              "Total Number of Accounts Delta: " << result.entries().size());
-
-  for (const auto& entry : result.entries()) {
-    Address address;
-    Account account, t_account;
-
-    copy(entry.address().begin(),
-         entry.address().begin() + min((unsigned int)entry.address().size(),
-                                       (unsigned int)address.size),
-         address.asArray().begin());
-
-    const Account* oriAccount = accountStore.GetAccount(address);
-    bool fullCopy = false;
-    if (oriAccount == nullptr) {
-      Account acc(0, 0);
-      accountStore.AddAccount(address, acc);
-      oriAccount = accountStore.GetAccount(address);
-      fullCopy = true;
+  size_t numEntries = 0;
+
+  // Accounts are applied to the live store as they are decoded, so make
+  // sure the whole delta decodes before touching any of them
+  if (!ForEachAccountStoreEntry(
+          src, offset,
+          [](const ProtoAccountStore::AddressAccount& entry) {
+            return CheckAccountDelta(entry.account());
+          },
+          numEntries)) {
+    LOG_GENERAL(WARNING, "Invalid account store delta, nothing applied");
+    return false;
+  }
+
+  const bool result = ForEachAccountStoreEntry(
+      src, offset,
+      [&](const ProtoAccountStore::AddressAccount& entry) {
+        Address address;
+        Account account, t_account;
+
+        copy(entry.address().begin(),
+             entry.address().begin() +
+                 min((unsigned int)entry.address().size(),
+                     (unsigned int)address.size),
+             address.asArray().begin());
+
+        const Account* oriAccount = accountStore.GetAccount(address);
+        bool fullCopy = false;
+        if (oriAccount == nullptr) {
+          Account acc(0, 0);
+          accountStore.AddAccount(address, acc);
+          oriAccount = accountStore.GetAccount(address);
+          fullCopy = true;
+
+          if (oriAccount == nullptr) {
+            LOG_GENERAL(WARNING, "Failed to create account for " << address);
+            return false;
+          }
+        }
 
-      if (oriAccount == nullptr) {
-        LOG_GENERAL(WARNING, "Failed to create account for " << address);
-        return false;
-      }
-    }
+        t_account = *oriAccount;
+        account = *oriAccount;
+        if (!ProtobufToAccountDelta(entry.account(), account, address,
+                                    fullCopy, temp, revertible)) {
+          LOG_GENERAL(WARNING,
+                      "ProtobufToAccountDelta failed for account at address "
+                          << address.hex());
+          return false;
+        }
 
-    t_account = *oriAccount;
-    account = *oriAccount;
-    if (!ProtobufToAccountDelta(entry.account(), account, address, fullCopy,
-                                temp, revertible)) {
-      LOG_GENERAL(WARNING,
-                  "ProtobufToAccountDelta failed for account at address "
-                      << address.hex());
-      return false;
-    }
+        accountStore.AddAccountDuringDeserialization(
+            address, account, t_account, fullCopy, revertible);
+        return true;
+      },
+      numEntries);
 
-    accountStore.AddAccountDuringDeserialization(address, account, t_account,
-                                                 fullCopy, revertible);
-  }
+  LOG_GENERAL(INFO, "Total Number of Accounts Delta: " << numEntries);
 
-  return true;
+  return result;
 }
 
 bool Messenger::GetAccountStoreDelta(const zbytes& src,
                                      const unsigned int offset,
                                      AccountStoreTemp& accountStoreTemp,
                                      bool temp) {
-  ProtoAccountStore result;
-  result.ParseFromArray(src.data() + offset, src.size() - offset);
-
-  if (!result.IsInitialized()) {
-    LOG_GENERAL(WARNING, "ProtoAccountStore initialization failed");
-    return false;
-  }
-
-  LOG_GENERAL(INFO,
-              "Total Number of Accounts Delta: " << result.entries().size());
-
-  for (const auto& entry : result.entries()) {
-    Address address;
-    Account account;
+  size_t numEntries = 0;
+  const bool result = ForEachAccountStoreEntry(
+      src, offset,
+      [&](const ProtoAccountStore::AddressAccount& entry) {
+        Address address;
+        Account account;
+
+        copy(entry.address().begin(),
+             entry.address().begin() +
+                 min((unsigned int)entry.address().size(),
+                     (unsigned int)address.size),
+             address.asArray().begin());
+
+        const Account* oriAccount = accountStoreTemp.GetAccount(address);
+        bool fullCopy = false;
+        if (oriAccount == nullptr) {
+          Account acc(0, 0);
+          LOG_GENERAL(INFO, "Creating new account: " << address);
+          accountStoreTemp.AddAccount(address, acc);
+          fullCopy = true;
+        }
 
-    copy(entry.address().begin(),
-         entry.address().begin() + min((unsigned int)entry.address().size(),
-                                       (unsigned int)address.size),
-         address.asArray().begin());
+        oriAccount = accountStoreTemp.GetAccount(address);
 
-    const Account* oriAccount = accountStoreTemp.GetAccount(address);
-    bool fullCopy = false;
-    if (oriAccount == nullptr) {
-      Account acc(0, 0);
-      LOG_GENERAL(INFO, "Creating new account: " << address);
-      accountStoreTemp.AddAccount(address, acc);
-      fullCopy = true;
-    }
-
-    oriAccount = accountStoreTemp.GetAccount(address);
+        if (oriAccount == nullptr) {
+          LOG_GENERAL(WARNING, "Failed to create account for " << address);
+          return false;
+        }
 
-    if (oriAccount == nullptr) {
-      LOG_GENERAL(WARNING, "Failed to create account for " << address);
-      return false;
-    }
+        account = *oriAccount;
 
-    account = *oriAccount;
+        if (!ProtobufToAccountDelta(entry.account(), account, address,
+                                    fullCopy, temp)) {
+          LOG_GENERAL(WARNING,
+                      "ProtobufToAccountDelta failed for account at address "
+                          << address.hex());
+          return false;
+        }
 
-    if (!ProtobufToAccountDelta(entry.account(), account, address, fullCopy,
-                                temp)) {
-      LOG_GENERAL(WARNING,
-                  "ProtobufToAccountDelta failed for account at address "
-                      << address.hex());
-      return false;
-    }
+        accountStoreTemp.AddAccountDuringDeserialization(address, account);
+        return true;
+      },
+      numEntries);
 
-    accountStoreTemp.AddAccountDuringDeserialization(address, account);
-  }
+  LOG_GENERAL(INFO, "Total Number of Accounts Delta: " << numEntries);
 
-  return true;
+  return result;
 }
 
 bool Messenger::GetMbInfoHash(const std::vector<MicroBlockInfo>& mbInfos,
@@ -3665,13 +3802,21 @@ bool Messenger::GetNodeForwardTxnBlock(
       return false;
     }
 
+    const size_t firstNew = txns.size();
+    txns.reserve(firstNew + result.transactions().size());
+    std::vector<zbytes> txnData(result.transactions().size());
     for (const auto& txn : result.transactions()) {
       Transaction t;
-      if (!ProtobufToTransaction(txn, t)) {
+      if (!ProtobufToTransaction(txn, t, txnData[txns.size() - firstNew])) {
         LOG_GENERAL(WARNING, "ProtobufToTransaction failed");
         return false;
       }
-      txns.emplace_back(t);
+      txns.emplace_back(std::move(t));
+    }
+
+    if (!VerifyTransactionSignatures(std::span(txns).subspan(firstNew),
+                                     txnData)) {
+      return false;
     }
   }
 
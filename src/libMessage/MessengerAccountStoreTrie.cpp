@@ -26,7 +26,8 @@ using namespace ZilliqaMessage;
 template <class T = ProtoAccountStore>
 bool SerializeToArray(const T& protoMessage, zbytes& dst,
                       const unsigned int offset);
-bool AccountToProtobuf(const Account& account, ProtoAccount& protoAccount);
+bool AccountToProtobuf(const Account& account, ProtoAccount& protoAccount,
+                       const ContractStorage::CommittedState* committed);
 bool ProtobufToAccount(const ProtoAccount& protoAccount, Account& account,
                        const Address& addr);
 
@@ -34,7 +35,8 @@ template <class MAP>
 bool MessengerAccountStoreTrie::SetAccountStoreTrie(
     zbytes& dst, const unsigned int offset,
     const dev::GenericTrieDB<TraceableDB>& stateTrie,
-    const shared_ptr<MAP>& addressToAccount) {
+    const shared_ptr<MAP>& addressToAccount,
+    const ContractStorage::CommittedState* committedStates) {
   ProtoAccountStore result;
 
   for (const auto& i : stateTrie) {
@@ -46,7 +48,7 @@ bool MessengerAccountStoreTrie::SetAccountStoreTrie(
     auto it = addressToAccount->find(address);
     if (it != addressToAccount->end()) {
       const Account& account = it->second;
-      if (!AccountToProtobuf(account, *protoEntryAccount)) {
+      if (!AccountToProtobuf(account, *protoEntryAccount, committedStates)) {
         LOG_GENERAL(WARNING, "AccountToProtobuf failed");
         return false;
       }
@@ -60,7 +62,7 @@ bool MessengerAccountStoreTrie::SetAccountStoreTrie(
       if (account.GetCodeHash() != dev::h256()) {
         account.SetAddress(address);
       }
-      if (!AccountToProtobuf(account, *protoEntryAccount)) {
+      if (!AccountToProtobuf(account, *protoEntryAccount, committedStates)) {
         LOG_GENERAL(WARNING, "AccountToProtobuf failed");
         return false;
       }
@@ -85,10 +87,12 @@ template bool
 MessengerAccountStoreTrie::SetAccountStoreTrie<std::map<Address, Account>>(
     zbytes& dst, const unsigned int offset,
     const dev::GenericTrieDB<TraceableDB>& stateTrie,
-    const std::shared_ptr<std::map<Address, Account>>& addressToAccount);
+    const std::shared_ptr<std::map<Address, Account>>& addressToAccount,
+    const ContractStorage::CommittedState* committedStates);
 
 template bool MessengerAccountStoreTrie::SetAccountStoreTrie<
     std::unordered_map<Address, Account>>(
     zbytes& dst, const unsigned int offset,
     const dev::GenericTrieDB<TraceableDB>& stateTrie,
-    const shared_ptr<unordered_map<Address, Account>>& addressToAccount);
+    const shared_ptr<unordered_map<Address, Account>>& addressToAccount,
+    const ContractStorage::CommittedState* committedStates);
@@ -21,6 +21,7 @@
 #include "depends/libTrie/TrieDB.h"
 #include "libData/AccountData/Account.h"
 #include "libData/DataStructures/TraceableDB.h"
+#include "libPersistence/ContractStorage.h"
 
 // This class is only used by AccountStore class.
 // If AccountStoreBase.tpp included Messenger.h, we enter into some circular
@@ -32,11 +33,14 @@ class MessengerAccountStoreTrie {
   // ============================================================================
   // Primitives
   // ============================================================================
+  // Contract states are read from committedStates when given, otherwise
+  // from the live ContractStorage maps
   template <class MAP>
   static bool SetAccountStoreTrie(
       zbytes& dst, const unsigned int offset,
       const dev::GenericTrieDB<TraceableDB>& stateTrie,
-      const std::shared_ptr<MAP>& addressToAccount);
+      const std::shared_ptr<MAP>& addressToAccount,
+      const ContractStorage::CommittedState* committedStates = nullptr);
 };
 
 #endif  // ZILLIQA_SRC_LIBMESSAGE_MESSENGERACCOUNTSTORETRIE_H_
@@ -43,7 +43,10 @@
   M(GLOBAL_ERROR)                 \
   M(DEMO)                         \
   M(CPS_EVM)                      \
-  M(CPS_SCILLA)
+  M(CPS_SCILLA)                   \
+  M(STATE_DB)                     \
+  M(LEVELDB)                      \
+  M(POW)
 
 namespace zil {
 namespace metrics {
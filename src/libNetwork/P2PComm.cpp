@@ -30,6 +30,7 @@
 #include <netinet/in.h>
 #include <stdint.h>
 #include <sys/socket.h>
+#include <algorithm>
 #include <cstring>
 #include <memory>
 #include <string>
@@ -222,6 +223,12 @@ inline std::shared_ptr<zil::p2p::Message> MakeMsg(zbytes msg, Peer peer,
   return r;
 }
 
+inline bool RemoveFromEvbuffer(struct evbuffer* input, void* dst,
+                               size_t len) {
+  return len == 0 ||
+         evbuffer_remove(input, dst, len) == static_cast<ev_ssize_t>(len);
+}
+
 }  // namespace
 
 void P2PComm::ProcessBroadCastMsg(zbytes& message, zbytes& hash,
@@ -289,10 +296,11 @@ void P2PComm::ProcessBroadCastMsg(zbytes& message, zbytes& hash,
       message.at(GOSSIP_MSGTYPE_LEN + GOSSIP_ROUND_LEN + 3);
   from.m_listenPortHost = gossipSenderPort;
 
-  RumorManager::RawBytes rumor_message(message.begin() + GOSSIP_MSGTYPE_LEN +
-                                           GOSSIP_ROUND_LEN +
-                                           GOSSIP_SNDR_LISTNR_PORT_LEN,
-                                       message.end());
+  // The rumor is cut out of the received buffer in place, it is owned by us
+  message.erase(message.begin(), message.begin() + GOSSIP_MSGTYPE_LEN +
+                                     GOSSIP_ROUND_LEN +
+                                     GOSSIP_SNDR_LISTNR_PORT_LEN);
+  const RumorManager::RawBytes& rumor_message = message;
 
   P2PComm& p2p = P2PComm::GetInstance();
   if (gossipMsgTyp == (uint8_t)RRS::Message::Type::FORWARD) {
@@ -301,15 +309,16 @@ void P2PComm::ProcessBroadCastMsg(zbytes& message, zbytes& hash,
 
     if (p2p.SpreadForeignRumor(rumor_message)) {
       // skip the keys and signature.
-      zbytes tmp(rumor_message.begin() + PUB_KEY_SIZE +
-                     SIGNATURE_CHALLENGE_SIZE + SIGNATURE_RESPONSE_SIZE,
-                 rumor_message.end());
+      constexpr size_t SKIP_LEN = PUB_KEY_SIZE + SIGNATURE_CHALLENGE_SIZE +
+                                  SIGNATURE_RESPONSE_SIZE;
+      message.erase(message.begin(),
+                    message.begin() + std::min(SKIP_LEN, message.size()));
 
-      LOG_GENERAL(INFO, "Rumor size: " << tmp.size());
+      LOG_GENERAL(INFO, "Rumor size: " << message.size());
 
       // Queue the message
-      m_dispatcher(MakeMsg(std::move(tmp), from, zil::p2p::START_BYTE_GOSSIP,
-                           traceInfo));
+      m_dispatcher(MakeMsg(std::move(message), from,
+                           zil::p2p::START_BYTE_GOSSIP, traceInfo));
     }
   } else {
     auto resp = p2p.m_rumorManager.RumorReceived(
@@ -452,14 +461,18 @@ void P2PComm::EventCallback(struct bufferevent* bev, short events,
     return;
   }
 
-  const uint8_t* data = evbuffer_pullup(input, len);
-  if (!data) {
-    LOG_GENERAL(WARNING, "evbuffer_pullup failure.");
+  // Only the header is peeked, the message parts are then moved out of the
+  // evbuffer chain straight into their destinations, without linearizing
+  uint8_t prefix[zil::p2p::MAX_LAYOUT_PREFIX_LEN];
+  size_t prefixLen = std::min(len, sizeof(prefix));
+  if (evbuffer_copyout(input, prefix, prefixLen) !=
+      static_cast<ev_ssize_t>(prefixLen)) {
+    LOG_GENERAL(WARNING, "evbuffer_copyout failure.");
     return;
   }
 
-  zil::p2p::ReadMessageResult result;
-  auto state = zil::p2p::TryReadMessage(data, len, result);
+  zil::p2p::MessageLayout layout;
+  auto state = zil::p2p::TryReadMessageLayout(prefix, prefixLen, len, layout);
 
   if (state == zil::p2p::ReadState::NOT_ENOUGH_DATA) {
     // not enough bytes received, wait for the next callback
@@ -472,7 +485,20 @@ void P2PComm::EventCallback(struct bufferevent* bev, short events,
     return;
   }
 
-  std::ignore = evbuffer_drain(input, result.totalMessageBytes);
+  zil::p2p::ReadMessageResult result;
+  result.startByte = layout.startByte;
+  result.totalMessageBytes = layout.totalMessageBytes;
+  result.hash.resize(layout.hashBytes);
+  result.message.resize(layout.messageBytes);
+  result.traceInfo.resize(layout.traceBytes);
+
+  if (evbuffer_drain(input, layout.headerBytes) != 0 ||
+      !RemoveFromEvbuffer(input, result.hash.data(), layout.hashBytes) ||
+      !RemoveFromEvbuffer(input, result.message.data(), layout.messageBytes) ||
+      !RemoveFromEvbuffer(input, result.traceInfo.data(), layout.traceBytes)) {
+    LOG_GENERAL(WARNING, "evbuffer_remove failure.");
+    return;
+  }
 
   if (result.startByte == zil::p2p::START_BYTE_BROADCAST) {
     LOG_PAYLOAD(INFO, "Incoming broadcast " << from, result.message,
@@ -17,6 +17,8 @@
 
 #include "P2PMessage.h"
 
+#include <algorithm>
+
 #include "common/Constants.h"
 #include "libMetrics/Tracing.h"
 #include "libUtils/Logger.h"
@@ -101,19 +103,19 @@ RawMessage CreateMessage(const zbytes& message, const zbytes& msg_hash,
   return RawMessage(buf_base, buf_size_with_header);
 }
 
-ReadState TryReadMessage(const uint8_t* buf, size_t buf_size,
-                         ReadMessageResult& result) {
+ReadState TryReadMessageLayout(const uint8_t* prefix, size_t prefix_size,
+                               size_t buf_size, MessageLayout& layout) {
   auto ReadU32BE = [](const uint8_t* bytes) -> uint32_t {
     return (uint32_t(bytes[0]) << 24) + (uint32_t(bytes[1]) << 16) +
            (uint32_t(bytes[2]) << 8) + bytes[3];
   };
 
-  if (!buf || buf_size < HDR_LEN) {
+  if (!prefix || prefix_size < HDR_LEN || buf_size < prefix_size) {
     LOG_GENERAL(WARNING, "Not enough data to read message header");
     return ReadState::NOT_ENOUGH_DATA;
   }
 
-  auto version = buf[0];
+  auto version = prefix[0];
 
   // Check for version requirement
   if (version != (unsigned char)(MSG_VERSION & 0xFF) &&
@@ -125,7 +127,7 @@ ReadState TryReadMessage(const uint8_t* buf, size_t buf_size,
     return ReadState::WRONG_MSG_VERSION;
   }
 
-  const uint16_t networkid = (uint16_t(buf[1]) << 8) + buf[2];
+  const uint16_t networkid = (uint16_t(prefix[1]) << 8) + prefix[2];
   if (networkid != NETWORK_ID) {
     LOG_GENERAL(WARNING, "Header networkid wrong, received ["
                              << networkid << "] while expected [" << NETWORK_ID
@@ -133,12 +135,12 @@ ReadState TryReadMessage(const uint8_t* buf, size_t buf_size,
     return ReadState::WRONG_NETWORK_ID;
   }
 
-  result.startByte = buf[3];
+  layout.startByte = prefix[3];
 
-  uint32_t length_of_remaining_message = ReadU32BE(buf + 4);
+  uint32_t length_of_remaining_message = ReadU32BE(prefix + 4);
 
-  result.totalMessageBytes = HDR_LEN + length_of_remaining_message;
-  if (buf_size < result.totalMessageBytes) {
+  layout.totalMessageBytes = HDR_LEN + length_of_remaining_message;
+  if (buf_size < layout.totalMessageBytes) {
     return ReadState::NOT_ENOUGH_DATA;
   }
 
@@ -146,7 +148,7 @@ ReadState TryReadMessage(const uint8_t* buf, size_t buf_size,
   uint32_t msg_length = length_of_remaining_message;
   uint32_t trace_length = 0;
 
-  buf += HDR_LEN;
+  layout.headerBytes = HDR_LEN;
 
   if (version == MsgVersionWithTraces()) {
     if (length_of_remaining_message < 5) {
@@ -155,37 +157,68 @@ ReadState TryReadMessage(const uint8_t* buf, size_t buf_size,
       return ReadState::WRONG_MESSAGE_LENGTH;
     }
 
-    trace_length = ReadU32BE(buf);
+    // Whole message is available, so is the trace length
+    if (prefix_size < HDR_LEN + 4) {
+      return ReadState::NOT_ENOUGH_DATA;
+    }
+
+    trace_length = ReadU32BE(prefix + HDR_LEN);
     if (trace_length == 0 || trace_length > length_of_remaining_message - 4) {
       LOG_GENERAL(WARNING,
                   "Invalid trace info length [" << trace_length << "]");
       return ReadState::WRONG_TRACE_LENGTH;
     }
 
-    const char* trace_buf = reinterpret_cast<const char*>(
-        buf + length_of_remaining_message - trace_length);
-
-    result.traceInfo.assign(trace_buf, trace_length);
-
-    buf += 4;
+    layout.headerBytes += 4;
     msg_length -= (4 + trace_length);
   }
 
-  if (result.startByte == START_BYTE_BROADCAST) {
+  layout.hashBytes = 0;
+  if (layout.startByte == START_BYTE_BROADCAST) {
     if (msg_length < HASH_LEN) {
       LOG_GENERAL(WARNING,
                   "Invalid broadcast message length [" << msg_length << "]");
       return ReadState::WRONG_MESSAGE_LENGTH;
     }
 
-    result.hash.assign(buf, buf + HASH_LEN);
-
-    buf += HASH_LEN;
+    layout.hashBytes = HASH_LEN;
     msg_length -= HASH_LEN;
   }
 
-  if (msg_length > 0) {
-    result.message.assign(buf, buf + msg_length);
+  layout.messageBytes = msg_length;
+  layout.traceBytes = trace_length;
+
+  return ReadState::SUCCESS;
+}
+
+ReadState TryReadMessage(const uint8_t* buf, size_t buf_size,
+                         ReadMessageResult& result) {
+  MessageLayout layout;
+  auto state = TryReadMessageLayout(
+      buf, std::min(buf_size, MAX_LAYOUT_PREFIX_LEN), buf_size, layout);
+
+  result.startByte = layout.startByte;
+  result.totalMessageBytes = layout.totalMessageBytes;
+
+  if (state != ReadState::SUCCESS) {
+    return state;
+  }
+
+  buf += layout.headerBytes;
+
+  if (layout.hashBytes > 0) {
+    result.hash.assign(buf, buf + layout.hashBytes);
+    buf += layout.hashBytes;
+  }
+
+  if (layout.messageBytes > 0) {
+    result.message.assign(buf, buf + layout.messageBytes);
+    buf += layout.messageBytes;
+  }
+
+  if (layout.traceBytes > 0) {
+    result.traceInfo.assign(reinterpret_cast<const char*>(buf),
+                            layout.traceBytes);
   }
 
   return ReadState::SUCCESS;
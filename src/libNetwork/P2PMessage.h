@@ -86,6 +86,36 @@ enum class ReadState {
   WRONG_TRACE_LENGTH
 };
 
+/// Byte layout of a single wire message, as parsed from its header
+struct MessageLayout {
+  /// START_BYTE_*
+  uint8_t startByte = 0;
+
+  /// Header bytes preceding the hash or raw message (incl. trace length)
+  size_t headerBytes = 0;
+
+  /// HASH_LEN for broadcast messages, 0 otherwise
+  size_t hashBytes = 0;
+
+  /// Raw message bytes following the hash
+  size_t messageBytes = 0;
+
+  /// Trace information bytes trailing the raw message
+  size_t traceBytes = 0;
+
+  /// Total bytes consumed from wire
+  size_t totalMessageBytes = 0;
+};
+
+/// Maximum number of leading bytes TryReadMessageLayout needs to look at
+constexpr size_t MAX_LAYOUT_PREFIX_LEN = HDR_LEN + 4;
+
+/// Parses the message layout from the first min(buf_size,
+/// MAX_LAYOUT_PREFIX_LEN) bytes of the wire buffer, so that the caller can
+/// move each part out of its own buffer without linearizing it first
+ReadState TryReadMessageLayout(const uint8_t* prefix, size_t prefix_size,
+                               size_t buf_size, MessageLayout& layout);
+
 struct ReadMessageResult {
   /// START_BYTE_*
   uint8_t startByte = 0;
@@ -37,6 +37,7 @@
 #include "libNetwork/Blacklist.h"
 #include "libNetwork/Guard.h"
 #include "libPOW/pow.h"
+#include "libPersistence/StateSnapshot.h"
 #include "libRemoteStorageDB/RemoteStorageDB.h"
 #include "libServer/DedicatedWebsocketServer.h"
 #include "libServer/JSONConversion.h"
@@ -134,7 +135,8 @@ static FinalBLockProcessingVariables variables{};
 using namespace std;
 using namespace boost::multiprecision;
 
-bool Node::StoreFinalBlock(const TxBlock& txBlock) {
+bool Node::StoreFinalBlock(const TxBlock& txBlock,
+                           BlockStorage::WriteTransaction& writeTxn) {
   LOG_MARKER();
 
   AddBlock(txBlock);
@@ -150,14 +152,17 @@ bool Node::StoreFinalBlock(const TxBlock& txBlock) {
 
   LOG_GENERAL(INFO, "Storing TxBlock:" << endl << txBlock);
 
-  // Store Tx Block to disk
+  // Store Tx Block to disk in one go with the rest of the final block
   zbytes serializedTxBlock;
   txBlock.Serialize(serializedTxBlock, 0);
-  if (!BlockStorage::GetBlockStorage().PutTxBlock(txBlock.GetHeader(),
-                                                  serializedTxBlock)) {
+  if (!writeTxn.PutTxBlock(txBlock.GetHeader(), serializedTxBlock)) {
     LOG_GENERAL(WARNING, "BlockStorage::PutTxBlock failed " << txBlock);
     return false;
   }
+  if (!writeTxn.Commit()) {
+    LOG_GENERAL(WARNING, "BlockStorage::WriteTransaction::Commit failed");
+    return false;
+  }
 
   // Update average block time except when txblock is first block for the epoch
   if ((txBlock.GetHeader().GetBlockNum() % NUM_FINAL_BLOCK_PER_POW) > 0) {
@@ -1142,8 +1147,10 @@ bool Node::ProcessFinalBlockCore(uint64_t& dsBlockNumber,
     }
   }
 
-  if (!BlockStorage::GetBlockStorage().PutStateDelta(
-          txBlock.GetHeader().GetBlockNum(), stateDelta)) {
+  // Written together with the tx block in StoreFinalBlock
+  auto writeTxn = BlockStorage::GetBlockStorage().BeginWriteTransaction();
+  if (!writeTxn.PutStateDelta(txBlock.GetHeader().GetBlockNum(),
+                              stateDelta)) {
     LOG_GENERAL(WARNING, "BlockStorage::PutStateDelta failed");
     return false;
   }
@@ -1170,7 +1177,7 @@ bool Node::ProcessFinalBlockCore(uint64_t& dsBlockNumber,
   const bool& toSendPendingTxn = !(IsUnconfirmedTxnEmpty());
 
   if (!isVacuousEpoch) {
-    if (!StoreFinalBlock(txBlock)) {
+    if (!StoreFinalBlock(txBlock, writeTxn)) {
       LOG_GENERAL(WARNING, "StoreFinalBlock failed!");
       return false;
     }
@@ -1202,7 +1209,7 @@ bool Node::ProcessFinalBlockCore(uint64_t& dsBlockNumber,
     // Remove because shard nodes will be shuffled in next epoch.
     CleanMicroblockConsensusBuffer();
 
-    if (!StoreFinalBlock(txBlock)) {
+    if (!StoreFinalBlock(txBlock, writeTxn)) {
       LOG_GENERAL(WARNING, "StoreFinalBlock failed!");
       return false;
     }
@@ -1252,6 +1259,9 @@ bool Node::ProcessFinalBlockCore(uint64_t& dsBlockNumber,
                                         .GetBlockNum() +
                                     1
                              << "] FINISH WRITE STATE TO DISK");
+        StateSnapshot::OnStateCommitted(
+            m_mediator.m_dsBlockChain.GetLastBlock().GetHeader().GetBlockNum(),
+            m_mediator.m_txBlockChain.GetLastBlock());
         if (ENABLE_ACCOUNTS_POPULATING &&
             m_mediator.m_dsBlockChain.GetLastBlock().GetHeader().GetBlockNum() <
                 PREGEN_ACCOUNT_TIMES) {
@@ -1382,6 +1392,23 @@ void Node::CommitForwardedTransactions(const MBnForwardedTxnEntry& entry) {
 
     auto& cache_upd = m_mediator.m_filtersAPICache->GetUpdate();
 
+    // Store all TxBodies to disk in one batch before announcing any of them
+    auto writeTxn = BlockStorage::GetBlockStorage().BeginWriteTransaction();
+    for (const auto& twr : entry.m_transactions) {
+      zbytes serializedTxBody;
+      twr.Serialize(serializedTxBody, 0);
+      if (!writeTxn.PutTxBody(epochNum, twr.GetTransaction().GetTranID(),
+                              serializedTxBody)) {
+        LOG_GENERAL(WARNING, "BlockStorage::PutTxBody failed "
+                                 << twr.GetTransaction().GetTranID());
+        return;
+      }
+    }
+    if (!writeTxn.Commit()) {
+      LOG_GENERAL(WARNING, "BlockStorage::WriteTransaction::Commit failed");
+      return;
+    }
+
     for (const auto& twr : entry.m_transactions) {
       const auto& tran = twr.GetTransaction();
       const auto& txhash = tran.GetTranID();
@@ -1399,15 +1426,6 @@ void Node::CommitForwardedTransactions(const MBnForwardedTxnEntry& entry) {
             twr.GetTransactionReceipt().GetJsonValue()["success"].asBool());
       }
 
-      // Store TxBody to disk
-      zbytes serializedTxBody;
-      twr.Serialize(serializedTxBody, 0);
-      if (!BlockStorage::GetBlockStorage().PutTxBody(
-              epochNum, twr.GetTransaction().GetTranID(), serializedTxBody)) {
-        LOG_GENERAL(WARNING, "BlockStorage::PutTxBody failed " << txhash);
-        return;
-      }
-
       if (LOOKUP_NODE_MODE) {
         LookupServer::AddToRecentTransactions(txhash);
 
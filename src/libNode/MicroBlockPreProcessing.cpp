@@ -291,9 +291,9 @@ bool Node::OnNodeMissingTxns(const zbytes& errorMsg, const unsigned int offset,
     for (const auto& hash : missingTransactions) {
       // LOG_GENERAL(INFO, "Peer " << from << " : " << portNo << " missing txn "
       // << missingTransactions[i])
-      auto found = m_createdTxns.HashIndex.find(hash);
-      if (found != m_createdTxns.HashIndex.end()) {
-        txns.emplace_back(found->second);
+      const auto* found = m_createdTxns.find(hash);
+      if (found != nullptr) {
+        txns.emplace_back(*found);
       } else {
         LOG_GENERAL(INFO, "Leader unable to find txn in own created txns list "
                               << hash);
@@ -367,6 +367,53 @@ void Node::NotifyTimeout(bool& txnProcTimeout) {
   }
 }
 
+void Node::SpeculateCreatedTransfers(const uint64_t& microblock_gas_limit) {
+  LOG_MARKER();
+
+  // Per sender, the best-paying plain transfer for each nonce, which is the
+  // one the serial pass prefers as well.
+  map<Address, map<uint64_t, const Transaction*>> transfersBySender;
+  t_createdTxns.forEach([&transfersBySender](const Transaction& t) {
+    if (Transaction::GetTransactionType(t) != Transaction::NON_CONTRACT) {
+      return;
+    }
+    auto& best = transfersBySender[t.GetSenderAddr()][t.GetNonce()];
+    if (best == nullptr || t.GetGasPriceQa() > best->GetGasPriceQa()) {
+      best = &t;
+    }
+  });
+
+  // No more transfers than can fit in the microblock are worth running.
+  uint64_t budget = microblock_gas_limit / NORMAL_TRAN_GAS;
+  vector<vector<Transaction>> senderGroups;
+  for (const auto& sender : transfersBySender) {
+    if (budget == 0) {
+      break;
+    }
+    uint64_t expectedNonce =
+        AccountStore::GetInstance().GetNonceTemp(sender.first)
+            .convert_to<uint64_t>() +
+        1;
+    vector<Transaction> group;
+    for (const auto& entry : sender.second) {
+      if (entry.first != expectedNonce || budget == 0) {
+        break;
+      }
+      group.emplace_back(*entry.second);
+      ++expectedNonce;
+      --budget;
+    }
+    if (!group.empty()) {
+      senderGroups.emplace_back(std::move(group));
+    }
+  }
+
+  AccountStore::GetInstance().SpeculateTransfersTemp(
+      m_mediator.m_currentEpochNum, getNumShards(),
+      m_mediator.m_ds->m_mode != DirectoryService::Mode::IDLE, senderGroups,
+      m_mediator.m_validator->GetTxnExtras());
+}
+
 void Node::ProcessTransactionWhenShardLeader(
     const uint64_t& microblock_gas_limit) {
   LOG_MARKER();
@@ -377,7 +424,7 @@ void Node::ProcessTransactionWhenShardLeader(
 
   {
     lock_guard<mutex> g(m_mutexCreatedTransactions);
-    t_createdTxns = m_createdTxns;
+    t_createdTxns = m_createdTxns.snapshot();
   }
 
   map<Address, map<uint64_t, Transaction>> t_addrNonceTxnMap;
@@ -429,6 +476,10 @@ void Node::ProcessTransactionWhenShardLeader(
 
   AccountStore::GetInstance().CleanStorageRootUpdateBufferTemp();
 
+  if (ENABLE_SPECULATIVE_TXN_EXECUTION && !ARCHIVAL_LOOKUP_WITH_TX_TRACES) {
+    SpeculateCreatedTransfers(microblock_gas_limit);
+  }
+
   LOG_GENERAL(INFO, "microblock_gas_limit = " << microblock_gas_limit);
 
   while (m_gasUsedTotal < microblock_gas_limit) {
@@ -563,6 +614,7 @@ void Node::ProcessTransactionWhenShardLeader(
   LOG_GENERAL(INFO, "t_createdTxns   # txns = " << count_createdTxns);
   LOG_GENERAL(INFO, "m_gasUsedTotal         = " << m_gasUsedTotal);
 
+  AccountStore::GetInstance().ClearSpeculativeResultsTemp();
   AccountStore::GetInstance().ProcessStorageRootUpdateBufferTemp();
   AccountStore::GetInstance().CleanNewLibrariesCacheTemp();
 
@@ -625,21 +677,21 @@ bool Node::VerifyTxnsOrdering(const vector<TxnHash>& tranHashes,
               "Failed to Verify due to bad txn ordering");
 
     for (const auto& th : m_expectedTranOrdering) {
-      Transaction t;
-      if (m_createdTxns.get(th, t)) {
-        LOG_GENERAL(INFO, "Expected txn: " << t.GetTranID() << " "
-                                           << t.GetSenderAddr() << " "
-                                           << t.GetNonce() << " "
-                                           << t.GetGasPriceQa());
+      const auto* t = m_createdTxns.find(th);
+      if (t != nullptr) {
+        LOG_GENERAL(INFO, "Expected txn: " << t->GetTranID() << " "
+                                           << t->GetSenderAddr() << " "
+                                           << t->GetNonce() << " "
+                                           << t->GetGasPriceQa());
       }
     }
     for (const auto& th : tranHashes) {
-      Transaction t;
-      if (m_createdTxns.get(th, t)) {
-        LOG_GENERAL(INFO, "Received txn: " << t.GetTranID() << " "
-                                           << t.GetSenderAddr() << " "
-                                           << t.GetNonce() << " "
-                                           << t.GetGasPriceQa());
+      const auto* t = m_createdTxns.find(th);
+      if (t != nullptr) {
+        LOG_GENERAL(INFO, "Received txn: " << t->GetTranID() << " "
+                                           << t->GetSenderAddr() << " "
+                                           << t->GetNonce() << " "
+                                           << t->GetGasPriceQa());
       }
     }
 
@@ -732,6 +784,12 @@ void Node::ProcessTransactionWhenShardBackup(
 
   AccountStore::GetInstance().CleanStorageRootUpdateBufferTemp();
 
+  if (ENABLE_SPECULATIVE_TXN_EXECUTION && !ARCHIVAL_LOOKUP_WITH_TX_TRACES) {
+    // Nothing speculated for an earlier epoch may be picked up here
+    AccountStore::GetInstance().ClearSpeculativeResultsTemp();
+    SpeculateCreatedTransfers(microblock_gas_limit);
+  }
+
   LOG_GENERAL(INFO, "microblock_gas_limit = " << microblock_gas_limit);
 
   while (m_gasUsedTotal < microblock_gas_limit) {
@@ -866,6 +924,7 @@ void Node::ProcessTransactionWhenShardBackup(
   LOG_GENERAL(INFO, "t_createdTxns   # txns = " << count_createdTxns);
   LOG_GENERAL(INFO, "m_gasUsedTotal         = " << m_gasUsedTotal);
 
+  AccountStore::GetInstance().ClearSpeculativeResultsTemp();
   AccountStore::GetInstance().ProcessStorageRootUpdateBufferTemp();
   AccountStore::GetInstance().CleanNewLibrariesCacheTemp();
 
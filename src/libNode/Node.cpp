@@ -3422,13 +3422,11 @@ std::vector<Transaction> Node::GetCreatedTxns() const {
   std::vector<Transaction> txns;
   txns.reserve(m_createdTxns.size() + t_createdTxns.size());
 
-  for (const auto &[txnHash, txn] : m_createdTxns.HashIndex) {
+  const auto append = [&txns](const Transaction &txn) {
     txns.emplace_back(txn);
-  }
-
-  for (const auto &[txnHash, txn] : t_createdTxns.HashIndex) {
-    txns.emplace_back(txn);
-  }
+  };
+  m_createdTxns.forEach(append);
+  t_createdTxns.forEach(append);
 
   return txns;
 }
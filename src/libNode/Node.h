@@ -231,7 +231,9 @@ class Node : public Executable {
                                           bool& isEveryMicroBlockAvailable);
 
   // void StoreMicroBlocks();
-  bool StoreFinalBlock(const TxBlock& txBlock);
+  /// Adds the tx block to writeTxn and commits it
+  bool StoreFinalBlock(const TxBlock& txBlock,
+                       BlockStorage::WriteTransaction& writeTxn);
   void InitiatePoW();
   void ScheduleMicroBlockConsensus();
   void BeginNextConsensusRound();
@@ -642,6 +644,7 @@ class Node : public Executable {
 
   void StartTxnProcessingThread();
   void ProcessTransactionWhenShardLeader(const uint64_t& microblock_gas_limit);
+  void SpeculateCreatedTransfers(const uint64_t& microblock_gas_limit);
   void ProcessTransactionWhenShardBackup(const uint64_t& microblock_gas_limit);
   bool ComposePrePrepMicroBlock(const uint64_t& microblock_gas_limit);
   bool ComposeMicroBlock(const uint64_t& microblock_gas_limit);
@@ -16,6 +16,8 @@
  */
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <ctime>
 #include <iomanip>
@@ -24,6 +26,7 @@
 #include "common/Serializable.h"
 #include "ethash/ethash.hpp"
 #include "libCrypto/Sha2.h"
+#include "libMetrics/Api.h"
 #include "libServer/GetWorkServer.h"
 #include "libUtils/DataConversion.h"
 #include "pow.h"
@@ -50,6 +53,49 @@ size_t clz(uint8_t x) {
   auto lower = x & 0x0F;
   return upper ? clz_lookup[upper] : 4 + clz_lookup[lower];
 }
+
+// Each CPU mining thread starts 2^40 nonces after the previous one, the same
+// split used between OpenCL devices, so ranges never overlap within a window.
+constexpr uint32_t CPU_NONCE_SEGMENT_WIDTH = 40;
+
+unsigned int GetCpuMiningThreadCount() {
+  if (POW_MINE_CPU_THREADS > 0) {
+    return POW_MINE_CPU_THREADS;
+  }
+  return std::max(std::thread::hardware_concurrency(), 1U);
+}
+
+Z_I64METRIC& GetCpuHashCounter() {
+  static Z_I64METRIC counter{Z_FL::POW, "pow.cpu.hashes",
+                             "Ethash hashes computed by the CPU miner",
+                             "hashes"};
+  return counter;
+}
+
+void ReportCpuHashrate(const std::vector<uint64_t>& hashCounts,
+                       int64_t elapsedMs) {
+  if (elapsedMs <= 0) {
+    return;
+  }
+
+  uint64_t totalHashes = 0;
+  for (size_t i = 0; i < hashCounts.size(); ++i) {
+    const std::string worker = "cpu-" + std::to_string(i);
+    GetWorkServer::RecordHashrate(worker, hashCounts[i] * 1000.0 / elapsedMs);
+    if (GetCpuHashCounter().Enabled()) {
+      GetCpuHashCounter().IncrementWithAttributes(hashCounts[i],
+                                                  {{"worker", worker}});
+    }
+    totalHashes += hashCounts[i];
+  }
+
+  const double totalRate = totalHashes * 1000.0 / elapsedMs;
+  GetWorkServer::RecordHashrate("cpu", totalRate);
+  LOG_GENERAL(INFO, "CPU mining computed " << totalHashes << " hashes on "
+                                           << hashCounts.size()
+                                           << " threads in " << elapsedMs
+                                           << " ms (" << totalRate << " H/s)");
+}
 }  // namespace
 
 POW::POW() {
@@ -287,72 +333,97 @@ ethash_mining_result_t POW::MineGetWork(uint64_t blockNum,
   return result;
 }
 
-ethash_mining_result_t POW::MineLight(ethash_hash256 const& headerHash,
-                                      ethash_hash256 const& boundary,
-                                      uint64_t startNonce, int timeWindow) {
-  uint64_t nonce = startNonce;
-  auto startTime = std::chrono::high_resolution_clock::now();
+template <typename EpochContext>
+ethash_mining_result_t POW::MineCpu(const EpochContext& context,
+                                    ethash_hash256 const& headerHash,
+                                    ethash_hash256 const& boundary,
+                                    uint64_t startNonce, int timeWindow) {
+  const unsigned int numThreads = GetCpuMiningThreadCount();
+  const uint64_t batchSize = std::max(POW_MINE_CPU_BATCH_SIZE, 1U);
+  const auto lightContext = m_epochContextLight;
+  const auto startTime = std::chrono::steady_clock::now();
+
+  std::atomic<bool> found{false};
+  std::atomic<bool> timedOut{false};
+  ethash_mining_result_t winningResult{"", "", 0, false};
+  std::vector<uint64_t> hashCounts(numThreads, 0);
+
+  auto mine = [&](unsigned int index) {
+    uint64_t nonce = startNonce + (static_cast<uint64_t>(index)
+                                   << CPU_NONCE_SEGMENT_WIDTH);
+    uint64_t hashes = 0;
+
+    while (m_shouldMine && !found) {
+      for (uint64_t i = 0; i < batchSize; ++i, ++nonce) {
+        if (!m_shouldMine.load(std::memory_order_relaxed) ||
+            found.load(std::memory_order_relaxed)) {
+          break;
+        }
+
+        auto mineResult = ethash::hash(context, headerHash, nonce);
+        ++hashes;
+        // The full dataset is filled lazily by whichever thread touches an
+        // item first, so confirm a candidate against the light cache before
+        // trusting it
+        if (ethash::is_less_or_equal(mineResult.final_hash, boundary) &&
+            ethash::verify(*lightContext, headerHash, mineResult.mix_hash,
+                           nonce, boundary)) {
+          // Only the first finder publishes, everyone else sees found set
+          if (!found.exchange(true)) {
+            winningResult = {BlockhashToHexString(mineResult.final_hash),
+                             BlockhashToHexString(mineResult.mix_hash), nonce,
+                             true};
+          }
+          break;
+        }
+      }
 
-  while (m_shouldMine) {
-    auto mineResult = ethash::hash(*m_epochContextLight, headerHash, nonce);
-    if (ethash::is_less_or_equal(mineResult.final_hash, boundary)) {
-      ethash_mining_result_t winning_result = {
-          BlockhashToHexString(mineResult.final_hash),
-          BlockhashToHexString(mineResult.mix_hash), nonce, true};
-      return winning_result;
+      if (std::chrono::steady_clock::now() - startTime >
+          std::chrono::seconds(timeWindow)) {
+        timedOut = true;
+        break;
+      }
     }
-    nonce++;
 
-    auto currentTime = std::chrono::high_resolution_clock::now();
-    auto timePassedInSeconds = std::chrono::duration_cast<std::chrono::seconds>(
-                                   currentTime - startTime)
-                                   .count();
-    if (timePassedInSeconds > timeWindow) {
-      LOG_GENERAL(WARNING,
-                  "Time out while mining pow result, time "
-                  "passed in seconds "
-                      << timePassedInSeconds << ", time window " << timeWindow);
-      m_shouldMine = false;
-      break;
-    }
+    hashCounts[index] = hashes;
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(numThreads - 1);
+  for (unsigned int i = 1; i < numThreads; ++i) {
+    workers.emplace_back(mine, i);
+  }
+  mine(0);
+  for (auto& worker : workers) {
+    worker.join();
   }
 
-  ethash_mining_result_t failure_result = {"", "", 0, false};
-  return failure_result;
+  const auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                             std::chrono::steady_clock::now() - startTime)
+                             .count();
+  ReportCpuHashrate(hashCounts, elapsedMs);
+
+  if (!found && timedOut) {
+    LOG_GENERAL(WARNING, "Time out while mining pow result, time passed in ms "
+                             << elapsedMs << ", time window " << timeWindow);
+    m_shouldMine = false;
+  }
+
+  return winningResult;
+}
+
+ethash_mining_result_t POW::MineLight(ethash_hash256 const& headerHash,
+                                      ethash_hash256 const& boundary,
+                                      uint64_t startNonce, int timeWindow) {
+  return MineCpu(*m_epochContextLight, headerHash, boundary, startNonce,
+                 timeWindow);
 }
 
 ethash_mining_result_t POW::MineFull(ethash_hash256 const& headerHash,
                                      ethash_hash256 const& boundary,
                                      uint64_t startNonce, int timeWindow) {
-  uint64_t nonce = startNonce;
-  auto startTime = std::chrono::high_resolution_clock::now();
-
-  while (m_shouldMine) {
-    auto mineResult = ethash::hash(*m_epochContextFull, headerHash, nonce);
-    if (ethash::is_less_or_equal(mineResult.final_hash, boundary)) {
-      ethash_mining_result_t winning_result = {
-          BlockhashToHexString(mineResult.final_hash),
-          BlockhashToHexString(mineResult.mix_hash), nonce, true};
-      return winning_result;
-    }
-    nonce++;
-
-    auto currentTime = std::chrono::high_resolution_clock::now();
-    auto timePassedInSeconds = std::chrono::duration_cast<std::chrono::seconds>(
-                                   currentTime - startTime)
-                                   .count();
-    if (timePassedInSeconds > timeWindow) {
-      LOG_GENERAL(WARNING,
-                  "Time out while mining pow result, time "
-                  "passed in seconds "
-                      << timePassedInSeconds << ", time window " << timeWindow);
-      m_shouldMine = false;
-      break;
-    }
-  }
-
-  ethash_mining_result_t failure_result = {"", "", 0, false};
-  return failure_result;
+  return MineCpu(*m_epochContextFull, headerHash, boundary, startNonce,
+                 timeWindow);
 }
 
 ethash_mining_result_t POW::MineFullGPU(uint64_t blockNum,
@@ -817,7 +888,31 @@ bool POW::PoWVerify(uint64_t blockNum, uint8_t difficulty,
                     const std::string& winning_result,
                     const std::string& winning_mixhash) {
   LOG_MARKER();
+  return PoWVerify(*GetLightEpochContext(blockNum), difficulty, headerHash,
+                   winning_nonce, winning_result, winning_mixhash);
+}
+
+std::shared_ptr<ethash::epoch_context> POW::GetLightEpochContext(
+    uint64_t blockNum) {
+  // Within an epoch this only hands out the context already held, the client
+  // is reconfigured once the block number moves to another epoch
+  {
+    std::lock_guard<std::mutex> g(m_mutexLightClientConfigure);
+    if (m_epochContextLight && m_epochContextLight->epoch_number ==
+                                   ethash::get_epoch_number(blockNum)) {
+      return m_epochContextLight;
+    }
+  }
+
   EthashConfigureClient(blockNum);
+  std::lock_guard<std::mutex> g(m_mutexLightClientConfigure);
+  return m_epochContextLight;
+}
+
+bool POW::PoWVerify(const ethash::epoch_context& context, uint8_t difficulty,
+                    const ethash_hash256& headerHash, uint64_t winning_nonce,
+                    const std::string& winning_result,
+                    const std::string& winning_mixhash) {
   const auto boundary = DifficultyLevelInIntDevided(difficulty);
   auto winnning_result = StringToBlockhash(winning_result);
   auto winningMixhash = StringToBlockhash(winning_mixhash);
@@ -827,8 +922,8 @@ bool POW::PoWVerify(uint64_t blockNum, uint8_t difficulty,
     return false;
   }
 
-  return ethash::verify(*m_epochContextLight, headerHash, winningMixhash,
-                        winning_nonce, boundary);
+  return ethash::verify(context, headerHash, winningMixhash, winning_nonce,
+                        boundary);
 }
 
 ethash::result POW::LightHash(uint64_t blockNum,
@@ -92,6 +92,19 @@ class POW {
                  const ethash_hash256& headerHash, uint64_t winning_nonce,
                  const std::string& winning_result,
                  const std::string& winning_mixhash);
+
+  /// Returns the light epoch context for the specified block number, so that
+  /// callers verifying many submissions for one block can share it.
+  std::shared_ptr<ethash::epoch_context> GetLightEpochContext(
+      uint64_t blockNum);
+
+  /// Verifies a proof-of-work submission against an epoch context obtained
+  /// from GetLightEpochContext.
+  static bool PoWVerify(const ethash::epoch_context& context,
+                        uint8_t difficulty, const ethash_hash256& headerHash,
+                        uint64_t winning_nonce,
+                        const std::string& winning_result,
+                        const std::string& winning_mixhash);
   static zbytes ConcatAndhash(
       const std::array<unsigned char, UINT256_SIZE>& rand1,
       const std::array<unsigned char, UINT256_SIZE>& rand2, const Peer& peer,
@@ -147,6 +160,13 @@ class POW {
   ethash_mining_result_t MineFull(ethash_hash256 const& headerHash,
                                   ethash_hash256 const& boundary,
                                   uint64_t startNonce, int timeWindow);
+  /// Mines on POW_MINE_CPU_THREADS threads, each owning a disjoint nonce
+  /// range, until one of them finds a solution or the time window expires.
+  template <typename EpochContext>
+  ethash_mining_result_t MineCpu(const EpochContext& context,
+                                 ethash_hash256 const& headerHash,
+                                 ethash_hash256 const& boundary,
+                                 uint64_t startNonce, int timeWindow);
   ethash_mining_result_t MineGetWork(uint64_t blockNum,
                                      ethash_hash256 const& headerHash,
                                      uint8_t difficulty, int timeWindow);
@@ -22,8 +22,6 @@
 #include <iostream>
 #include <string>
 
-#include <boost/lexical_cast.hpp>
-
 #include "BlockStorage.h"
 #include "common/Constants.h"
 #include "common/Serializable.h"
@@ -40,6 +38,34 @@ constexpr int TX_TRACES_TO_STORE = 30 * 1024;
 
 using namespace std;
 
+namespace {
+
+// Keys of the event log index are a one-byte record type followed by the
+// big-endian epoch (or section) number, so that they sort numerically
+const char EVENT_LOGS_KEY_PREFIX = 'l';
+const char EVENT_LOGS_BLOOM_KEY_PREFIX = 'b';
+const char EVENT_LOGS_SECTION_KEY_PREFIX = 's';
+
+std::string EventLogsKey(char prefix, uint64_t number) {
+  std::string key(1 + sizeof(uint64_t), prefix);
+  for (size_t i = sizeof(uint64_t); i > 0; --i) {
+    key[i] = static_cast<char>(number & 0xFF);
+    number >>= 8;
+  }
+  return key;
+}
+
+bool BloomFromString(const std::string& value, dev::h2048& bloom) {
+  if (value.size() != dev::h2048::size) {
+    return false;
+  }
+  bloom = dev::h2048(reinterpret_cast<const zbyte*>(value.data()),
+                     dev::h2048::ConstructFromPointerType::ConstructFromPointer);
+  return true;
+}
+
+}  // namespace
+
 BlockStorage& BlockStorage::GetBlockStorage(const std::string& path,
                                             bool diagnostic) {
   static BlockStorage bs(path, diagnostic);
@@ -77,6 +103,7 @@ void BlockStorage::Initialize(const std::string& path, bool diagnostic) {
     m_minerInfoShardsDB = std::make_shared<LevelDB>("minerInfoShards");
     m_extSeedPubKeysDB = std::make_shared<LevelDB>("extSeedPubKeys");
     m_contractCreatorDB = std::make_shared<LevelDB>("contractCreators");
+    m_eventLogDB = std::make_shared<LevelDB>("eventLogs");
   }
   m_microBlockDBs.emplace_back(std::make_shared<LevelDB>("microBlocks"));
 }
@@ -241,6 +268,196 @@ bool BlockStorage::PutMicroBlock(const BlockHash& blockHash,
   return true;
 }
 
+bool BlockStorage::WriteTransaction::PutTxBlock(const TxBlockHeader& header,
+                                               const zbytes& body) {
+  const uint64_t blockNum = header.GetBlockNum();
+
+  auto span = zil::trace::Tracing::CreateChildSpanOfRemoteTrace(
+      zil::trace::FilterClass::BLOCKCHAIN, "Block",
+      TracedIds::GetInstance().GetCurrentEpochSpanIds());
+  span.SetAttribute("block.type", "Tx");
+  span.SetAttribute("block.num", blockNum);
+  const auto blockNumStr = std::to_string(blockNum);
+
+  m_txBlockBatch.Put(m_storage.m_txBlockchainDB->BlockNumKey(blockNum),
+                     leveldb::Slice(reinterpret_cast<const char*>(body.data()),
+                                    body.size()));
+  m_txBlockHashToNumBatch.Put(
+      leveldb::Slice(reinterpret_cast<const char*>(header.GetMyHash().data()),
+                     BlockHash::size),
+      blockNumStr);
+  m_txBlockAuxBatch.Put(MAX_TX_BLOCK_NUM_KEY, blockNumStr);
+  m_hasTxBlock = true;
+  return true;
+}
+
+bool BlockStorage::WriteTransaction::PutMicroBlock(const BlockHash& blockHash,
+                                                  const uint64_t& epochNum,
+                                                  const uint32_t& shardID,
+                                                  const zbytes& body) {
+  zbytes key;
+  if (!Messenger::SetMicroBlockKey(key, 0, epochNum, shardID)) {
+    LOG_GENERAL(WARNING, "Messenger::SetMicroBlockKey failed.");
+    return false;
+  }
+
+  auto span = zil::trace::Tracing::CreateChildSpanOfRemoteTrace(
+      zil::trace::FilterClass::BLOCKCHAIN, "Block",
+      TracedIds::GetInstance().GetCurrentEpochSpanIds());
+  span.SetAttribute("block.type", "MicroBlock");
+  span.SetAttribute("block.hash", blockHash.hex());
+
+  const leveldb::Slice keySlice(reinterpret_cast<const char*>(key.data()),
+                                key.size());
+  m_microBlockBatches[epochNum / NUM_EPOCHS_PER_PERSISTENT_DB].Put(
+      keySlice, leveldb::Slice(reinterpret_cast<const char*>(body.data()),
+                               body.size()));
+  m_microBlockKeyBatch.Put(blockHash.hex(), keySlice);
+  m_numMicroBlocks++;
+  return true;
+}
+
+bool BlockStorage::WriteTransaction::PutTxBody(const uint64_t& epochNum,
+                                              const dev::h256& key,
+                                              const zbytes& body) {
+  if (!LOOKUP_NODE_MODE) {
+    LOG_GENERAL(WARNING, "Non lookup node should not trigger this.");
+    return false;
+  }
+
+  zbytes epoch;
+  if (!Messenger::SetTxEpoch(epoch, 0, epochNum)) {
+    LOG_GENERAL(WARNING, "Messenger::SetTxEpoch failed.");
+    return false;
+  }
+
+  const leveldb::Slice keySlice(reinterpret_cast<const char*>(key.data()),
+                                dev::h256::size);
+  m_txBodyBatches[epochNum / NUM_EPOCHS_PER_PERSISTENT_DB].Put(
+      keySlice, leveldb::Slice(reinterpret_cast<const char*>(body.data()),
+                               body.size()));
+  m_txEpochBatch.Put(keySlice,
+                     leveldb::Slice(reinterpret_cast<const char*>(epoch.data()),
+                                    epoch.size()));
+  m_numTxBodies++;
+  return true;
+}
+
+bool BlockStorage::WriteTransaction::PutStateDelta(const uint64_t& finalBlockNum,
+                                                  const zbytes& stateDelta) {
+  m_stateDeltaBatch.Put(
+      m_storage.m_stateDeltaDB->BlockNumKey(finalBlockNum),
+      leveldb::Slice(reinterpret_cast<const char*>(stateDelta.data()),
+                     stateDelta.size()));
+  m_hasStateDelta = true;
+  return true;
+}
+
+void BlockStorage::WriteTransaction::Clear() {
+  m_txBodyBatches.clear();
+  m_txEpochBatch.Clear();
+  m_microBlockBatches.clear();
+  m_microBlockKeyBatch.Clear();
+  m_stateDeltaBatch.Clear();
+  m_txBlockBatch.Clear();
+  m_txBlockHashToNumBatch.Clear();
+  m_txBlockAuxBatch.Clear();
+  m_numTxBodies = 0;
+  m_numMicroBlocks = 0;
+  m_hasStateDelta = false;
+  m_hasTxBlock = false;
+}
+
+bool BlockStorage::WriteTransaction::Commit() {
+  LOG_MARKER();
+
+  size_t remaining = m_txBodyBatches.size() + (m_numTxBodies > 0 ? 1 : 0) +
+                     m_microBlockBatches.size() +
+                     (m_numMicroBlocks > 0 ? 1 : 0) +
+                     (m_hasStateDelta ? 1 : 0) + (m_hasTxBlock ? 3 : 0);
+
+  // Every write but the last one is left to the OS to flush
+  const auto write = [&remaining](LevelDB& db, leveldb::WriteBatch& batch) {
+    return db.BatchWrite(batch, --remaining == 0);
+  };
+
+  const auto commit = [&]() {
+    // Bodies are written before the indexes that point at them
+    if (m_numTxBodies > 0) {
+      lock_guard<mutex> g(m_storage.m_mutexTxBody);
+
+      if (!m_storage.m_txEpochDB) {
+        LOG_GENERAL(
+            WARNING,
+            "Attempt to access non initialized DB! Are you in lookup mode? ");
+        return false;
+      }
+
+      for (auto& [dbindex, batch] : m_txBodyBatches) {
+        if (!write(*m_storage.GetTxBodyDB(uint64_t(dbindex) *
+                                          NUM_EPOCHS_PER_PERSISTENT_DB),
+                   batch)) {
+          LOG_GENERAL(WARNING, "TxBody batch insertion failed");
+          return false;
+        }
+      }
+
+      if (!write(*m_storage.m_txEpochDB, m_txEpochBatch)) {
+        LOG_GENERAL(WARNING, "TxBody epoch batch insertion failed");
+        return false;
+      }
+    }
+
+    if (m_numMicroBlocks > 0) {
+      lock_guard<mutex> g(m_storage.m_mutexMicroBlock);
+
+      for (auto& [dbindex, batch] : m_microBlockBatches) {
+        if (!write(*m_storage.GetMicroBlockDB(uint64_t(dbindex) *
+                                              NUM_EPOCHS_PER_PERSISTENT_DB),
+                   batch)) {
+          LOG_GENERAL(WARNING, "Microblock body batch insertion failed");
+          return false;
+        }
+      }
+
+      if (!write(*m_storage.m_microBlockKeyDB, m_microBlockKeyBatch)) {
+        LOG_GENERAL(WARNING, "Microblock key batch insertion failed");
+        return false;
+      }
+    }
+
+    if (m_hasStateDelta) {
+      unique_lock<shared_timed_mutex> g(m_storage.m_mutexStateDelta);
+      if (!write(*m_storage.m_stateDeltaDB, m_stateDeltaBatch)) {
+        LOG_GENERAL(WARNING, "Failed to store state delta");
+        return false;
+      }
+    }
+
+    // The Tx block and its latest-block marker go last
+    if (m_hasTxBlock) {
+      unique_lock<shared_timed_mutex> g(m_storage.m_mutexTxBlockchain);
+      if (!write(*m_storage.m_txBlockchainDB, m_txBlockBatch) ||
+          !write(*m_storage.m_txBlockHashToNumDB, m_txBlockHashToNumBatch) ||
+          !write(*m_storage.m_txBlockchainAuxDB, m_txBlockAuxBatch)) {
+        LOG_GENERAL(WARNING, "Failed to store Tx block");
+        return false;
+      }
+    }
+
+    return true;
+  };
+
+  const bool result = commit();
+  if (result) {
+    LOG_GENERAL(INFO, "Stored " << m_numTxBodies << " txn bodies, "
+                                << m_numMicroBlocks << " microblocks"
+                                << (m_hasTxBlock ? " and Tx block" : ""));
+  }
+  Clear();
+  return result;
+}
+
 bool BlockStorage::GetMicroBlock(const BlockHash& blockHash,
                                  MicroBlockSharedPtr& microblock) {
   string blockString;
@@ -343,6 +560,42 @@ bool BlockStorage::GetRangeMicroBlocks(const uint64_t lowEpochNum,
   return true;
 }
 
+bool BlockStorage::GetRangeDSBlocks(const uint64_t lowBlockNum,
+                                    const uint64_t hiBlockNum,
+                                    vector<DSBlockSharedPtr>& blocks) {
+  shared_lock<shared_timed_mutex> g(m_mutexDsBlockchain);
+
+  m_dsBlockchainDB->ForEachBlockInRange(
+      lowBlockNum, hiBlockNum,
+      [&blocks](uint64_t, const leveldb::Slice& value) {
+        auto block = std::make_shared<DSBlock>();
+        block->Deserialize(
+            zbytes(value.data(), value.data() + value.size()), 0);
+        blocks.emplace_back(std::move(block));
+        return true;
+      });
+
+  return !blocks.empty();
+}
+
+bool BlockStorage::GetRangeTxBlocks(const uint64_t lowBlockNum,
+                                    const uint64_t hiBlockNum,
+                                    vector<TxBlockSharedPtr>& blocks) {
+  shared_lock<shared_timed_mutex> g(m_mutexTxBlockchain);
+
+  m_txBlockchainDB->ForEachBlockInRange(
+      lowBlockNum, hiBlockNum,
+      [&blocks](uint64_t, const leveldb::Slice& value) {
+        auto block = std::make_shared<TxBlock>();
+        block->Deserialize(
+            zbytes(value.data(), value.data() + value.size()), 0);
+        blocks.emplace_back(std::move(block));
+        return true;
+      });
+
+  return !blocks.empty();
+}
+
 bool BlockStorage::GetDSBlock(const uint64_t& blockNum,
                               DSBlockSharedPtr& block) {
   string blockString;
@@ -516,7 +769,10 @@ bool BlockStorage::GetLatestTxBlock(TxBlockSharedPtr& block) {
     std::unique_ptr<leveldb::Iterator> it{
         m_txBlockchainDB->GetDB()->NewIterator(leveldb::ReadOptions())};
     for (it->SeekToFirst(); it->Valid(); it->Next()) {
-      uint64_t blockNum = boost::lexical_cast<uint64_t>(it->key().ToString());
+      uint64_t blockNum = 0;
+      if (!LevelDB::ParseBlockNumKey(it->key(), blockNum)) {
+        continue;
+      }
       if (blockNum > latestTxBlockNum) {
         latestTxBlockNum = blockNum;
       }
@@ -772,7 +1028,6 @@ bool BlockStorage::GetAllDSBlocks(std::list<DSBlockSharedPtr>& blocks) {
   std::unique_ptr<leveldb::Iterator> it{
       m_dsBlockchainDB->GetDB()->NewIterator(leveldb::ReadOptions())};
   for (it->SeekToFirst(); it->Valid(); it->Next()) {
-    string bns = it->key().ToString();
     string blockString = it->value().ToString();
     if (blockString.empty()) {
       LOG_GENERAL(WARNING, "Lost one block in the chain");
@@ -782,7 +1037,8 @@ bool BlockStorage::GetAllDSBlocks(std::list<DSBlockSharedPtr>& blocks) {
     auto block = std::make_shared<DSBlock>();
     block->Deserialize(zbytes(blockString.begin(), blockString.end()), 0);
     blocks.emplace_back(block);
-    LOG_GENERAL(INFO, "Retrievd DsBlock Num:" << bns);
+    LOG_GENERAL(INFO,
+                "Retrievd DsBlock Num:" << block->GetHeader().GetBlockNum());
   }
 
   if (blocks.empty()) {
@@ -965,7 +1221,8 @@ bool BlockStorage::GetAllBlockLink(std::list<BlockLink>& blocklinks) {
   std::unique_ptr<leveldb::Iterator> it{
       m_blockLinkDB->GetDB()->NewIterator(leveldb::ReadOptions())};
   for (it->SeekToFirst(); it->Valid(); it->Next()) {
-    string bns = it->key().ToString();
+    uint64_t bns = 0;
+    LevelDB::ParseBlockNumKey(it->key(), bns);
     string blockString = it->value().ToString();
     if (blockString.empty()) {
       LOG_GENERAL(WARNING, "Lost one blocklink in the chain");
@@ -1423,11 +1680,12 @@ void BlockStorage::GetDiagnosticDataNodes(
     }
 
     uint64_t dsBlockNum = 0;
-    try {
-      dsBlockNum = stoull(dsBlockNumStr);
-    } catch (...) {
+    if (!LevelDB::ParseBlockNumKey(it->key(), dsBlockNum)) {
+      // The key may be binary, so log it as hex
+      std::string keyHex;
+      DataConversion::StringToHexStr(dsBlockNumStr, keyHex);
       LOG_GENERAL(WARNING,
-                  "Non-numeric key " << dsBlockNumStr << " at index " << index);
+                  "Non-numeric key " << keyHex << " at index " << index);
       continue;
     }
 
@@ -1443,7 +1701,7 @@ void BlockStorage::GetDiagnosticDataNodes(
       LOG_GENERAL(
           WARNING,
           "Messenger::GetDiagnosticDataNodes failed for DS block number "
-              << dsBlockNumStr << " at index " << index);
+              << dsBlockNum << " at index " << index);
       continue;
     }
 
@@ -1486,11 +1744,12 @@ void BlockStorage::GetDiagnosticDataCoinbase(
     }
 
     uint64_t dsBlockNum = 0;
-    try {
-      dsBlockNum = stoull(dsBlockNumStr);
-    } catch (...) {
+    if (!LevelDB::ParseBlockNumKey(it->key(), dsBlockNum)) {
+      // The key may be binary, so log it as hex
+      std::string keyHex;
+      DataConversion::StringToHexStr(dsBlockNumStr, keyHex);
       LOG_GENERAL(WARNING,
-                  "Non-numeric key " << dsBlockNumStr << " at index " << index);
+                  "Non-numeric key " << keyHex << " at index " << index);
       continue;
     }
 
@@ -1502,7 +1761,7 @@ void BlockStorage::GetDiagnosticDataCoinbase(
       LOG_GENERAL(
           WARNING,
           "Messenger::GetDiagnosticDataCoinbase failed for DS block number "
-              << dsBlockNumStr << " at index " << index);
+              << dsBlockNum << " at index " << index);
       continue;
     }
 
@@ -1670,6 +1929,82 @@ dev::h256 BlockStorage::GetContractCreator(const dev::h160 address) {
   return dev::h256(reinterpret_cast<const unsigned char*>(m_contractCreatorDB->Lookup(address.asBytes()).c_str()), dev::h256::ConstructFromPointerType::ConstructFromPointer);
 }
 
+bool BlockStorage::PutEventLogs(const uint64_t& epochNum,
+                                const dev::h2048& bloom,
+                                const std::string& logs) {
+  if (!m_eventLogDB) {
+    LOG_GENERAL(
+        WARNING,
+        "Attempt to access non initialized DB! Are you in lookup mode? ");
+    return false;
+  }
+
+  if (EVENT_LOG_INDEX_SECTION_SIZE == 0) {
+    LOG_GENERAL(WARNING, "EVENT_LOG_INDEX_SECTION_SIZE must not be zero");
+    return false;
+  }
+
+  const auto sectionKey = EventLogsKey(EVENT_LOGS_SECTION_KEY_PREFIX,
+                                       epochNum / EVENT_LOG_INDEX_SECTION_SIZE);
+
+  unique_lock<shared_timed_mutex> g(m_mutexEventLogs);
+
+  dev::h2048 sectionBloom;
+  BloomFromString(m_eventLogDB->Lookup(sectionKey), sectionBloom);
+  sectionBloom |= bloom;
+
+  const auto bloomBytes = bloom.asBytes();
+  const auto sectionBytes = sectionBloom.asBytes();
+
+  // All three records go into the same write batch
+  const std::unordered_map<std::string, std::string> batch{
+      {EventLogsKey(EVENT_LOGS_KEY_PREFIX, epochNum), logs},
+      {EventLogsKey(EVENT_LOGS_BLOOM_KEY_PREFIX, epochNum),
+       std::string(bloomBytes.begin(), bloomBytes.end())},
+      {sectionKey, std::string(sectionBytes.begin(), sectionBytes.end())}};
+
+  if (!m_eventLogDB->BatchInsert(batch)) {
+    LOG_GENERAL(WARNING, "Failed to store event logs for epoch " << epochNum);
+    return false;
+  }
+
+  return true;
+}
+
+bool BlockStorage::GetEventLogsBloom(const uint64_t& epochNum,
+                                     dev::h2048& bloom) {
+  if (!m_eventLogDB) {
+    return false;
+  }
+
+  shared_lock<shared_timed_mutex> g(m_mutexEventLogs);
+  return BloomFromString(m_eventLogDB->Lookup(EventLogsKey(
+                             EVENT_LOGS_BLOOM_KEY_PREFIX, epochNum)),
+                         bloom);
+}
+
+bool BlockStorage::GetEventLogsSectionBloom(const uint64_t& section,
+                                            dev::h2048& bloom) {
+  if (!m_eventLogDB) {
+    return false;
+  }
+
+  shared_lock<shared_timed_mutex> g(m_mutexEventLogs);
+  return BloomFromString(m_eventLogDB->Lookup(EventLogsKey(
+                             EVENT_LOGS_SECTION_KEY_PREFIX, section)),
+                         bloom);
+}
+
+bool BlockStorage::GetEventLogs(const uint64_t& epochNum, std::string& logs) {
+  if (!m_eventLogDB) {
+    return false;
+  }
+
+  shared_lock<shared_timed_mutex> g(m_mutexEventLogs);
+  logs = m_eventLogDB->Lookup(EventLogsKey(EVENT_LOGS_KEY_PREFIX, epochNum));
+  return !logs.empty();
+}
+
 bool BlockStorage::ResetDB(DBTYPE type) {
   LOG_MARKER();
   bool ret = false;
@@ -1782,6 +2117,11 @@ bool BlockStorage::ResetDB(DBTYPE type) {
       ret = m_extSeedPubKeysDB->ResetDB();
       break;
     }
+    case EVENT_LOGS: {
+      unique_lock<shared_timed_mutex> g(m_mutexEventLogs);
+      ret = m_eventLogDB->ResetDB();
+      break;
+    }
   }
   if (!ret) {
     LOG_GENERAL(INFO, "FAIL: Reset DB " << type << " failed");
@@ -1899,6 +2239,11 @@ bool BlockStorage::RefreshDB(DBTYPE type) {
       ret = m_extSeedPubKeysDB->RefreshDB();
       break;
     }
+    case EVENT_LOGS: {
+      unique_lock<shared_timed_mutex> g(m_mutexEventLogs);
+      ret = m_eventLogDB->RefreshDB();
+      break;
+    }
   }
   if (!ret) {
     LOG_GENERAL(INFO, "FAIL: Refresh DB " << type << " failed");
@@ -1944,7 +2289,8 @@ bool BlockStorage::ResetAll() {
            PROCESSED_TEMP,
            MINER_INFO_DSCOMM,
            MINER_INFO_SHARDS,
-           EXTSEED_PUBKEYS};
+           EXTSEED_PUBKEYS,
+           EVENT_LOGS};
   }
 
   auto result = true;
@@ -1995,7 +2341,8 @@ bool BlockStorage::RefreshAll() {
            PROCESSED_TEMP,
            MINER_INFO_DSCOMM,
            MINER_INFO_SHARDS,
-           EXTSEED_PUBKEYS};
+           EXTSEED_PUBKEYS,
+           EVENT_LOGS};
   }
 
   auto result = true;
@@ -19,11 +19,13 @@
 #define ZILLIQA_SRC_LIBPERSISTENCE_BLOCKSTORAGE_H_
 
 #include <list>
+#include <map>
 #include <mutex>
 #include <shared_mutex>
 #include <vector>
 
 #include <Schnorr.h>
+#include <leveldb/write_batch.h>
 #include "libBlockchain/Block.h"
 #include "libData/AccountData/Address.h"
 #include "libData/MiningData/MinerInfo.h"
@@ -113,6 +115,8 @@ class BlockStorage : boost::noncopyable {
   std::shared_ptr<LevelDB> m_extSeedPubKeysDB;
   /// stores the hash of the transaction which created a contract
   std::shared_ptr<LevelDB> m_contractCreatorDB;
+  /// event logs and their blooms, indexed by TX epoch, for eth_getLogs
+  std::shared_ptr<LevelDB> m_eventLogDB;
 
   BlockStorage(const std::string& path = "", bool diagnostic = false)
       : m_diagnosticDBNodesCounter(0), m_diagnosticDBCoinbaseCounter(0) {
@@ -142,7 +146,8 @@ class BlockStorage : boost::noncopyable {
     MINER_INFO_SHARDS,
     EXTSEED_PUBKEYS,
     TX_BLOCK_HASH_TO_NUM,
-    TX_BLOCK_AUX
+    TX_BLOCK_AUX,
+    EVENT_LOGS
   };
 
   /// Returns the singleton BlockStorage instance.
@@ -169,6 +174,47 @@ class BlockStorage : boost::noncopyable {
 
   bool PutProcessedTxBodyTmp(const dev::h256& key, const zbytes& body);
 
+  /// Gathers the writes of one final block into one write batch per
+  /// database. Nothing is stored until Commit(), which writes bodies before
+  /// the records that index them, so a crash midway never leaves a block
+  /// pointing at missing data. Only the last write is synced to disk.
+  class WriteTransaction {
+   public:
+    bool PutTxBlock(const TxBlockHeader& header, const zbytes& body);
+    bool PutMicroBlock(const BlockHash& blockHash, const uint64_t& epochNum,
+                       const uint32_t& shardID, const zbytes& body);
+    bool PutTxBody(const uint64_t& epochNum, const dev::h256& key,
+                   const zbytes& body);
+    bool PutStateDelta(const uint64_t& finalBlockNum, const zbytes& stateDelta);
+
+    /// Writes all gathered batches. The transaction is empty afterwards.
+    bool Commit();
+
+   private:
+    friend class BlockStorage;
+    explicit WriteTransaction(BlockStorage& storage) : m_storage(storage) {}
+
+    void Clear();
+
+    BlockStorage& m_storage;
+    // Keyed by the index of the per-epoch-range database
+    std::map<unsigned int, leveldb::WriteBatch> m_txBodyBatches;
+    leveldb::WriteBatch m_txEpochBatch;
+    std::map<unsigned int, leveldb::WriteBatch> m_microBlockBatches;
+    leveldb::WriteBatch m_microBlockKeyBatch;
+    leveldb::WriteBatch m_stateDeltaBatch;
+    leveldb::WriteBatch m_txBlockBatch;
+    leveldb::WriteBatch m_txBlockHashToNumBatch;
+    leveldb::WriteBatch m_txBlockAuxBatch;
+    size_t m_numTxBodies{0};
+    size_t m_numMicroBlocks{0};
+    bool m_hasStateDelta{false};
+    bool m_hasTxBlock{false};
+  };
+
+  /// Starts a batched write of one final block.
+  WriteTransaction BeginWriteTransaction() { return WriteTransaction(*this); }
+
   /// Retrieves the requested DS block.
   bool GetDSBlock(const uint64_t& blockNum, DSBlockSharedPtr& block);
 
@@ -199,6 +245,14 @@ class BlockStorage : boost::noncopyable {
                            const uint32_t hiShardId,
                            std::list<MicroBlockSharedPtr>& blocks);
 
+  /// Retrieves the DS blocks in [lowBlockNum, hiBlockNum] in ascending order
+  bool GetRangeDSBlocks(const uint64_t lowBlockNum, const uint64_t hiBlockNum,
+                        std::vector<DSBlockSharedPtr>& blocks);
+
+  /// Retrieves the Tx blocks in [lowBlockNum, hiBlockNum] in ascending order
+  bool GetRangeTxBlocks(const uint64_t lowBlockNum, const uint64_t hiBlockNum,
+                        std::vector<TxBlockSharedPtr>& blocks);
+
   /// Retrieves the requested transaction body.
   bool GetTxBody(const dev::h256& key, TxBodySharedPtr& body);
 
@@ -348,6 +402,21 @@ class BlockStorage : boost::noncopyable {
   /// Get a contract creation transaction hash
   dev::h256 GetContractCreator(const dev::h160 address);
 
+  /// Save the event logs of a TX epoch (as a JSON array) and their bloom, and
+  /// merge the bloom into the section bloom covering that epoch
+  bool PutEventLogs(const uint64_t& epochNum, const dev::h2048& bloom,
+                    const std::string& logs);
+
+  /// Retrieve the bloom of the event logs of a TX epoch
+  bool GetEventLogsBloom(const uint64_t& epochNum, dev::h2048& bloom);
+
+  /// Retrieve the union of the blooms of the EVENT_LOG_INDEX_SECTION_SIZE
+  /// TX epochs in the given section
+  bool GetEventLogsSectionBloom(const uint64_t& section, dev::h2048& bloom);
+
+  /// Retrieve the event logs of a TX epoch
+  bool GetEventLogs(const uint64_t& epochNum, std::string& logs);
+
   /// Clean a DB
   bool ResetDB(DBTYPE type);
 
@@ -380,6 +449,7 @@ class BlockStorage : boost::noncopyable {
   mutable std::shared_timed_mutex m_mutexMinerInfoShards;
   mutable std::shared_timed_mutex m_mutexExtSeedPubKeys;
   mutable std::mutex m_contractCreatorMutex;
+  mutable std::shared_timed_mutex m_mutexEventLogs;
 
   unsigned int m_diagnosticDBNodesCounter;
   unsigned int m_diagnosticDBCoinbaseCounter;
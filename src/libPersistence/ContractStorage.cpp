@@ -46,7 +46,93 @@ ContractStorage::ContractStorage()
       m_codeDB("contractCode"),
       m_initDataDB("contractInitState2"),
       m_trieDB("contractTrie"),
-      m_stateTrie(&m_trieDB) {}
+      m_stateTrie(&m_trieDB) {
+  lock_guard<mutex> g(m_stateDataMutex);
+  RebuildCommittedStateLocked();
+}
+
+void ContractStorage::RebuildCommittedStateLocked() {
+  auto layer = make_shared<CommittedLayer>();
+  for (const auto& entry : m_stateDataMap) {
+    (*layer)[entry.first].value = entry.second;
+  }
+  for (const auto& index : m_indexToBeDeleted) {
+    (*layer)[index].deleted = true;
+  }
+  m_committedDirtyKeys.clear();
+
+  auto committed = make_shared<CommittedState>();
+  committed->layers.emplace_back(std::move(layer));
+  committed->db = m_stateDataDB.GetDB();
+  if (committed->db) {
+    // The deleter keeps the DB alive until the last reader lets go
+    committed->dbSnapshot = shared_ptr<const leveldb::Snapshot>(
+        committed->db->GetSnapshot(),
+        [db = committed->db](const leveldb::Snapshot* snapshot) {
+          db->ReleaseSnapshot(snapshot);
+        });
+  }
+
+  lock_guard<mutex> g(m_committedStateMutex);
+  m_committedState = std::move(committed);
+}
+
+void ContractStorage::PublishCommittedStateLocked() {
+  auto previous = GetCommittedState();
+  if (!previous) {
+    RebuildCommittedStateLocked();
+    return;
+  }
+  if (m_committedDirtyKeys.empty()) {
+    return;
+  }
+
+  auto layer = make_shared<CommittedLayer>();
+  for (const auto& key : m_committedDirtyKeys) {
+    auto& entry = (*layer)[key];
+    const auto found = m_stateDataMap.find(key);
+    if (found != m_stateDataMap.end()) {
+      entry.value = found->second;
+    }
+    entry.deleted = m_indexToBeDeleted.count(key) > 0;
+  }
+  m_committedDirtyKeys.clear();
+
+  // The DB only changes through a rebuild, so its snapshot carries over
+  auto committed = make_shared<CommittedState>(*previous);
+  auto& layers = committed->layers;
+  layers.emplace_back(std::move(layer));
+  while (layers.size() > 1 &&
+         layers.back()->size() * 2 >= layers[layers.size() - 2]->size()) {
+    auto merged = make_shared<CommittedLayer>(*layers[layers.size() - 2]);
+    for (const auto& entry : *layers.back()) {
+      (*merged)[entry.first] = entry.second;
+    }
+    layers.pop_back();
+    layers.back() = std::move(merged);
+  }
+
+  lock_guard<mutex> g(m_committedStateMutex);
+  m_committedState = std::move(committed);
+}
+
+void ContractStorage::PublishCommittedState() {
+  lock_guard<mutex> g(m_stateDataMutex);
+  PublishCommittedStateLocked();
+}
+
+void ContractStorage::DropCommittedState() {
+  // Must happen before the state DB is closed or reset, since the published
+  // snapshot holds a reference to the open DB
+  lock_guard<mutex> g(m_committedStateMutex);
+  m_committedState.reset();
+}
+
+shared_ptr<const ContractStorage::CommittedState>
+ContractStorage::GetCommittedState() const {
+  lock_guard<mutex> g(m_committedStateMutex);
+  return m_committedState;
+}
 
 // Code
 //=================================
@@ -440,9 +526,9 @@ bool ContractStorage::FetchExternalStateValue(
       return false;
   } else if (query.name() == "_code") {
     // Get the code directly from the account storage.
-    zbytes code = account->GetCode();
+    const auto code = account->GetCodeBlob();
     ProtoScillaVal value;
-    value.set_bval(&code[0], code.size());
+    value.set_bval(code->data(), code->size());
     SerializeToArray(value, dst, 0);
     foundVal = true;
     return true;
@@ -614,8 +700,25 @@ bool ContractStorage::FetchStateJsonForContract(Json::Value& _json,
                                                 bool temp) {
   // LOG_MARKER();
 
+  shared_ptr<const CommittedState> committed;
+  if (!temp) {
+    committed = GetCommittedState();
+    if (!committed) {
+      LOG_GENERAL(WARNING, "No committed contract state available");
+      return false;
+    }
+  }
+
+  auto fetchStateData = [&](map<string, zbytes>& states, const string& key) {
+    if (committed) {
+      FetchStateDataForKey(*committed, states, key);
+    } else {
+      FetchStateDataForKey(states, key, temp);
+    }
+  };
+
   std::map<std::string, zbytes> states;
-  FetchStateDataForContract(states, address, vname, indices, temp);
+  fetchStateData(states, GenerateStorageKey(address, vname, indices));
   LOG_GENERAL(INFO, "local states map size=" << states.size());
 
   for (const auto& state : states) {
@@ -686,7 +789,7 @@ bool ContractStorage::FetchStateJsonForContract(Json::Value& _json,
     map<string, zbytes> map_depth;
     string map_depth_key =
         GenerateStorageKey(address, MAP_DEPTH_INDICATOR, {vname});
-    FetchStateDataForKey(map_depth, map_depth_key, temp);
+    fetchStateData(map_depth, map_depth_key);
 
     jsonMapWrapper(_json[vname], map_indices, state.second, 0,
                    !map_depth.empty()
@@ -756,6 +859,44 @@ void ContractStorage::FetchStateDataForKey(map<string, zbytes>& states,
   }
 }
 
+void ContractStorage::FetchStateDataForKey(const CommittedState& committed,
+                                           map<string, zbytes>& states,
+                                           const string& key) {
+  // Newest layer first, so that emplace keeps the entry that shadows
+  map<string, const CommittedEntry*> entries;
+  for (auto layer = committed.layers.rbegin(); layer != committed.layers.rend();
+       ++layer) {
+    for (auto p = (*layer)->lower_bound(key);
+         p != (*layer)->end() && p->first.compare(0, key.size(), key) == 0;
+         ++p) {
+      entries.emplace(p->first, &p->second);
+    }
+  }
+
+  if (committed.db) {
+    leveldb::ReadOptions options;
+    options.snapshot = committed.dbSnapshot.get();
+    std::unique_ptr<leveldb::Iterator> it(committed.db->NewIterator(options));
+
+    for (it->Seek({key});
+         it->Valid() && it->key().ToString().compare(0, key.size(), key) == 0;
+         it->Next()) {
+      const auto found = entries.find(it->key().ToString());
+      if (found == entries.end() ||
+          (!found->second->deleted && !found->second->value)) {
+        zbytes val(it->value().data(), it->value().data() + it->value().size());
+        states.emplace(it->key().ToString(), val);
+      }
+    }
+  }
+
+  for (const auto& entry : entries) {
+    if (!entry.second->deleted && entry.second->value) {
+      states[entry.first] = *entry.second->value;
+    }
+  }
+}
+
 bool ContractStorage::CheckIfKeyIsEmpty(const string& key, bool temp) {
   std::map<std::string, zbytes>::iterator p;
   unordered_set<string> keys_to_be_deleted;
@@ -1177,6 +1318,7 @@ void ContractStorage::UpdateStateDatasAndToDeletes(
         }
       }
       m_stateDataMap[state.first] = state.second;
+      m_committedDirtyKeys.emplace(state.first);
       const auto& hashed_key = ConvertStringToHashedKey(state.first);
       m_stateTrie.insert(hashed_key, state.second);
       if (LOG_SC) {
@@ -1200,6 +1342,7 @@ void ContractStorage::UpdateStateDatasAndToDeletes(
         r_indexToBeDeleted.emplace(toDelete, true);
       }
       m_indexToBeDeleted.emplace(toDelete);
+      m_committedDirtyKeys.emplace(toDelete);
       const auto& hashed_key = ConvertStringToHashedKey(toDelete);
       if (LOG_SC) {
         LOG_GENERAL(INFO, "Removed " << toDelete);
@@ -1254,10 +1397,12 @@ void ContractStorage::RevertContractStates() {
         m_stateTrie.insert(hashed_key, data.second);
         m_stateDataMap[data.first] = data.second;
       }
+      m_committedDirtyKeys.emplace(data.first);
     }
   }
 
   for (const auto& index : r_indexToBeDeleted) {
+    m_committedDirtyKeys.emplace(index.first);
     if (index.second) {
       // revert newly added indexToBeDeleted
       const auto& found = m_indexToBeDeleted.find(index.first);
@@ -1269,6 +1414,8 @@ void ContractStorage::RevertContractStates() {
       m_indexToBeDeleted.emplace(index.first);
     }
   }
+
+  PublishCommittedStateLocked();
 }
 
 void ContractStorage::InitRevertibles() {
@@ -1305,6 +1452,8 @@ bool ContractStorage::CommitStateDB(const uint64_t& dsBlockNum) {
 
     m_stateDataMap.clear();
     m_indexToBeDeleted.clear();
+
+    RebuildCommittedStateLocked();
   }
 
   InitTempState();
@@ -1369,6 +1518,7 @@ void ContractStorage::Reset() {
   }
   {
     lock_guard<mutex> g(m_stateDataMutex);
+    DropCommittedState();
     m_stateDataDB.ResetDB();
 
     p_stateDataMap.clear();
@@ -1385,6 +1535,8 @@ void ContractStorage::Reset() {
 
     m_stateTrie.init();
     m_trieDB.ResetDB();
+
+    RebuildCommittedStateLocked();
   }
 }
 
@@ -1400,8 +1552,12 @@ bool ContractStorage::RefreshAll() {
   }
   if (ret) {
     lock_guard<mutex> g(m_stateDataMutex);
+    DropCommittedState();
     ret = m_stateDataDB.RefreshDB();
     ret = ret && m_trieDB.RefreshDB();
+    if (ret) {
+      RebuildCommittedStateLocked();
+    }
   }
   return ret;
 }
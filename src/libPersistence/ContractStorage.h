@@ -19,7 +19,9 @@
 #define ZILLIQA_SRC_LIBPERSISTENCE_CONTRACTSTORAGE_H_
 
 #include <json/json.h>
+#include <memory>
 #include <mutex>
+#include <optional>
 
 #include "common/Constants.h"
 #include "depends/libDatabase/LevelDB.h"
@@ -34,6 +36,30 @@ namespace Contract {
 static std::string type_placeholder;
 
 class ContractStorage : boost::noncopyable {
+ public:
+  /// State of one key of m_stateDataMap/m_indexToBeDeleted at a commit
+  /// point. A key without a value that is not deleted reads from the DB.
+  struct CommittedEntry {
+    std::optional<zbytes> value;
+    bool deleted{false};
+  };
+  using CommittedLayer = std::map<std::string, CommittedEntry>;
+
+  /// Contract state as of the last commit point (end of a block's state
+  /// delta, a DB commit or a revert). Never modified once published, so RPC
+  /// readers can walk it without holding m_stateDataMutex.
+  /// Each publish only adds a layer with the keys changed since the last
+  /// one; the layers are shared between successive states and merged
+  /// whenever a layer grows to half the size of the one below it, so there
+  /// are O(log n) of them.
+  struct CommittedState {
+    // Oldest first; an entry shadows the same key in every earlier layer
+    std::vector<std::shared_ptr<const CommittedLayer>> layers;
+    std::shared_ptr<leveldb::DB> db;
+    std::shared_ptr<const leveldb::Snapshot> dbSnapshot;
+  };
+
+ private:
   LevelDB m_stateDataDB;
   LevelDB m_codeDB;
   LevelDB m_initDataDB;
@@ -65,6 +91,24 @@ class ContractStorage : boost::noncopyable {
   mutable std::mutex m_initDataMutex;
   mutable std::mutex m_stateDataMutex;
 
+  std::shared_ptr<const CommittedState> m_committedState;
+  // Only guards copying/swapping the m_committedState pointer
+  mutable std::mutex m_committedStateMutex;
+  // Keys of m_stateDataMap/m_indexToBeDeleted changed since the last
+  // publish, guarded by m_stateDataMutex
+  std::set<std::string> m_committedDirtyKeys;
+
+  /// Publishes the keys changed since the last publish on top of the
+  /// current committed state. Caller must hold m_stateDataMutex
+  void PublishCommittedStateLocked();
+
+  /// Publishes the whole of m_stateDataMap/m_indexToBeDeleted over a fresh
+  /// DB snapshot, for when the DB itself has changed. Caller must hold
+  /// m_stateDataMutex
+  void RebuildCommittedStateLocked();
+
+  void DropCommittedState();
+
   void DeleteByPrefix(const std::string& prefix);
 
   void DeleteByIndex(const std::string& index);
@@ -91,6 +135,15 @@ class ContractStorage : boost::noncopyable {
     return cs;
   }
 
+  /// The contract state last published, for reads that must not block or
+  /// be blocked by the block path
+  std::shared_ptr<const CommittedState> GetCommittedState() const;
+
+  /// Fetches every state under the key prefix as of the committed state
+  static void FetchStateDataForKey(const CommittedState& committed,
+                                   std::map<std::string, zbytes>& states,
+                                   const std::string& key);
+
   /////////////////////////////////////////////////////////////////////////////
 
   /// Adds contract codes to persistence in batch
@@ -139,6 +192,8 @@ class ContractStorage : boost::noncopyable {
                               std::string value, bool unquote = true,
                               bool nokey = false);
 
+  /// With temp = false, reads the last published committed state and does
+  /// not block on (or block) block execution
   bool FetchStateJsonForContract(Json::Value& _json, const dev::h160& address,
                                  const std::string& vname = "",
                                  const std::vector<std::string>& indices = {},
@@ -198,6 +253,9 @@ class ContractStorage : boost::noncopyable {
   /// Revert m_map with r_map
   void RevertContractStates();
 
+  /// Make the current m_map visible to non-temp state readers
+  void PublishCommittedState();
+
   /// Clean r_map
   void InitRevertibles();
 
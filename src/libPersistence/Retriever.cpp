@@ -24,6 +24,7 @@
 #include "libDirectoryService/DirectoryService.h"
 #include "libMediator/Mediator.h"
 #include "libNode/Node.h"
+#include "libPersistence/StateSnapshot.h"
 #include "libUtils/CommonUtils.h"
 #include "libUtils/FileSystem.h"
 
@@ -120,6 +121,42 @@ bool Retriever::ConstructFromStateDeltas(const uint64_t& lastBlockNum,
             : 0;
     uint64_t upper_bound_txnblk = lastBlockNum - extra_txblocks;
 
+    // Start from the newest full state snapshot in range, if there is one,
+    // and only replay the state deltas after it
+    uint64_t snapshotBlockNum = 0;
+    if (StateSnapshot::FindLatest(upper_bound_txnblk, snapshotBlockNum) &&
+        snapshotBlockNum >= lower_bound_txnblk) {
+      TxBlockSharedPtr snapshotTxBlock;
+      zbytes snapshot;
+      if (BlockStorage::GetBlockStorage().GetTxBlock(snapshotBlockNum,
+                                                     snapshotTxBlock) &&
+          StateSnapshot::Load(snapshotBlockNum,
+                              snapshotTxBlock->GetHeader().GetStateRootHash(),
+                              snapshot)) {
+        LOG_GENERAL(INFO,
+                    "Restoring state from snapshot of txBlk "
+                        << snapshotBlockNum);
+        // From here on the persisted state is replaced, so failures are final
+        if (!AccountStore::GetInstance().Deserialize(snapshot, 0) ||
+            AccountStore::GetInstance().GetStateRootHash() !=
+                snapshotTxBlock->GetHeader().GetStateRootHash()) {
+          LOG_GENERAL(WARNING, "Failed to restore state snapshot of txBlk "
+                                   << snapshotBlockNum);
+          return false;
+        }
+        if (!AccountStore::GetInstance().MoveUpdatesToDisk(
+                snapshotBlockNum / NUM_FINAL_BLOCK_PER_POW)) {
+          LOG_GENERAL(WARNING, "AccountStore::MoveUpdatesToDisk() failed");
+          return false;
+        }
+        lower_bound_txnblk = snapshotBlockNum + 1;
+      } else {
+        LOG_GENERAL(WARNING, "Unusable state snapshot of txBlk "
+                                 << snapshotBlockNum
+                                 << ", replaying state deltas instead");
+      }
+    }
+
     LOG_GENERAL(INFO, "Will try recreating state from txnblks: "
                           << lower_bound_txnblk << " - " << upper_bound_txnblk);
 
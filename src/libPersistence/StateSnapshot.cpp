@@ -0,0 +1,311 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "StateSnapshot.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include "common/Constants.h"
+#include "common/Serializable.h"
+#include "libBlockchain/TxBlock.h"
+#include "libCrypto/Sha2.h"
+#include "libData/AccountStore/AccountStore.h"
+#include "libUtils/DetachedFunction.h"
+#include "libUtils/Logger.h"
+
+using namespace std;
+
+namespace {
+
+const string SNAPSHOT_PREFIX = "stateSnapshot_";
+const string SNAPSHOT_MAGIC = "ZILSNAP1";
+const unsigned int HEADER_SIZE =
+    SNAPSHOT_MAGIC.size() + sizeof(uint64_t) + dev::h256::size +
+    sizeof(uint32_t);
+const unsigned int CHUNK_HEADER_SIZE = sizeof(uint64_t) + dev::h256::size;
+
+string SnapshotDir() { return STORAGE_PATH + STATE_SNAPSHOT_PATH; }
+
+size_t ChunkSize() {
+  return static_cast<size_t>(max(STATE_SNAPSHOT_CHUNK_SIZE_MB, 1u)) << 20;
+}
+
+/// Hashes payload[offsets[i], offsets[i] + lengths[i]) for every chunk,
+/// spread over the available cores
+vector<zbytes> HashChunks(const zbytes& payload, const vector<size_t>& offsets,
+                          const vector<size_t>& lengths) {
+  vector<zbytes> hashes(offsets.size());
+  const size_t numThreads = min<size_t>(
+      max(thread::hardware_concurrency(), 1u), max<size_t>(offsets.size(), 1));
+
+  vector<thread> workers;
+  for (size_t t = 0; t < numThreads; ++t) {
+    workers.emplace_back([&, t]() {
+      for (size_t i = t; i < offsets.size(); i += numThreads) {
+        SHA256Calculator sha2;
+        sha2.Update(payload.data() + offsets[i], lengths[i]);
+        hashes[i] = sha2.Finalize();
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  return hashes;
+}
+
+bool ParseBlockNum(const string& fileName, uint64_t& txBlockNum) {
+  if (fileName.rfind(SNAPSHOT_PREFIX, 0) != 0) {
+    return false;
+  }
+  const auto digits = fileName.substr(SNAPSHOT_PREFIX.size());
+  if (digits.empty() || !all_of(digits.begin(), digits.end(), ::isdigit)) {
+    return false;
+  }
+  try {
+    txBlockNum = stoull(digits);
+  } catch (const exception&) {
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+atomic<bool> StateSnapshot::s_taking{false};
+
+string StateSnapshot::GetPath(uint64_t txBlockNum) {
+  return SnapshotDir() + "/" + SNAPSHOT_PREFIX + to_string(txBlockNum);
+}
+
+void StateSnapshot::OnStateCommitted(uint64_t dsBlockNum,
+                                     const TxBlock& txBlock) {
+  if (STATE_SNAPSHOT_INTERVAL_DSEPOCHS == 0 ||
+      dsBlockNum % STATE_SNAPSHOT_INTERVAL_DSEPOCHS != 0) {
+    return;
+  }
+
+  if (s_taking.exchange(true)) {
+    LOG_GENERAL(WARNING, "Previous state snapshot still running, skipping");
+    return;
+  }
+
+  const auto txBlockNum = txBlock.GetHeader().GetBlockNum();
+  const auto stateRoot = txBlock.GetHeader().GetStateRootHash();
+  DetachedFunction(1, [txBlockNum, stateRoot]() {
+    if (Take(txBlockNum, stateRoot)) {
+      Prune();
+    }
+    s_taking = false;
+  });
+}
+
+bool StateSnapshot::Take(uint64_t txBlockNum, const dev::h256& expectedRoot) {
+  LOG_MARKER();
+
+  zbytes payload;
+  dev::h256 stateRoot;
+  if (!AccountStore::GetInstance().SerializeSnapshot(payload, stateRoot)) {
+    LOG_GENERAL(WARNING, "AccountStore::SerializeSnapshot failed");
+    return false;
+  }
+
+  // The next block may already have been applied, in which case this
+  // snapshot would be labelled with the wrong block
+  if (stateRoot != expectedRoot) {
+    LOG_GENERAL(WARNING, "State moved past txBlk " << txBlockNum
+                                                   << ", skipping snapshot");
+    return false;
+  }
+
+  return Write(txBlockNum, stateRoot, payload);
+}
+
+bool StateSnapshot::Write(uint64_t txBlockNum, const dev::h256& stateRoot,
+                          const zbytes& payload) {
+  vector<size_t> offsets;
+  vector<size_t> lengths;
+  for (size_t offset = 0; offset < payload.size(); offset += ChunkSize()) {
+    offsets.push_back(offset);
+    lengths.push_back(min(ChunkSize(), payload.size() - offset));
+  }
+  const auto hashes = HashChunks(payload, offsets, lengths);
+
+  zbytes header(SNAPSHOT_MAGIC.begin(), SNAPSHOT_MAGIC.end());
+  SerializableDataBlock::SetNumber<uint64_t>(header, header.size(), txBlockNum,
+                                             sizeof(uint64_t));
+  header.insert(header.end(), stateRoot.begin(), stateRoot.end());
+  SerializableDataBlock::SetNumber<uint32_t>(header, header.size(),
+                                             offsets.size(), sizeof(uint32_t));
+
+  try {
+    filesystem::create_directories(SnapshotDir());
+    const auto path = GetPath(txBlockNum);
+    const auto tmpPath = path + ".tmp";
+    {
+      ofstream out(tmpPath, ios::binary | ios::trunc);
+      out.write(reinterpret_cast<const char*>(header.data()), header.size());
+      for (size_t i = 0; i < offsets.size(); ++i) {
+        zbytes chunkHeader;
+        SerializableDataBlock::SetNumber<uint64_t>(chunkHeader, 0, lengths[i],
+                                                   sizeof(uint64_t));
+        chunkHeader.insert(chunkHeader.end(), hashes[i].begin(),
+                           hashes[i].end());
+        out.write(reinterpret_cast<const char*>(chunkHeader.data()),
+                  chunkHeader.size());
+        out.write(reinterpret_cast<const char*>(payload.data() + offsets[i]),
+                  lengths[i]);
+      }
+      if (!out) {
+        LOG_GENERAL(WARNING, "Failed to write " << tmpPath);
+        return false;
+      }
+    }
+    // Only complete snapshots ever carry the final name
+    filesystem::rename(tmpPath, path);
+  } catch (const exception& e) {
+    LOG_GENERAL(WARNING, "Failed to write state snapshot: " << e.what());
+    return false;
+  }
+
+  LOG_GENERAL(INFO, "State snapshot of txBlk " << txBlockNum << " written ("
+                                               << payload.size() << " bytes, "
+                                               << offsets.size()
+                                               << " chunks)");
+  return true;
+}
+
+bool StateSnapshot::Load(uint64_t txBlockNum, const dev::h256& expectedRoot,
+                         zbytes& payload) {
+  LOG_MARKER();
+
+  const auto path = GetPath(txBlockNum);
+  ifstream in(path, ios::binary);
+  error_code ec;
+  const auto fileSize = filesystem::file_size(path, ec);
+  if (!in || ec) {
+    LOG_GENERAL(WARNING, "Cannot open " << path);
+    return false;
+  }
+
+  zbytes header(HEADER_SIZE);
+  if (!in.read(reinterpret_cast<char*>(header.data()), header.size()) ||
+      !equal(SNAPSHOT_MAGIC.begin(), SNAPSHOT_MAGIC.end(), header.begin())) {
+    LOG_GENERAL(WARNING, path << " is not a state snapshot");
+    return false;
+  }
+
+  unsigned int offset = SNAPSHOT_MAGIC.size();
+  const auto blockNum = SerializableDataBlock::GetNumber<uint64_t>(
+      header, offset, sizeof(uint64_t));
+  offset += sizeof(uint64_t);
+  const dev::h256 stateRoot(zbytes(header.begin() + offset,
+                                   header.begin() + offset + dev::h256::size));
+  offset += dev::h256::size;
+  const auto numChunks = SerializableDataBlock::GetNumber<uint32_t>(
+      header, offset, sizeof(uint32_t));
+
+  if (blockNum != txBlockNum || stateRoot != expectedRoot) {
+    LOG_GENERAL(WARNING, "State snapshot " << path << " is of txBlk "
+                                           << blockNum << " with root "
+                                           << stateRoot << ", expected "
+                                           << expectedRoot);
+    return false;
+  }
+
+  payload.clear();
+  payload.reserve(fileSize);
+  vector<size_t> offsets;
+  vector<size_t> lengths;
+  vector<zbytes> expectedHashes;
+  for (uint32_t i = 0; i < numChunks; ++i) {
+    zbytes chunkHeader(CHUNK_HEADER_SIZE);
+    if (!in.read(reinterpret_cast<char*>(chunkHeader.data()),
+                 chunkHeader.size())) {
+      LOG_GENERAL(WARNING, path << " is truncated");
+      return false;
+    }
+    const auto length = SerializableDataBlock::GetNumber<uint64_t>(
+        chunkHeader, 0, sizeof(uint64_t));
+    if (length > fileSize) {
+      LOG_GENERAL(WARNING, path << " has a corrupt chunk length");
+      return false;
+    }
+    offsets.push_back(payload.size());
+    lengths.push_back(length);
+    expectedHashes.emplace_back(chunkHeader.begin() + sizeof(uint64_t),
+                                chunkHeader.end());
+
+    payload.resize(payload.size() + length);
+    if (!in.read(reinterpret_cast<char*>(payload.data() + offsets.back()),
+                 length)) {
+      LOG_GENERAL(WARNING, path << " is truncated");
+      return false;
+    }
+  }
+
+  if (HashChunks(payload, offsets, lengths) != expectedHashes) {
+    LOG_GENERAL(WARNING, path << " failed checksum verification");
+    return false;
+  }
+
+  return true;
+}
+
+bool StateSnapshot::FindLatest(uint64_t maxTxBlockNum, uint64_t& txBlockNum) {
+  bool found = false;
+  try {
+    if (!filesystem::exists(SnapshotDir())) {
+      return false;
+    }
+    for (const auto& entry : filesystem::directory_iterator(SnapshotDir())) {
+      uint64_t blockNum = 0;
+      if (ParseBlockNum(entry.path().filename().string(), blockNum) &&
+          blockNum <= maxTxBlockNum && (!found || blockNum > txBlockNum)) {
+        txBlockNum = blockNum;
+        found = true;
+      }
+    }
+  } catch (const exception& e) {
+    LOG_GENERAL(WARNING, "Failed to list state snapshots: " << e.what());
+    return false;
+  }
+  return found;
+}
+
+void StateSnapshot::Prune() {
+  vector<uint64_t> blockNums;
+  try {
+    for (const auto& entry : filesystem::directory_iterator(SnapshotDir())) {
+      uint64_t blockNum = 0;
+      if (ParseBlockNum(entry.path().filename().string(), blockNum)) {
+        blockNums.push_back(blockNum);
+      }
+    }
+
+    sort(blockNums.begin(), blockNums.end(), greater<uint64_t>());
+    for (size_t i = max(STATE_SNAPSHOT_KEEP, 1u); i < blockNums.size(); ++i) {
+      filesystem::remove(GetPath(blockNums[i]));
+    }
+  } catch (const exception& e) {
+    LOG_GENERAL(WARNING, "Failed to prune state snapshots: " << e.what());
+  }
+}
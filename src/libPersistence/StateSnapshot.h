@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ZILLIQA_SRC_LIBPERSISTENCE_STATESNAPSHOT_H_
+#define ZILLIQA_SRC_LIBPERSISTENCE_STATESNAPSHOT_H_
+
+#include <atomic>
+#include <string>
+
+#include "common/BaseType.h"
+#include "depends/common/FixedHash.h"
+
+class TxBlock;
+
+/// Full account state, contract code and storage included, written to one
+/// checksummed file every STATE_SNAPSHOT_INTERVAL_DSEPOCHS DS epochs, so that
+/// a restarting node loads it instead of replaying every state delta since
+/// the last incremental DB boundary.
+///
+/// The file holds a header (magic, tx block number, state root, chunk count)
+/// followed by the AccountStore serialization split into chunks, each with
+/// its length and SHA-256, so checksums are computed and verified on several
+/// threads at once.
+class StateSnapshot {
+ public:
+  /// Called once the state of a vacuous epoch is on disk. Takes a snapshot
+  /// in the background if this DS epoch is due for one
+  static void OnStateCommitted(uint64_t dsBlockNum, const TxBlock& txBlock);
+
+  /// Serializes the current state and writes it as the snapshot of
+  /// txBlockNum. Fails if the state has already moved past expectedRoot
+  static bool Take(uint64_t txBlockNum, const dev::h256& expectedRoot);
+
+  /// Writes a snapshot file, replacing any snapshot of the same block
+  static bool Write(uint64_t txBlockNum, const dev::h256& stateRoot,
+                    const zbytes& payload);
+
+  /// Reads and verifies the snapshot of txBlockNum without touching any
+  /// state. Fails unless every checksum and the state root match
+  static bool Load(uint64_t txBlockNum, const dev::h256& expectedRoot,
+                   zbytes& payload);
+
+  /// Finds the newest snapshot taken at or before maxTxBlockNum
+  static bool FindLatest(uint64_t maxTxBlockNum, uint64_t& txBlockNum);
+
+  /// Deletes all but the newest STATE_SNAPSHOT_KEEP snapshots
+  static void Prune();
+
+  static std::string GetPath(uint64_t txBlockNum);
+
+ private:
+  static std::atomic<bool> s_taking;
+};
+
+#endif  // ZILLIQA_SRC_LIBPERSISTENCE_STATESNAPSHOT_H_
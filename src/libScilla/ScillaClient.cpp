@@ -17,17 +17,84 @@
 
 #include "ScillaClient.h"
 
+#include <signal.h>
+
+#include "libMetrics/Api.h"
 #include "libScilla/ScillaUtils.h"
 #include "libUtils/DetachedFunction.h"
 #include "libUtils/SysCommand.h"
 
 #include <boost/asio.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/process/args.hpp>
+#include <boost/process/exe.hpp>
+#include <boost/process/io.hpp>
 #include <boost/range/iterator_range.hpp>
 
 using namespace std::filesystem;
 
+namespace {
+
+Z_I64METRIC& GetServerStartsCounter() {
+  static Z_I64METRIC serverStarts(Z_FL::SCILLA_IPC, "scilla_server_starts",
+                                  "scilla-server worker (re)starts", "Starts");
+  return serverStarts;
+}
+
+std::string GetSocketPath(uint32_t version, size_t index) {
+  std::string socketPath = SCILLA_SERVER_SOCKET_PATH;
+  if (ENABLE_SCILLA_MULTI_VERSION) {
+    socketPath += "." + std::to_string(version);
+  }
+  // The first worker keeps the socket a single server used to have.
+  if (index > 0) {
+    socketPath += ".w" + std::to_string(index);
+  }
+  return socketPath;
+}
+
+/// Stops servers left behind by an earlier run of this node.
+void KillStaleServers(uint32_t version) {
+  std::string root_w_version;
+  if (!ScillaUtils::PrepareRootPathWVersion(version, root_w_version)) {
+    return;
+  }
+  std::string server_path = root_w_version + "/bin/" + SCILLA_SERVER_BINARY;
+
+  std::string cmdStr;
+  if (ENABLE_SCILLA_MULTI_VERSION) {
+    cmdStr = "ps aux | awk '{print $2\"\\t\"$11}' | grep \"" + server_path +
+             "\" | awk '{print $1}' | xargs kill -SIGTERM";
+  } else {
+    cmdStr = "pkill " + SCILLA_SERVER_BINARY;
+  }
+
+  LOG_GENERAL(INFO, "cmdStr: " << cmdStr);
+
+  try {
+    if (!SysCommand::ExecuteCmd(SysCommand::WITHOUT_OUTPUT, cmdStr)) {
+      LOG_GENERAL(WARNING, "ExecuteCmd failed: " << cmdStr);
+    }
+  } catch (const std::exception& e) {
+    LOG_GENERAL(WARNING,
+                "Exception caught in SysCommand::ExecuteCmd: " << e.what());
+  } catch (...) {
+    LOG_GENERAL(WARNING, "Unknown error encountered");
+  }
+}
+
+}  // namespace
+
 ScillaClient::~ScillaClient() {
+  {
+    std::lock_guard<std::mutex> g(m_mutexMain);
+    m_stopHealthCheck = true;
+  }
+  m_cvHealthCheck.notify_all();
+  if (m_healthCheckThread.joinable()) {
+    m_healthCheckThread.join();
+  }
+
   std::string cmdStr = "pkill " + SCILLA_SERVER_BINARY + " >/dev/null &";
   LOG_GENERAL(INFO, "cmdStr: " << cmdStr);
 
@@ -77,231 +144,340 @@ void ScillaClient::Init() {
   }
 }
 
-bool ScillaClient::isScillaRuning() {
-  std::string cmdStr = "ps aux | awk '{print $2\"\\t\"$11}' | grep \"" +
-                       SCILLA_SERVER_BINARY + "\" | awk '{print $1}'";
-  std::string result;
-  try {
-    if (!SysCommand::ExecuteCmd(SysCommand::WITH_OUTPUT, cmdStr, result)) {
-      LOG_GENERAL(WARNING, "ExecuteCmd failed: " << cmdStr);
-      return false;
-    }
-  } catch (const std::exception& e) {
-    LOG_GENERAL(WARNING,
-                "Exception caught in SysCommand::ExecuteCmd: " << e.what());
-    return false;
-  } catch (...) {
-    LOG_GENERAL(WARNING, "Unknown error encountered");
-    return false;
+ScillaClient::Pool& ScillaClient::GetPool(uint32_t version) {
+  auto it = m_pools.find(version);
+  if (it != m_pools.end()) {
+    return it->second;
   }
-  if (result.empty()) {
-    return false;
+
+  KillStaleServers(version);
+
+  Pool& pool = m_pools[version];
+  const size_t size = std::max(SCILLA_SERVER_POOL_SIZE, 1U);
+  for (size_t i = 0; i < size; ++i) {
+    auto worker = std::make_unique<Worker>();
+    worker->version = version;
+    worker->socketPath = GetSocketPath(version, i);
+    pool.workers.emplace_back(std::move(worker));
   }
-  return true;
+  LOG_GENERAL(INFO,
+              "scilla-server pool for version " << version << ": " << size);
+
+  if (!m_healthCheckThread.joinable() &&
+      SCILLA_SERVER_HEALTH_CHECK_INTERVAL_IN_MS > 0) {
+    m_healthCheckThread = std::thread([this]() { HealthCheck(); });
+  }
+
+  return pool;
 }
 
-bool ScillaClient::OpenServer(uint32_t version) {
+bool ScillaClient::OpenServer(Worker& worker) {
   LOG_MARKER();
 
-  std::string cmdStr;
   std::string root_w_version;
-  if (!ScillaUtils::PrepareRootPathWVersion(version, root_w_version)) {
+  if (!ScillaUtils::PrepareRootPathWVersion(worker.version, root_w_version)) {
     LOG_GENERAL(WARNING, "ScillaUtils::PrepareRootPathWVersion failed");
     return false;
   }
 
   std::string server_path = root_w_version + "/bin/" + SCILLA_SERVER_BINARY;
 
-  std::string killStr, executeStr;
-
-  if (ENABLE_SCILLA_MULTI_VERSION) {
-    cmdStr = "ps aux | awk '{print $2\"\\t\"$11}' | grep \"" + server_path +
-             "\" | awk '{print $1}' | xargs kill -SIGTERM ; " + server_path +
-             " -socket " + SCILLA_SERVER_SOCKET_PATH + "." +
-             std::to_string(version) + " >/dev/null &";
-  } else {
-    cmdStr = "pkill " + SCILLA_SERVER_BINARY + " ; " + server_path +
-             " -socket " + SCILLA_SERVER_SOCKET_PATH + " >/dev/null &";
+  {
+    std::lock_guard<std::mutex> g(m_mutexMain);
+    worker.pid = 0;
   }
 
-  LOG_GENERAL(INFO, "cmdStr: " << cmdStr);
+  std::error_code ec;
+  if (worker.process.valid()) {
+    if (worker.process.running(ec)) {
+      worker.process.terminate(ec);
+    }
+    worker.process.wait(ec);
+  }
+  remove(worker.socketPath, ec);
 
   try {
-    if (!SysCommand::ExecuteCmd(SysCommand::WITHOUT_OUTPUT, cmdStr)) {
-      LOG_GENERAL(WARNING, "ExecuteCmd failed: " << cmdStr);
-      return false;
-    }
+    worker.process = boost::process::child(
+        boost::process::exe = server_path,
+        boost::process::args = {"-socket", worker.socketPath},
+        boost::process::std_out > boost::process::null);
   } catch (const std::exception& e) {
-    LOG_GENERAL(WARNING,
-                "Exception caught in SysCommand::ExecuteCmd: " << e.what());
-    return false;
-  } catch (...) {
-    LOG_GENERAL(WARNING, "Unknown error encountered");
+    LOG_GENERAL(WARNING, "Failed to start " << server_path << ": " << e.what());
     return false;
   }
 
-  LOG_GENERAL(WARNING, "terminated: " << cmdStr);
+  {
+    std::lock_guard<std::mutex> g(m_mutexMain);
+    worker.pid = worker.process.id();
+  }
+  GetServerStartsCounter().IncrementAttr({{"event", "start"}});
+  LOG_GENERAL(INFO, "Started " << server_path << " (pid " << worker.pid
+                               << ") on " << worker.socketPath);
+
+  const auto deadline =
+      std::chrono::steady_clock::now() +
+      std::chrono::milliseconds(SCILLA_SERVER_PENDING_IN_MS);
+  while (!exists(worker.socketPath, ec) &&
+         std::chrono::steady_clock::now() < deadline &&
+         worker.process.running(ec)) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  if (!exists(worker.socketPath, ec)) {
+    LOG_GENERAL(WARNING, "scilla-server hasn't opened " << worker.socketPath
+                                                        << " yet");
+  }
 
-  std::this_thread::sleep_for(
-      std::chrono::milliseconds(SCILLA_SERVER_PENDING_IN_MS));
+  worker.connector =
+      std::make_unique<rpc::UnixDomainSocketClient>(worker.socketPath);
+  worker.client = std::make_unique<jsonrpc::Client>(
+      *worker.connector, jsonrpc::JSONRPC_CLIENT_V2);
 
   return true;
 }
 
-bool ScillaClient::CheckClient(uint32_t version, bool enforce) {
-  std::lock_guard<std::mutex> g(m_mutexMain);
-
-  if (m_clients.find(version) != m_clients.end() && !enforce) {
-    return true;
+ScillaClient::Worker* ScillaClient::AcquireWorker(uint32_t version,
+                                                  const Json::Value& request,
+                                                  bool& cancelled) {
+  cancelled = false;
+  Worker* worker = nullptr;
+  bool start = false;
+  {
+    std::unique_lock<std::mutex> lock(m_mutexMain);
+    Pool& pool = GetPool(version);
+    pool.waiting[&request] = false;
+    pool.cvIdle.wait(lock, [&pool, &worker, &request]() {
+      if (pool.waiting[&request]) {
+        return true;
+      }
+      for (const auto& w : pool.workers) {
+        if (!w->busy) {
+          worker = w.get();
+          return true;
+        }
+      }
+      return false;
+    });
+    pool.waiting.erase(&request);
+    if (worker == nullptr) {
+      cancelled = true;
+      return nullptr;
+    }
+    worker->busy = true;
+    worker->request = &request;
+    worker->cancelled = false;
+    start = !worker->client;
   }
 
-  if (!OpenServer(version)) {
-    LOG_GENERAL(WARNING, "OpenServer for version " << version << "failed");
-    return false;
+  std::error_code ec;
+  if (start || !worker->process.running(ec)) {
+    if (!OpenServer(*worker)) {
+      ReleaseWorker(*worker, false);
+      return nullptr;
+    }
+
+    // ResetWorker has no process to stop while the server starts up.
+    std::lock_guard<std::mutex> g(m_mutexMain);
+    if (worker->cancelled) {
+      worker->busy = false;
+      worker->request = nullptr;
+      worker->cancelled = false;
+      m_pools.at(version).cvIdle.notify_one();
+      cancelled = true;
+      return nullptr;
+    }
   }
 
-  m_connectors[version] = std::make_unique<rpc::UnixDomainSocketClient>(
-      SCILLA_SERVER_SOCKET_PATH +
-      (ENABLE_SCILLA_MULTI_VERSION ? ("." + std::to_string(version)) : ""));
+  return worker;
+}
 
-  m_clients[version] = std::make_unique<jsonrpc::Client>(
-      *m_connectors.at(version), jsonrpc::JSONRPC_CLIENT_V2);
+bool ScillaClient::ReleaseWorker(Worker& worker, bool restart) {
+  if (restart && !OpenServer(worker)) {
+    LOG_GENERAL(WARNING, "Failed to restart scilla-server on "
+                             << worker.socketPath);
+  }
 
-  return true;
+  std::lock_guard<std::mutex> g(m_mutexMain);
+  const bool cancelled = worker.cancelled;
+  worker.busy = false;
+  worker.request = nullptr;
+  worker.cancelled = false;
+  m_pools.at(worker.version).cvIdle.notify_one();
+  return !cancelled;
 }
 
-bool ScillaClient::CallChecker(uint32_t version, const Json::Value& _json,
-                               std::string& result, uint32_t counter) {
-  if (counter == 0) {
-    return false;
+void ScillaClient::HealthCheck() {
+  std::unique_lock<std::mutex> lock(m_mutexMain);
+  while (!m_stopHealthCheck) {
+    m_cvHealthCheck.wait_for(
+        lock,
+        std::chrono::milliseconds(SCILLA_SERVER_HEALTH_CHECK_INTERVAL_IN_MS),
+        [this]() { return m_stopHealthCheck; });
+    if (m_stopHealthCheck) {
+      break;
+    }
+
+    // Only idle workers that were started before are looked at; busy ones
+    // are restarted by their caller when the call fails.
+    std::vector<Worker*> idle;
+    for (auto& pool : m_pools) {
+      for (auto& worker : pool.second.workers) {
+        if (!worker->busy && worker->client) {
+          worker->busy = true;
+          idle.push_back(worker.get());
+        }
+      }
+    }
+    lock.unlock();
+
+    for (Worker* worker : idle) {
+      std::error_code ec;
+      const bool healthy = worker->process.running(ec) &&
+                           exists(worker->socketPath, ec);
+      if (!healthy) {
+        LOG_GENERAL(WARNING, "scilla-server on " << worker->socketPath
+                                                 << " is gone, restarting");
+      }
+      ReleaseWorker(*worker, !healthy);
+    }
+
+    lock.lock();
   }
+}
 
+bool ScillaClient::CheckClient(uint32_t version, bool enforce) {
   if (!ENABLE_SCILLA_MULTI_VERSION) {
     version = 0;
   }
 
-  if (!CheckClient(version)) {
-    LOG_GENERAL(WARNING, "CheckClient failed");
-    return false;
-  }
-
-  try {
+  std::vector<Worker*> idle;
+  {
     std::lock_guard<std::mutex> g(m_mutexMain);
-    result = m_clients.at(version)->CallMethod("check", _json).asString();
-  } catch (jsonrpc::JsonRpcException& e) {
-    LOG_GENERAL(WARNING, "CallChecker failed: " << e.what());
-    if (std::string(e.what()).find(SCILLA_SERVER_SOCKET_PATH) !=
-        std::string::npos) {
-      if (!CheckClient(version, true)) {
-        LOG_GENERAL(WARNING, "CheckClient for version " << version << "failed");
-        return CallChecker(version, _json, result, counter - 1);
-      }
-    } else {
-      if (e.GetCode() == jsonrpc::Errors::ERROR_RPC_JSON_PARSE_ERROR ||
-          e.GetCode() == jsonrpc::Errors::ERROR_CLIENT_CONNECTOR){
-        LOG_GENERAL(WARNING, "Looks like connection problem");
-        if (!isScillaRuning()) {
-          LOG_GENERAL(WARNING, "Scilla is not running");
-          CheckClient(version,true);
+    for (auto& worker : GetPool(version).workers) {
+      if (!worker->busy) {
+        worker->busy = true;
+        idle.push_back(worker.get());
+      } else if (enforce) {
+        worker->cancelled = worker->request != nullptr;
+        if (worker->pid > 0) {
+          kill(worker->pid, SIGTERM);
         }
-        return CallChecker(version, _json, result, counter - 1);
       }
-      result = e.what();
     }
+  }
 
-    return false;
+  bool ret = true;
+  for (Worker* worker : idle) {
+    std::error_code ec;
+    if (enforce || !worker->client || !worker->process.running(ec)) {
+      if (!OpenServer(*worker)) {
+        LOG_GENERAL(WARNING, "OpenServer for version " << version << "failed");
+        ret = false;
+      }
+    }
+    ReleaseWorker(*worker, false);
   }
 
-  return true;
+  return ret;
 }
 
-bool ScillaClient::CallRunner(uint32_t version, const Json::Value& _json,
-                              std::string& result, uint32_t counter) {
-  if (counter == 0) {
-    return false;
-  }
-
+void ScillaClient::ResetWorker(uint32_t version, const Json::Value& _json) {
   if (!ENABLE_SCILLA_MULTI_VERSION) {
     version = 0;
   }
 
-  if (!CheckClient(version)) {
-    LOG_GENERAL(WARNING, "CheckClient failed");
-    return false;
+  std::lock_guard<std::mutex> g(m_mutexMain);
+  auto it = m_pools.find(version);
+  if (it == m_pools.end()) {
+    return;
   }
 
-  try {
-    std::lock_guard<std::mutex> g(m_mutexMain);
-    result = m_clients.at(version)->CallMethod("run", _json).asString();
-  } catch (jsonrpc::JsonRpcException& e) {
-    LOG_GENERAL(WARNING, "CallRunner failed: " << e.what());
-    if (std::string(e.what()).find(SCILLA_SERVER_SOCKET_PATH) !=
-        std::string::npos) {
-      if (!CheckClient(version, true)) {
-        LOG_GENERAL(WARNING, "CheckClient for version " << version << "failed");
-        return CallRunner(version, _json, result, counter - 1);
-      }
-    } else {
-      if (e.GetCode() == jsonrpc::Errors::ERROR_RPC_JSON_PARSE_ERROR ||
-          e.GetCode() == jsonrpc::Errors::ERROR_CLIENT_CONNECTOR){
-        LOG_GENERAL(WARNING, "Looks like connection problem");
-        if (!isScillaRuning()) {
-          LOG_GENERAL(WARNING, "Scilla is not running");
-          CheckClient(version,true);
-        }
-        return CallChecker(version, _json, result, counter - 1);
-      }
-      result = e.what();
+  bool dropped = false;
+  for (auto& waiting : it->second.waiting) {
+    if (*waiting.first == _json) {
+      waiting.second = true;
+      dropped = true;
     }
-
-    return false;
+  }
+  if (dropped) {
+    it->second.cvIdle.notify_all();
   }
 
-  return true;
-}
-
-bool ScillaClient::CallDisambiguate(uint32_t version, const Json::Value& _json,
-                                    std::string& result, uint32_t counter) {
-  if (counter == 0) {
-    return false;
+  for (auto& worker : it->second.workers) {
+    if (worker->request == nullptr || *worker->request != _json) {
+      continue;
+    }
+    LOG_GENERAL(WARNING, "Stopping scilla-server on " << worker->socketPath
+                                                      << " serving a timed "
+                                                         "out call");
+    worker->cancelled = true;
+    if (worker->pid > 0) {
+      kill(worker->pid, SIGKILL);
+    }
   }
+}
 
+bool ScillaClient::Call(uint32_t version, const std::string& method,
+                        const Json::Value& _json, std::string& result,
+                        uint32_t counter) {
   if (!ENABLE_SCILLA_MULTI_VERSION) {
     version = 0;
   }
 
-  if (!CheckClient(version)) {
-    LOG_GENERAL(WARNING, "CheckClient failed");
-    return false;
-  }
+  for (; counter > 0; --counter) {
+    bool cancelled = false;
+    Worker* worker = AcquireWorker(version, _json, cancelled);
+    if (worker == nullptr) {
+      if (cancelled) {
+        LOG_GENERAL(WARNING, "Call " << method
+                                     << " to scilla-server of version "
+                                     << version << " was cancelled");
+      } else {
+        LOG_GENERAL(WARNING, "No scilla-server for version " << version);
+      }
+      return false;
+    }
 
-  try {
-    std::lock_guard<std::mutex> g(m_mutexMain);
-    result =
-        m_clients.at(version)->CallMethod("disambiguate", _json).asString();
-  } catch (jsonrpc::JsonRpcException& e) {
-    LOG_GENERAL(WARNING, "CallDisambiguate failed: " << e.what());
-    if (std::string(e.what()).find(SCILLA_SERVER_SOCKET_PATH) !=
-        std::string::npos) {
-      if (!CheckClient(version, true)) {
-        LOG_GENERAL(WARNING, "CheckClient for version " << version << "failed");
-        return CallDisambiguate(version, _json, result, counter - 1);
+    try {
+      result = worker->client->CallMethod(method, _json).asString();
+      ReleaseWorker(*worker, false);
+      return true;
+    } catch (jsonrpc::JsonRpcException& e) {
+      LOG_GENERAL(WARNING, "Call " << method << " failed: " << e.what());
+      const bool socketError = std::string(e.what()).find(
+                                   SCILLA_SERVER_SOCKET_PATH) !=
+                               std::string::npos;
+      if (!socketError &&
+          e.GetCode() != jsonrpc::Errors::ERROR_RPC_JSON_PARSE_ERROR &&
+          e.GetCode() != jsonrpc::Errors::ERROR_CLIENT_CONNECTOR) {
+        result = e.what();
+        ReleaseWorker(*worker, false);
+        return false;
       }
-    } else {
-      if (e.GetCode() == jsonrpc::Errors::ERROR_RPC_JSON_PARSE_ERROR ||
-          e.GetCode() == jsonrpc::Errors::ERROR_CLIENT_CONNECTOR){
-        LOG_GENERAL(WARNING, "Looks like connection problem");
-        if (!isScillaRuning()) {
-          LOG_GENERAL(WARNING, "Scilla is not running");
-          CheckClient(version,true);
-        }
-        return CallChecker(version, _json, result, counter - 1);
+
+      LOG_GENERAL(WARNING, "Looks like connection problem");
+      std::error_code ec;
+      const bool restart = socketError || !worker->process.running(ec);
+      if (!ReleaseWorker(*worker, restart)) {
+        LOG_GENERAL(WARNING, "Call " << method << " was cancelled");
+        return false;
       }
-      result = e.what();
     }
-
-    return false;
   }
 
-  return true;
+  return false;
+}
+
+bool ScillaClient::CallChecker(uint32_t version, const Json::Value& _json,
+                               std::string& result, uint32_t counter) {
+  return Call(version, "check", _json, result, counter);
+}
+
+bool ScillaClient::CallRunner(uint32_t version, const Json::Value& _json,
+                              std::string& result, uint32_t counter) {
+  return Call(version, "run", _json, result, counter);
+}
+
+bool ScillaClient::CallDisambiguate(uint32_t version, const Json::Value& _json,
+                                    std::string& result, uint32_t counter) {
+  return Call(version, "disambiguate", _json, result, counter);
 }
@@ -18,23 +18,75 @@
 #ifndef ZILLIQA_SRC_LIBSCILLA_SCILLACLIENT_H_
 #define ZILLIQA_SRC_LIBSCILLA_SCILLACLIENT_H_
 
+#include <sys/types.h>
+
+#include <condition_variable>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/process/child.hpp>
 
 #include "common/Constants.h"
 #include "libScilla/UnixDomainSocketClient.h"
 
+/// Talks to the scilla-server processes, SCILLA_SERVER_POOL_SIZE of them per
+/// Scilla version. Each call is served by an idle worker of its version, so
+/// independent calls run side by side; a worker that stops responding is
+/// restarted on its own without touching the others.
 class ScillaClient {
-  std::map<uint32_t, std::unique_ptr<jsonrpc::Client>> m_clients;
-  std::map<uint32_t, std::unique_ptr<rpc::UnixDomainSocketClient>> m_connectors;
+  struct Worker {
+    uint32_t version = 0;
+    std::string socketPath;
+    boost::process::child process;
+    pid_t pid = 0;
+    std::unique_ptr<rpc::UnixDomainSocketClient> connector;
+    std::unique_ptr<jsonrpc::Client> client;
+    /// owned by a thread, either serving a call or being (re)started
+    bool busy = false;
+    /// the request being served, nullptr if none
+    const Json::Value* request = nullptr;
+    /// the caller gave up on the request, so it must not be retried
+    bool cancelled = false;
+  };
+
+  struct Pool {
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::condition_variable cvIdle;
+    /// requests waiting for an idle worker, set once they are cancelled
+    std::map<const Json::Value*, bool> waiting;
+  };
+
+  std::map<uint32_t, Pool> m_pools;
 
   std::mutex m_mutexMain;
 
+  std::thread m_healthCheckThread;
+  std::condition_variable m_cvHealthCheck;
+  bool m_stopHealthCheck = false;
+
   ScillaClient() = default;
   ~ScillaClient();
 
-  bool OpenServer(uint32_t version);
+  Pool& GetPool(uint32_t version);
+
+  bool OpenServer(Worker& worker);
+
+  /// Returns nullptr if no worker could be started, or with cancelled set if
+  /// the call was reset while waiting or while its worker started up.
+  Worker* AcquireWorker(uint32_t version, const Json::Value& request,
+                        bool& cancelled);
+
+  /// Hands the worker back, restarting it first if restart is set. Returns
+  /// false if the request it served was cancelled.
+  bool ReleaseWorker(Worker& worker, bool restart);
+
+  void HealthCheck();
+
+  bool Call(uint32_t version, const std::string& method,
+            const Json::Value& _json, std::string& result, uint32_t counter);
 
  public:
   static ScillaClient& GetInstance() {
@@ -42,11 +94,17 @@ class ScillaClient {
     return scillaclient;
   }
 
+  /// Starts the workers of version that are not running. With enforce,
+  /// every worker of version is restarted, including busy ones.
   bool CheckClient(uint32_t version, bool enforce = false);
 
-  void Init();
+  /// Restarts the worker still serving _json, if any, and makes the pending
+  /// call fail instead of being retried. A call still waiting for an idle
+  /// worker is dropped. Requests carry the paths of their own workspace, so
+  /// they identify a single call.
+  void ResetWorker(uint32_t version, const Json::Value& _json);
 
-  bool isScillaRuning();
+  void Init();
 
   bool CallChecker(uint32_t version, const Json::Value& _json,
                    std::string& result, uint32_t counter = MAXRETRYCONN);
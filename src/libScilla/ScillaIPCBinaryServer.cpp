@@ -0,0 +1,324 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ScillaIPCBinaryServer.h"
+
+#include <array>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include <boost/asio.hpp>
+
+#include "ScillaIPCServer.h"
+#include "libMetrics/Api.h"
+#include "libUtils/Logger.h"
+
+using boost::asio::local::stream_protocol;
+
+namespace {
+
+void EncodeLength(uint32_t length, std::array<uint8_t, 4>& out) {
+  out[0] = static_cast<uint8_t>(length >> 24);
+  out[1] = static_cast<uint8_t>(length >> 16);
+  out[2] = static_cast<uint8_t>(length >> 8);
+  out[3] = static_cast<uint8_t>(length);
+}
+
+uint32_t DecodeLength(const std::array<uint8_t, 4>& in) {
+  return (static_cast<uint32_t>(in[0]) << 24) |
+         (static_cast<uint32_t>(in[1]) << 16) |
+         (static_cast<uint32_t>(in[2]) << 8) | static_cast<uint32_t>(in[3]);
+}
+
+void AppendString(std::string& out, const std::string& value) {
+  std::array<uint8_t, 4> length;
+  EncodeLength(static_cast<uint32_t>(value.size()), length);
+  out.append(length.begin(), length.end());
+  out += value;
+}
+
+class Reader {
+ public:
+  explicit Reader(const std::string& data) : m_data(data) {}
+
+  bool ReadByte(uint8_t& out) {
+    if (m_pos + 1 > m_data.size()) {
+      return false;
+    }
+    out = static_cast<uint8_t>(m_data[m_pos++]);
+    return true;
+  }
+
+  bool ReadLength(uint32_t& out) {
+    if (m_pos + 4 > m_data.size()) {
+      return false;
+    }
+    std::array<uint8_t, 4> length;
+    std::copy_n(m_data.begin() + m_pos, 4, length.begin());
+    m_pos += 4;
+    out = DecodeLength(length);
+    return true;
+  }
+
+  bool ReadString(std::string& out) {
+    uint32_t length = 0;
+    if (!ReadLength(length) || length > m_data.size() - m_pos) {
+      return false;
+    }
+    out.assign(m_data, m_pos, length);
+    m_pos += length;
+    return true;
+  }
+
+  bool AtEnd() const { return m_pos == m_data.size(); }
+
+ private:
+  const std::string& m_data;
+  size_t m_pos = 0;
+};
+
+Z_I64METRIC& GetRequestsCounter() {
+  static Z_I64METRIC requests(Z_FL::SCILLA_IPC, "scilla_ipc_binary_requests",
+                              "Binary state query frames served", "Frames");
+  return requests;
+}
+
+}  // namespace
+
+// One persistent connection from an interpreter. Owned by the handler of its
+// pending operation, so it goes away once the peer closes the socket or the
+// io_context is destroyed.
+class ScillaIPCBinaryServer::Session
+    : public std::enable_shared_from_this<Session> {
+ public:
+  Session(ScillaIPCBinaryServer& owner, stream_protocol::socket socket)
+      : m_owner(owner), m_socket(std::move(socket)) {}
+
+  void ReadHeader() {
+    boost::asio::async_read(
+        m_socket, boost::asio::buffer(m_header),
+        [self = shared_from_this()](const boost::system::error_code& ec,
+                                    size_t) {
+          if (ec) {
+            return;
+          }
+          const uint32_t length = DecodeLength(self->m_header);
+          if (length == 0 || length > MAX_FRAME_SIZE) {
+            LOG_GENERAL(WARNING, "Dropping connection after a frame of "
+                                     << length << " bytes");
+            return;
+          }
+          self->m_request.resize(length);
+          self->ReadBody();
+        });
+  }
+
+ private:
+  void ReadBody() {
+    boost::asio::async_read(
+        m_socket, boost::asio::buffer(m_request),
+        [self = shared_from_this()](const boost::system::error_code& ec,
+                                    size_t) {
+          if (ec) {
+            return;
+          }
+          self->m_owner.HandleRequest(self->m_request, self->m_response);
+          self->Write();
+        });
+  }
+
+  void Write() {
+    EncodeLength(static_cast<uint32_t>(m_response.size()), m_header);
+    const std::array<boost::asio::const_buffer, 2> buffers{
+        boost::asio::buffer(m_header), boost::asio::buffer(m_response)};
+    boost::asio::async_write(
+        m_socket, buffers,
+        [self = shared_from_this()](const boost::system::error_code& ec,
+                                    size_t) {
+          if (ec) {
+            LOG_GENERAL(WARNING, "Write failed: " << ec.message());
+            return;
+          }
+          self->ReadHeader();
+        });
+  }
+
+  ScillaIPCBinaryServer& m_owner;
+  stream_protocol::socket m_socket;
+  std::array<uint8_t, 4> m_header{};
+  std::string m_request;
+  std::string m_response;
+};
+
+ScillaIPCBinaryServer::ScillaIPCBinaryServer(ScillaIPCServer& server,
+                                             std::string path)
+    : m_server(server), m_path(std::move(path)) {}
+
+ScillaIPCBinaryServer::~ScillaIPCBinaryServer() { StopListening(); }
+
+bool ScillaIPCBinaryServer::StartListening() {
+  if (m_started) {
+    return false;
+  }
+
+  m_asio.emplace(1);
+  try {
+    std::remove(m_path.c_str());
+    m_acceptor.emplace(*m_asio, stream_protocol::endpoint(m_path));
+  } catch (const std::exception& e) {
+    LOG_GENERAL(WARNING,
+                "Start listening to " << m_path << " failed: " << e.what());
+    m_acceptor.reset();
+    m_asio.reset();
+    return false;
+  }
+
+  Accept();
+  m_started = true;
+  m_thread.emplace([this] {
+    try {
+      m_asio->run();
+    } catch (const std::exception& e) {
+      LOG_GENERAL(WARNING,
+                  "Listening to " << m_path << " failed: " << e.what());
+    }
+  });
+
+  return true;
+}
+
+bool ScillaIPCBinaryServer::StopListening() {
+  if (!m_started) {
+    return false;
+  }
+
+  m_started = false;
+  m_asio->stop();
+  m_thread->join();
+  m_thread.reset();
+  // Destroying the io_context drops the pending handlers and with them every
+  // open session.
+  m_acceptor.reset();
+  m_asio.reset();
+  std::remove(m_path.c_str());
+  return true;
+}
+
+void ScillaIPCBinaryServer::Accept() {
+  m_acceptor->async_accept([this](const boost::system::error_code& ec,
+                                  stream_protocol::socket socket) {
+    if (ec) {
+      if (ec != boost::asio::error::operation_aborted) {
+        LOG_GENERAL(WARNING, "Accept on " << m_path
+                                          << " failed: " << ec.message());
+      }
+      return;
+    }
+    std::make_shared<Session>(*this, std::move(socket))->ReadHeader();
+    Accept();
+  });
+}
+
+void ScillaIPCBinaryServer::HandleRequest(const std::string& request,
+                                          std::string& response) {
+  auto fail = [&response](const std::string& error) {
+    LOG_GENERAL(WARNING, error);
+    response.assign(1, static_cast<char>(Status::FAILED));
+    response += error;
+  };
+
+  Reader reader(request);
+  uint8_t methodByte = 0;
+  uint32_t count = 0;
+  if (!reader.ReadByte(methodByte) || !reader.ReadLength(count)) {
+    fail("Malformed request header");
+    return;
+  }
+
+  const auto method = static_cast<Method>(methodByte);
+  size_t fields = 0;
+  std::string name;
+  switch (method) {
+    case Method::FETCH_STATE_VALUE:
+      fields = 1;
+      name = "fetchStateValue";
+      break;
+    case Method::UPDATE_STATE_VALUE:
+      fields = 2;
+      name = "updateStateValue";
+      break;
+    case Method::FETCH_EXTERNAL_STATE_VALUE:
+      fields = 2;
+      name = "fetchExternalStateValue";
+      break;
+    default:
+      fail("Unknown method " + std::to_string(methodByte));
+      return;
+  }
+  GetRequestsCounter().IncrementAttr({{"method", name}});
+
+  // Decode the whole batch first so a malformed frame never applies a
+  // partial update.
+  std::vector<std::string> args;
+  args.reserve(std::min<size_t>(count * fields, request.size() / 4));
+  for (size_t i = 0; i < count * fields; ++i) {
+    args.emplace_back();
+    if (!reader.ReadString(args.back())) {
+      fail("Malformed " + name + " entry " + std::to_string(i / fields));
+      return;
+    }
+  }
+  if (!reader.AtEnd()) {
+    fail("Trailing bytes after " + name + " request");
+    return;
+  }
+
+  response.assign(1, static_cast<char>(Status::OK));
+  std::string value;
+  std::string type;
+  for (size_t i = 0; i < count; ++i) {
+    const auto* entry = &args[i * fields];
+    bool found = false;
+    switch (method) {
+      case Method::FETCH_STATE_VALUE:
+        if (!m_server.fetchStateValue(entry[0], value, found)) {
+          fail("Fetching state value failed");
+          return;
+        }
+        response.push_back(found ? 1 : 0);
+        AppendString(response, value);
+        break;
+      case Method::UPDATE_STATE_VALUE:
+        if (!m_server.updateStateValue(entry[0], entry[1])) {
+          fail("Updating state value failed at entry " + std::to_string(i));
+          return;
+        }
+        break;
+      case Method::FETCH_EXTERNAL_STATE_VALUE:
+        if (!m_server.fetchExternalStateValue(entry[0], entry[1], value, found,
+                                              type)) {
+          fail("Fetching external state value failed");
+          return;
+        }
+        response.push_back(found ? 1 : 0);
+        AppendString(response, value);
+        AppendString(response, type);
+        break;
+    }
+  }
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ZILLIQA_SRC_LIBSCILLA_SCILLAIPCBINARYSERVER_H_
+#define ZILLIQA_SRC_LIBSCILLA_SCILLAIPCBINARYSERVER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+
+class ScillaIPCServer;
+
+/*
+ * ScillaIPCBinaryServer
+ * Serves contract state queries from the Scilla interpreter over a unix
+ * socket without going through jsonrpccpp. Connections are persistent and
+ * every frame is a u32 big-endian length followed by the payload; strings
+ * inside a payload are themselves u32 length-prefixed.
+ *
+ * Request payload: a method byte, a u32 entry count, then per entry
+ *   FETCH_STATE_VALUE           query
+ *   UPDATE_STATE_VALUE          query, value
+ *   FETCH_EXTERNAL_STATE_VALUE  addr, query
+ * where query and value are serialized ProtoScillaQuery / ProtoScillaVal.
+ *
+ * Response payload: a status byte (0 = OK, 1 = UTF-8 error text follows),
+ * then per entry
+ *   FETCH_STATE_VALUE           found byte, value
+ *   UPDATE_STATE_VALUE          nothing
+ *   FETCH_EXTERNAL_STATE_VALUE  found byte, value, type
+ *
+ * Entries of a batch are handled in order against the same ScillaIPCServer
+ * that serves the JSON-RPC methods, so both share the contract context set
+ * through setBCInfoProvider. An update batch stops at the first failure.
+ */
+
+class ScillaIPCBinaryServer {
+ public:
+  enum class Method : uint8_t {
+    FETCH_STATE_VALUE = 1,
+    UPDATE_STATE_VALUE = 2,
+    FETCH_EXTERNAL_STATE_VALUE = 3,
+  };
+
+  enum class Status : uint8_t { OK = 0, FAILED = 1 };
+
+  ScillaIPCBinaryServer(ScillaIPCServer& server, std::string path);
+  ~ScillaIPCBinaryServer();
+
+  ScillaIPCBinaryServer(const ScillaIPCBinaryServer&) = delete;
+  ScillaIPCBinaryServer& operator=(const ScillaIPCBinaryServer&) = delete;
+
+  bool StartListening();
+  bool StopListening();
+
+  // HandleRequest
+  // Decodes one request payload and encodes its response payload.
+  void HandleRequest(const std::string& request, std::string& response);
+
+  static constexpr uint32_t MAX_FRAME_SIZE = 64 * 1024 * 1024;
+
+ private:
+  class Session;
+
+  void Accept();
+
+  ScillaIPCServer& m_server;
+  const std::string m_path;
+  std::optional<boost::asio::io_context> m_asio;
+  std::optional<boost::asio::local::stream_protocol::acceptor> m_acceptor;
+  std::optional<std::thread> m_thread;
+  std::atomic<bool> m_started{};
+};
+
+#endif  // ZILLIQA_SRC_LIBSCILLA_SCILLAIPCBINARYSERVER_H_
@@ -459,16 +459,20 @@ void ScillaIPCServer::fetchCodeJsonI(const Json::Value &request,
     return;
   }
 
+  // Runs while the caller's own invocation is in flight, so it needs its own
+  // workspace.
+  ScillaWorkspace workspace;
   if (!ScillaUtils::ExportCreateContractFiles(
-          account->GetCode(), account->GetInitData(), isLibrary, rootVersion,
-          scillaVersion, extlibsExports)) {
+          workspace, account->GetCode(), account->GetInitData(), isLibrary,
+          rootVersion, scillaVersion, extlibsExports)) {
     LOG_GENERAL(WARNING, "Failed to export contract create files");
     return;
   }
   constexpr auto GAS_LIMIT = std::numeric_limits<uint32_t>::max();
   std::string interprinterPrint;
   const auto callCheckerInput =
-      ScillaUtils::GetContractCheckerJson(rootVersion, false, GAS_LIMIT);
+      ScillaUtils::GetContractCheckerJson(workspace, rootVersion, false,
+                                          GAS_LIMIT);
   JSONUtils::GetInstance().convertJsontoStr(callCheckerInput);
   if (!ScillaClient::GetInstance().CallChecker(0, callCheckerInput,
                                                interprinterPrint)) {
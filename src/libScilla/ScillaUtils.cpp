@@ -17,7 +17,6 @@
 
 #include "ScillaUtils.h"
 
-
 #include "common/Constants.h"
 #include "libData/AccountStore/AccountStore.h"
 #include "libUtils/DataConversion.h"
@@ -42,20 +41,34 @@ bool ScillaUtils::PrepareRootPathWVersion(const uint32_t& scilla_version,
   return true;
 }
 
-Json::Value ScillaUtils::GetContractCheckerJson(const string& root_w_version,
-                                                bool is_library,
-                                                const uint64_t& available_gas) {
+namespace {
+
+string GetLibDir(const string& root_w_version) {
+  return root_w_version + '/' + SCILLA_LIB + ":" +
+         std::filesystem::current_path().string() + '/' + EXTLIB_FOLDER;
+}
+
+void AppendIPCAddress(Json::Value& argv) {
+  argv.append("-ipcaddress");
+  argv.append(SCILLA_IPC_SOCKET_PATH);
+  // State queries go over the binary socket, everything else over JSON-RPC.
+  if (ENABLE_SCILLA_IPC_BINARY) {
+    argv.append("-ipcbinaryaddress");
+    argv.append(SCILLA_IPC_BINARY_SOCKET_PATH);
+  }
+}
+
+}  // namespace
+
+Json::Value ScillaUtils::GetContractCheckerJson(
+    const ScillaWorkspace& workspace, const string& root_w_version,
+    bool is_library, const uint64_t& available_gas) {
   Json::Value ret;
   ret["argv"].append("-init");
-  ret["argv"].append(std::filesystem::current_path().string() + '/' +
-                     INIT_JSON);
+  ret["argv"].append(workspace.GetInitJsonPath());
   ret["argv"].append("-libdir");
-  ret["argv"].append(root_w_version + '/' + SCILLA_LIB + ":" +
-                     std::filesystem::current_path().string() + '/' +
-                     EXTLIB_FOLDER);
-  ret["argv"].append(
-      std::filesystem::current_path().string() + '/' + INPUT_CODE +
-      (is_library ? LIBRARY_CODE_EXTENSION : CONTRACT_FILE_EXTENSION));
+  ret["argv"].append(GetLibDir(root_w_version));
+  ret["argv"].append(workspace.GetCodePath(is_library));
   ret["argv"].append("-gaslimit");
   ret["argv"].append(to_string(available_gas));
   ret["argv"].append("-contractinfo");
@@ -63,64 +76,49 @@ Json::Value ScillaUtils::GetContractCheckerJson(const string& root_w_version,
   return ret;
 }
 
-Json::Value ScillaUtils::GetCreateContractJson(const string& root_w_version,
-                                               bool is_library,
-                                               const uint64_t& available_gas,
-                                               const uint128_t& balance) {
+Json::Value ScillaUtils::GetCreateContractJson(
+    const ScillaWorkspace& workspace, const string& root_w_version,
+    bool is_library, const uint64_t& available_gas, const uint128_t& balance) {
   Json::Value ret;
   ret["argv"].append("-init");
-  ret["argv"].append(std::filesystem::current_path().string() + '/' +
-                     INIT_JSON);
-  ret["argv"].append("-ipcaddress");
-  ret["argv"].append(SCILLA_IPC_SOCKET_PATH);
+  ret["argv"].append(workspace.GetInitJsonPath());
+  AppendIPCAddress(ret["argv"]);
   ret["argv"].append("-o");
-  ret["argv"].append(std::filesystem::current_path().string() + '/' +
-                     OUTPUT_JSON);
+  ret["argv"].append(workspace.GetOutputJsonPath());
   ret["argv"].append("-i");
-  ret["argv"].append(
-      std::filesystem::current_path().string() + '/' + INPUT_CODE +
-      (is_library ? LIBRARY_CODE_EXTENSION : CONTRACT_FILE_EXTENSION));
+  ret["argv"].append(workspace.GetCodePath(is_library));
   ret["argv"].append("-gaslimit");
   ret["argv"].append(to_string(available_gas));
   ret["argv"].append("-balance");
   ret["argv"].append(balance.convert_to<string>());
   ret["argv"].append("-libdir");
-  ret["argv"].append(root_w_version + '/' + SCILLA_LIB + ":" +
-                     std::filesystem::current_path().string() + '/' +
-                     EXTLIB_FOLDER);
+  ret["argv"].append(GetLibDir(root_w_version));
   ret["argv"].append("-jsonerrors");
 
   return ret;
 }
 
-Json::Value ScillaUtils::GetCallContractJson(const string& root_w_version,
+Json::Value ScillaUtils::GetCallContractJson(const ScillaWorkspace& workspace,
+                                             const string& root_w_version,
                                              const uint64_t& available_gas,
                                              const uint128_t& balance,
                                              const bool& is_library) {
   Json::Value ret;
   ret["argv"].append("-init");
-  ret["argv"].append(std::filesystem::current_path().string() + '/' +
-                     INIT_JSON);
-  ret["argv"].append("-ipcaddress");
-  ret["argv"].append(SCILLA_IPC_SOCKET_PATH);
+  ret["argv"].append(workspace.GetInitJsonPath());
+  AppendIPCAddress(ret["argv"]);
   ret["argv"].append("-imessage");
-  ret["argv"].append(std::filesystem::current_path().string() + '/' +
-                     INPUT_MESSAGE_JSON);
+  ret["argv"].append(workspace.GetInputMessageJsonPath());
   ret["argv"].append("-o");
-  ret["argv"].append(std::filesystem::current_path().string() + '/' +
-                     OUTPUT_JSON);
+  ret["argv"].append(workspace.GetOutputJsonPath());
   ret["argv"].append("-i");
-  ret["argv"].append(
-      std::filesystem::current_path().string() + '/' + INPUT_CODE +
-      (is_library ? LIBRARY_CODE_EXTENSION : CONTRACT_FILE_EXTENSION));
+  ret["argv"].append(workspace.GetCodePath(is_library));
   ret["argv"].append("-gaslimit");
   ret["argv"].append(to_string(available_gas));
   ret["argv"].append("-balance");
   ret["argv"].append(balance.convert_to<string>());
   ret["argv"].append("-libdir");
-  ret["argv"].append(root_w_version + '/' + SCILLA_LIB + ":" +
-                     std::filesystem::current_path().string() + '/' +
-                     EXTLIB_FOLDER);
+  ret["argv"].append(GetLibDir(root_w_version));
   ret["argv"].append("-jsonerrors");
   ret["argv"].append("-pplit");
   ret["argv"].append(SCILLA_PPLIT_FLAG ? "true" : "false");
@@ -128,67 +126,50 @@ Json::Value ScillaUtils::GetCallContractJson(const string& root_w_version,
   return ret;
 }
 
-Json::Value ScillaUtils::GetDisambiguateJson() {
+Json::Value ScillaUtils::GetDisambiguateJson(const ScillaWorkspace& workspace) {
   Json::Value ret;
   ret["argv"].append("-iinit");
-  ret["argv"].append(std::filesystem::current_path().string() + '/' +
-                     INIT_JSON);
-  ret["argv"].append("-ipcaddress");
-  ret["argv"].append(SCILLA_IPC_SOCKET_PATH);
+  ret["argv"].append(workspace.GetInitJsonPath());
+  AppendIPCAddress(ret["argv"]);
   ret["argv"].append("-oinit");
-  ret["argv"].append(std::filesystem::current_path().string() + '/' +
-                     OUTPUT_JSON);
+  ret["argv"].append(workspace.GetOutputJsonPath());
   ret["argv"].append("-i");
-  ret["argv"].append(std::filesystem::current_path().string() + '/' +
-                     INPUT_CODE + CONTRACT_FILE_EXTENSION);
+  ret["argv"].append(workspace.GetCodePath(false));
 
   return ret;
 }
 
-void ScillaUtils::ExportCommonFiles(
-    const std::vector<uint8_t>& contract_init_data, std::ofstream& os,
+bool ScillaUtils::ExportCommonFiles(
+    ScillaWorkspace& workspace, const std::vector<uint8_t>& contract_init_data,
     const std::map<Address, std::pair<std::string, std::string>>&
         extlibs_exports) {
-  os.open(INIT_JSON);
   if (LOG_SC) {
     LOG_GENERAL(INFO,
                 "init data to export: "
                     << DataConversion::CharArrayToString(contract_init_data));
   }
-  os << DataConversion::CharArrayToString(contract_init_data);
-  os.close();
-
-  for (const auto& extlib_export : extlibs_exports) {
-    std::string code_path =
-        EXTLIB_FOLDER + '/' + "0x" + extlib_export.first.hex();
-    code_path += LIBRARY_CODE_EXTENSION;
-    std::filesystem::remove(code_path);
-
-    os.open(code_path);
-    os << extlib_export.second.first;
-    os.close();
-
-    std::string init_path =
-        EXTLIB_FOLDER + '/' + "0x" + extlib_export.first.hex() + ".json";
-    std::filesystem::remove(init_path);
-
-    os.open(init_path);
-    os << extlib_export.second.second;
-    os.close();
+  if (!workspace.ExportInitJson(
+          DataConversion::CharArrayToString(contract_init_data))) {
+    LOG_GENERAL(WARNING, "Failed to export init json");
+    return false;
+  }
+
+  if (!ScillaWorkspace::ExportExtlibs(extlibs_exports)) {
+    LOG_GENERAL(WARNING, "Failed to export extlibs");
+    return false;
   }
+
+  return true;
 }
 
 bool ScillaUtils::ExportCreateContractFiles(
-    const std::vector<uint8_t>& contract_code,
+    ScillaWorkspace& workspace, const std::vector<uint8_t>& contract_code,
     const std::vector<uint8_t>& contract_init_data, bool is_library,
     std::string& scilla_root_version, uint32_t scilla_version,
     const std::map<Address, std::pair<std::string, std::string>>&
         extlibs_exports) {
   LOG_MARKER();
 
-  std::filesystem::remove_all("./" + SCILLA_FILES);
-  std::filesystem::create_directories("./" + SCILLA_FILES);
-
   if (!(std::filesystem::exists("./" + SCILLA_LOG))) {
     std::filesystem::create_directories("./" + SCILLA_LOG);
   }
@@ -199,20 +180,25 @@ bool ScillaUtils::ExportCreateContractFiles(
     return false;
   }
 
+  if (!workspace.IsReady()) {
+    LOG_GENERAL(WARNING, "Scilla workspace not available");
+    return false;
+  }
+
   try {
     // Scilla code
-    std::ofstream os(INPUT_CODE + (is_library ? LIBRARY_CODE_EXTENSION
-                                              : CONTRACT_FILE_EXTENSION));
-    os << DataConversion::CharArrayToString(contract_code);
-    os.close();
+    if (!workspace.ExportCode(DataConversion::CharArrayToString(contract_code),
+                              is_library)) {
+      LOG_GENERAL(WARNING, "Failed to export contract code");
+      return false;
+    }
 
-    ScillaUtils::ExportCommonFiles(contract_init_data, os, extlibs_exports);
+    return ScillaUtils::ExportCommonFiles(workspace, contract_init_data,
+                                          extlibs_exports);
   } catch (const std::exception& e) {
     LOG_GENERAL(WARNING, "Exception caught: " << e.what());
     return false;
   }
-
-  return true;
 }
 
 bool ScillaUtils::PopulateExtlibsExports(
@@ -239,15 +225,6 @@ bool ScillaUtils::PopulateExtlibsExports(
         return false;
       }
 
-      /// Check whether there are caches
-      std::string code_path = EXTLIB_FOLDER + '/' + libAddr.hex();
-      code_path += LIBRARY_CODE_EXTENSION;
-      std::string json_path = EXTLIB_FOLDER + '/' + libAddr.hex() + ".json";
-      if (std::filesystem::exists(code_path) &&
-          std::filesystem::exists(json_path)) {
-        continue;
-      }
-
       uint32_t ext_scilla_version;
       bool ext_is_lib = false;
       std::vector<Address> ext_extlibs;
@@ -19,8 +19,10 @@
 #define ZILLIQA_SRC_LIBSCILLA_SCILLAUTILS_H_
 
 #include "common/FixedHash.h"
+#include "libScilla/ScillaWorkspace.h"
 
 #include <fstream>
+#include <map>
 
 #include <json/json.h>
 
@@ -36,33 +38,36 @@ class ScillaUtils {
                                       std::string& root_w_version);
 
   /// get the command for invoking the scilla_checker while deploying
-  static Json::Value GetContractCheckerJson(const std::string& root_w_version,
+  static Json::Value GetContractCheckerJson(const ScillaWorkspace& workspace,
+                                            const std::string& root_w_version,
                                             bool is_library,
                                             const uint64_t& available_gas);
 
   /// get the command for invoking the scilla_runner while deploying
   static Json::Value GetCreateContractJson(
-      const std::string& root_w_version, bool is_library,
-      const uint64_t& available_gas,
+      const ScillaWorkspace& workspace, const std::string& root_w_version,
+      bool is_library, const uint64_t& available_gas,
       const boost::multiprecision::uint128_t& balance);
 
   /// get the command for invoking the scilla_runner while calling
   static Json::Value GetCallContractJson(
-      const std::string& root_w_version, const uint64_t& available_gas,
+      const ScillaWorkspace& workspace, const std::string& root_w_version,
+      const uint64_t& available_gas,
       const boost::multiprecision::uint128_t& balance, const bool& is_library);
 
   /// get the command for invoking disambiguate_state_json while calling
-  static Json::Value GetDisambiguateJson();
+  static Json::Value GetDisambiguateJson(const ScillaWorkspace& workspace);
 
   /// export files that ExportCreateContractFiles and ExportContractFiles
   /// both needs
-  static void ExportCommonFiles(
-      const std::vector<uint8_t>& contract_init_data, std::ofstream& os,
+  static bool ExportCommonFiles(
+      ScillaWorkspace& workspace,
+      const std::vector<uint8_t>& contract_init_data,
       const std::map<Address, std::pair<std::string, std::string>>&
           extlibs_exports);
 
   static bool ExportCreateContractFiles(
-      const std::vector<uint8_t>& contract_code,
+      ScillaWorkspace& workspace, const std::vector<uint8_t>& contract_code,
       const std::vector<uint8_t>& contract_init_data, bool is_library,
       std::string& scilla_root_version, uint32_t scilla_version,
       const std::map<Address, std::pair<std::string, std::string>>&
@@ -0,0 +1,340 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ScillaWorkspace.h"
+
+#include <signal.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <fstream>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "common/Constants.h"
+#include "libCrypto/Sha2.h"
+#include "libUtils/DataConversion.h"
+#include "libUtils/JsonUtils.h"
+#include "libUtils/Logger.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+const std::string CODE_CACHE_DIR = "code";
+
+std::atomic<uint64_t> g_workspaceCount{0};
+std::atomic<uint64_t> g_tempFileCount{0};
+
+std::string GetCodeExtension(bool is_library) {
+  return is_library ? LIBRARY_CODE_EXTENSION : CONTRACT_FILE_EXTENSION;
+}
+
+std::string HashContent(const std::string& content) {
+  SHA256Calculator sha2;
+  sha2.Update(content);
+  std::string hash;
+  DataConversion::Uint8VecToHexStr(sha2.Finalize(), hash);
+  return hash;
+}
+
+bool WriteFile(const fs::path& path, const std::string& content) {
+  std::ofstream os(path, std::ios::binary | std::ios::trunc);
+  os << content;
+  os.close();
+  if (!os) {
+    LOG_GENERAL(WARNING, "Failed to write " << path);
+    return false;
+  }
+  return true;
+}
+
+/// Writes to a temporary file next to path and renames it into place, so
+/// readers either see the old or the new content but never a partial one.
+bool WriteFileAtomically(const fs::path& path, const std::string& content) {
+  fs::path tmpPath = path;
+  tmpPath += ".tmp." + std::to_string(getpid()) + '.' +
+             std::to_string(g_tempFileCount++);
+  if (!WriteFile(tmpPath, content)) {
+    std::error_code ec;
+    fs::remove(tmpPath, ec);
+    return false;
+  }
+
+  std::error_code ec;
+  fs::rename(tmpPath, path, ec);
+  if (ec) {
+    LOG_GENERAL(WARNING, "Failed to rename " << tmpPath << " to " << path
+                                             << ": " << ec.message());
+    fs::remove(tmpPath, ec);
+    return false;
+  }
+  return true;
+}
+
+/// Removes the directories left behind by earlier processes. Every process
+/// works below a directory named after its pid, so anything whose owner is
+/// gone (or whose pid got reused by us) can go.
+void RemoveStaleDirectories(const fs::path& base) {
+  std::error_code ec;
+  for (const auto& entry : fs::directory_iterator(base, ec)) {
+    const std::string name = entry.path().filename().string();
+    if (name.empty() ||
+        name.find_first_not_of("0123456789") != std::string::npos) {
+      continue;
+    }
+
+    pid_t pid = 0;
+    try {
+      pid = static_cast<pid_t>(std::stol(name));
+    } catch (const std::exception&) {
+      continue;
+    }
+
+    if (pid == getpid() || (kill(pid, 0) != 0 && errno == ESRCH)) {
+      std::error_code removeEc;
+      fs::remove_all(entry.path(), removeEc);
+    }
+  }
+}
+
+fs::path ResolveRoot() {
+  const fs::path fallback = fs::current_path() / SCILLA_FILES;
+
+  fs::path base = SCILLA_WORKSPACE_ROOT.empty()
+                      ? fallback
+                      : fs::absolute(SCILLA_WORKSPACE_ROOT);
+  std::error_code ec;
+  fs::create_directories(base, ec);
+  if (ec && base != fallback) {
+    LOG_GENERAL(WARNING, "Cannot use " << base << " for Scilla workspaces ("
+                                       << ec.message() << "), using "
+                                       << fallback);
+    base = fallback;
+    ec.clear();
+    fs::create_directories(base, ec);
+  }
+  if (ec) {
+    LOG_GENERAL(WARNING, "Cannot create " << base << ": " << ec.message());
+    return {};
+  }
+
+  RemoveStaleDirectories(base);
+
+  const fs::path root = base / std::to_string(getpid());
+  fs::create_directories(root / CODE_CACHE_DIR, ec);
+  if (ec) {
+    LOG_GENERAL(WARNING, "Cannot create " << root << ": " << ec.message());
+    return {};
+  }
+
+  LOG_GENERAL(INFO, "Scilla workspaces under " << root);
+  return root;
+}
+
+/// Code files named by the hash of their content. The number of files is
+/// bounded by SCILLA_CODE_CACHE_SIZE, the least recently used go first.
+/// Evicting a file does not affect workspaces that still link to it.
+class CodeCache {
+ public:
+  static CodeCache& GetInstance() {
+    static CodeCache cache;
+    return cache;
+  }
+
+  /// Returns the cached file holding code, or an empty path on failure.
+  fs::path Get(const std::string& code, bool is_library) {
+    const std::string name = HashContent(code) + GetCodeExtension(is_library);
+    const fs::path path = ScillaWorkspace::GetRoot() / CODE_CACHE_DIR / name;
+
+    std::lock_guard<std::mutex> g(m_mutex);
+
+    auto it = m_entries.find(name);
+    if (it != m_entries.end()) {
+      m_lru.splice(m_lru.begin(), m_lru, it->second);
+      std::error_code ec;
+      if (fs::exists(path, ec)) {
+        return path;
+      }
+      m_lru.erase(it->second);
+      m_entries.erase(it);
+    }
+
+    if (!WriteFileAtomically(path, code)) {
+      return {};
+    }
+
+    m_lru.push_front(name);
+    m_entries.emplace(name, m_lru.begin());
+
+    while (m_entries.size() > std::max(SCILLA_CODE_CACHE_SIZE, 1U)) {
+      std::error_code ec;
+      fs::remove(ScillaWorkspace::GetRoot() / CODE_CACHE_DIR / m_lru.back(),
+                 ec);
+      m_entries.erase(m_lru.back());
+      m_lru.pop_back();
+    }
+
+    return path;
+  }
+
+ private:
+  CodeCache() = default;
+
+  std::mutex m_mutex;
+  std::list<std::string> m_lru;
+  std::unordered_map<std::string, std::list<std::string>::iterator> m_entries;
+};
+
+/// Content last written to EXTLIB_FOLDER per file, by hash.
+std::mutex g_mutexExtlibs;
+std::unordered_map<std::string, std::string> g_extlibHashes;
+
+bool ExportExtlibFile(const std::string& path, const std::string& content) {
+  const std::string hash = HashContent(content);
+
+  std::lock_guard<std::mutex> g(g_mutexExtlibs);
+  auto it = g_extlibHashes.find(path);
+  std::error_code ec;
+  if (it != g_extlibHashes.end() && it->second == hash &&
+      fs::exists(path, ec)) {
+    return true;
+  }
+
+  if (!WriteFileAtomically(path, content)) {
+    g_extlibHashes.erase(path);
+    return false;
+  }
+  g_extlibHashes[path] = hash;
+  return true;
+}
+
+}  // namespace
+
+ScillaWorkspace::ScillaWorkspace() {
+  const fs::path& root = GetRoot();
+  if (root.empty()) {
+    return;
+  }
+
+  fs::path dir = root / std::to_string(++g_workspaceCount);
+  std::error_code ec;
+  fs::remove_all(dir, ec);
+  if (!fs::create_directory(dir, ec)) {
+    LOG_GENERAL(WARNING, "Cannot create Scilla workspace "
+                             << dir << ": " << ec.message());
+    return;
+  }
+  m_dir = std::move(dir);
+}
+
+ScillaWorkspace::~ScillaWorkspace() {
+  if (m_dir.empty()) {
+    return;
+  }
+  std::error_code ec;
+  fs::remove_all(m_dir, ec);
+  if (ec) {
+    LOG_GENERAL(WARNING, "Cannot remove Scilla workspace "
+                             << m_dir << ": " << ec.message());
+  }
+}
+
+std::string ScillaWorkspace::GetInitJsonPath() const {
+  return (m_dir / fs::path(INIT_JSON).filename()).string();
+}
+
+std::string ScillaWorkspace::GetInputMessageJsonPath() const {
+  return (m_dir / fs::path(INPUT_MESSAGE_JSON).filename()).string();
+}
+
+std::string ScillaWorkspace::GetOutputJsonPath() const {
+  return (m_dir / fs::path(OUTPUT_JSON).filename()).string();
+}
+
+std::string ScillaWorkspace::GetCodePath(bool is_library) const {
+  return (m_dir / (fs::path(INPUT_CODE).filename().string() +
+                   GetCodeExtension(is_library)))
+      .string();
+}
+
+bool ScillaWorkspace::ExportCode(const std::string& code, bool is_library) {
+  if (!IsReady()) {
+    return false;
+  }
+
+  const std::string codePath = GetCodePath(is_library);
+  const fs::path cached = CodeCache::GetInstance().Get(code, is_library);
+  if (!cached.empty()) {
+    std::error_code ec;
+    fs::create_hard_link(cached, codePath, ec);
+    if (!ec) {
+      return true;
+    }
+  }
+
+  // Linking only fails if the cache lives on another file system or the
+  // cached file just got evicted, so write a private copy instead.
+  return WriteFile(codePath, code);
+}
+
+bool ScillaWorkspace::ExportInitJson(const std::string& init) {
+  return IsReady() && WriteFile(GetInitJsonPath(), init);
+}
+
+bool ScillaWorkspace::ExportInputMessageJson(const Json::Value& message) {
+  return IsReady() &&
+         WriteFile(GetInputMessageJsonPath(),
+                   JSONUtils::GetInstance().convertJsontoStr(message));
+}
+
+bool ScillaWorkspace::ExportExtlibs(
+    const std::map<Address, std::pair<std::string, std::string>>&
+        extlibs_exports) {
+  if (extlibs_exports.empty()) {
+    return true;
+  }
+
+  std::error_code ec;
+  fs::create_directories(EXTLIB_FOLDER, ec);
+
+  for (const auto& extlib_export : extlibs_exports) {
+    if (!ExportExtlibFile(GetExtlibCodePath(extlib_export.first),
+                          extlib_export.second.first) ||
+        !ExportExtlibFile(GetExtlibInitPath(extlib_export.first),
+                          extlib_export.second.second)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::string ScillaWorkspace::GetExtlibCodePath(const Address& libAddr) {
+  return EXTLIB_FOLDER + '/' + "0x" + libAddr.hex() + LIBRARY_CODE_EXTENSION;
+}
+
+std::string ScillaWorkspace::GetExtlibInitPath(const Address& libAddr) {
+  return EXTLIB_FOLDER + '/' + "0x" + libAddr.hex() + ".json";
+}
+
+const fs::path& ScillaWorkspace::GetRoot() {
+  static const fs::path root = ResolveRoot();
+  return root;
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ZILLIQA_SRC_LIBSCILLA_SCILLAWORKSPACE_H_
+#define ZILLIQA_SRC_LIBSCILLA_SCILLAWORKSPACE_H_
+
+#include <filesystem>
+#include <map>
+#include <string>
+
+#include <json/json.h>
+
+#include "common/FixedHash.h"
+
+/// Holds the files of a single interpreter invocation.
+///
+/// Every workspace is a fresh directory below SCILLA_WORKSPACE_ROOT that is
+/// removed again when the workspace goes away, so invocations running at the
+/// same time never see each other's init, message or output json. Contract
+/// code is kept in a cache next to the workspaces, named by the hash of the
+/// code, and only linked into the workspace; identical code is written once.
+class ScillaWorkspace {
+  using Address = dev::h160;
+
+ public:
+  ScillaWorkspace();
+  ~ScillaWorkspace();
+
+  ScillaWorkspace(const ScillaWorkspace&) = delete;
+  ScillaWorkspace& operator=(const ScillaWorkspace&) = delete;
+
+  /// Returns false if no directory could be created for this invocation.
+  bool IsReady() const { return !m_dir.empty(); }
+
+  std::string GetInitJsonPath() const;
+  std::string GetInputMessageJsonPath() const;
+  std::string GetOutputJsonPath() const;
+  std::string GetCodePath(bool is_library) const;
+
+  /// Places contract code in the workspace, reusing the cached copy if any
+  /// earlier invocation saw the same code.
+  bool ExportCode(const std::string& code, bool is_library);
+
+  bool ExportInitJson(const std::string& init);
+  bool ExportInputMessageJson(const Json::Value& message);
+
+  /// Writes code and init data of external libraries to EXTLIB_FOLDER. Files
+  /// are only rewritten when their content differs from what this process
+  /// last exported for the address, and are replaced atomically so that
+  /// concurrent invocations never read a partially written library.
+  static bool ExportExtlibs(
+      const std::map<Address, std::pair<std::string, std::string>>&
+          extlibs_exports);
+
+  /// Returns the paths under which ExportExtlibs stores a library.
+  static std::string GetExtlibCodePath(const Address& libAddr);
+  static std::string GetExtlibInitPath(const Address& libAddr);
+
+  /// Directory of this process holding its workspaces and the code cache.
+  static const std::filesystem::path& GetRoot();
+
+ private:
+  std::filesystem::path m_dir;
+};
+
+#endif  // ZILLIQA_SRC_LIBSCILLA_SCILLAWORKSPACE_H_
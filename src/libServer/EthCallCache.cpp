@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "EthCallCache.h"
+
+using namespace std;
+
+EthCallCache::EthCallCache(size_t capacity)
+    : m_capacity(capacity), m_entries(max<size_t>(capacity, 1)) {}
+
+string EthCallCache::MakeKey(const string& method, const Address& from,
+                             const Address& to, const uint256_t& value,
+                             uint64_t gas, const zbytes& data) {
+  string key;
+  key.reserve(method.size() + 2 * Address::size + data.size() + 96);
+  key.append(method).push_back('\0');
+  key.append(reinterpret_cast<const char*>(from.data()), Address::size);
+  key.append(reinterpret_cast<const char*>(to.data()), Address::size);
+  key.append(value.str()).push_back('\0');
+  key.append(to_string(gas)).push_back('\0');
+  key.append(data.begin(), data.end());
+  return key;
+}
+
+optional<EthCallCache::Outcome> EthCallCache::Get(const dev::h256& stateRoot,
+                                                  uint64_t blockNum,
+                                                  const string& key) {
+  if (m_capacity == 0) {
+    return nullopt;
+  }
+
+  lock_guard<mutex> g(m_mutex);
+  ResetIfStale(stateRoot, blockNum);
+  const auto outcome = m_entries.get(key);
+  if (!outcome) {
+    return nullopt;
+  }
+  return *outcome;
+}
+
+void EthCallCache::Put(const dev::h256& stateRoot, uint64_t blockNum,
+                       const string& key, const Outcome& outcome) {
+  if (m_capacity == 0) {
+    return;
+  }
+
+  lock_guard<mutex> g(m_mutex);
+  ResetIfStale(stateRoot, blockNum);
+  m_entries.insert(key, outcome);
+}
+
+void EthCallCache::ResetIfStale(const dev::h256& stateRoot,
+                                uint64_t blockNum) {
+  if (stateRoot != m_stateRoot || blockNum != m_blockNum) {
+    m_entries.clear();
+    m_stateRoot = stateRoot;
+    m_blockNum = blockNum;
+  }
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ZILLIQA_SRC_LIBSERVER_ETHCALLCACHE_H_
+#define ZILLIQA_SRC_LIBSERVER_ETHCALLCACHE_H_
+
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include <boost/compute/detail/lru_cache.hpp>
+
+#include "common/BaseType.h"
+#include "depends/common/FixedHash.h"
+#include "libData/AccountData/Address.h"
+
+/// Bounded LRU cache of eth_call and eth_estimateGas outcomes. An outcome is
+/// only valid for the state root and block it was computed at, so the whole
+/// cache is dropped as soon as a lookup or insert names a different one.
+class EthCallCache {
+ public:
+  /// What the RPC returned: a result string, or the JSON-RPC error thrown
+  struct Outcome {
+    bool success{false};
+    std::string result;
+    int errorCode{0};
+    std::string message;
+    std::string data;
+    /// Time the original request spent executing in the EVM
+    double elapsedMs{0};
+  };
+
+  /// A capacity of 0 disables the cache
+  explicit EthCallCache(size_t capacity);
+
+  /// Builds the key for one call from every argument that affects its outcome
+  static std::string MakeKey(const std::string& method, const Address& from,
+                             const Address& to, const uint256_t& value,
+                             uint64_t gas, const zbytes& data);
+
+  std::optional<Outcome> Get(const dev::h256& stateRoot, uint64_t blockNum,
+                             const std::string& key);
+
+  void Put(const dev::h256& stateRoot, uint64_t blockNum,
+           const std::string& key, const Outcome& outcome);
+
+ private:
+  /// Drops every entry unless they were computed at stateRoot and blockNum.
+  /// Caller must hold m_mutex
+  void ResetIfStale(const dev::h256& stateRoot, uint64_t blockNum);
+
+  const size_t m_capacity;
+  std::mutex m_mutex;
+  dev::h256 m_stateRoot;
+  uint64_t m_blockNum{0};
+  boost::compute::detail::lru_cache<std::string, Outcome> m_entries;
+};
+
+#endif  // ZILLIQA_SRC_LIBSERVER_ETHCALLCACHE_H_
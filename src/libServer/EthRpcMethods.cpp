@@ -62,6 +62,44 @@ Z_DBLMETRIC &GetInvocationsCounter() {
   return counter;
 }
 
+Z_I64METRIC &GetCallCacheCounter() {
+  static Z_I64METRIC counter{Z_FL::EVM_RPC, "ethrpc.callcache.count",
+                             "eth_call and eth_estimateGas cache lookups",
+                             "Calls"};
+  return counter;
+}
+
+Z_DBLMETRIC &GetCallCacheSavedTime() {
+  static Z_DBLMETRIC counter{Z_FL::EVM_RPC, "ethrpc.callcache.saved",
+                             "EVM execution time saved by cache hits", "ms"};
+  return counter;
+}
+
+void CountCallCacheLookup(const std::string &method, bool hit) {
+  if (GetCallCacheCounter().Enabled()) {
+    GetCallCacheCounter().IncrementAttr(
+        {{"method", method}, {"result", hit ? "hit" : "miss"}});
+  }
+}
+
+/// Returns or rethrows what the RPC produced when the outcome was cached
+std::string ReplayCachedOutcome(const std::string &method,
+                                const EthCallCache::Outcome &outcome) {
+  CountCallCacheLookup(method, true);
+  if (GetCallCacheSavedTime().Enabled()) {
+    GetCallCacheSavedTime().IncrementWithAttributes(outcome.elapsedMs,
+                                                    {{"method", method}});
+  }
+
+  if (outcome.success) {
+    return outcome.result;
+  }
+  if (outcome.data.empty()) {
+    throw JsonRpcException(outcome.errorCode, outcome.message);
+  }
+  throw JsonRpcException(outcome.errorCode, outcome.message, outcome.data);
+}
+
 bool isNumber(const std::string &str) {
   char *endp;
   strtoull(str.c_str(), &endp, 0);
@@ -681,10 +719,7 @@ Json::Value EthRpcMethods::GetBalanceAndNonce(const string &address) {
 
   try {
     Address addr{ToBase16AddrHelper(address)};
-    unique_lock<shared_timed_mutex> lock(
-        AccountStore::GetInstance().GetPrimaryMutex());
-
-    const Account *account = AccountStore::GetInstance().GetAccount(addr, true);
+    const auto account = AccountStore::GetInstance().GetCommittedAccount(addr);
 
     Json::Value ret;
     if (account != nullptr) {
@@ -693,9 +728,10 @@ Json::Value EthRpcMethods::GetBalanceAndNonce(const string &address) {
 
       ret["balance"] = balance.str();
       ret["nonce"] = static_cast<unsigned int>(nonce);
-      LOG_GENERAL(INFO,
-                  "DEBUG: Addr: " << address << " balance: " << balance.str()
-                                  << " nonce: " << nonce << " " << account);
+      LOG_GENERAL(INFO, "DEBUG: Addr: " << address
+                                        << " balance: " << balance.str()
+                                        << " nonce: " << nonce << " "
+                                        << account.get());
     } else if (account == nullptr) {
       throw JsonRpcException(ServerBase::RPC_INVALID_ADDRESS_OR_KEY,
                              "Account is not created");
@@ -867,9 +903,11 @@ std::string EthRpcMethods::GetEthEstimateGas(const Json::Value &json, const std:
   zbytes code;
   uint256_t accountFunds{};
   bool contractCreation = false;
+  dev::h256 stateRoot;
   {
     unique_lock<shared_timed_mutex> lock(
         AccountStore::GetInstance().GetPrimaryMutex());
+    stateRoot = AccountStore::GetInstance().GetStateRootHash();
 
     const Account *sender =
         !IsNullAddress(fromAddr)
@@ -977,16 +1015,38 @@ std::string EthRpcMethods::GetEthEstimateGas(const Json::Value &json, const std:
     TRACE_EVENT("GasEstimate", "informational", ss.str());
   }
 
+  // The estimate only depends on the state and these arguments, so identical
+  // requests within one block are answered from the cache
+  const std::string cacheMethod = "eth_estimateGas";
+  const auto cacheKey =
+      EthCallCache::MakeKey(cacheMethod, fromAddr, toAddr, value, gas,
+                            contractCreation ? code : data);
+  if (const auto cached = m_callCache.Get(stateRoot, blockNum, cacheKey)) {
+    return ReplayCachedOutcome(cacheMethod, *cached);
+  }
+  CountCallCacheLookup(cacheMethod, false);
+
+  EthCallCache::Outcome outcome;
+  const auto remember = [&]() {
+    // Only if no block was committed while the EVM was running
+    if (AccountStore::GetInstance().GetStateRootHash() == stateRoot) {
+      m_callCache.Put(stateRoot, blockNum, cacheKey, outcome);
+    }
+  };
+
   EvmProcessContext evmMessageContext(fromAddr, toAddr, code, data, gas, value,
                                       blockNum, txnExtras, "eth_estimateGas",
                                       true, false);
 
   evm::EvmResult result;
 
-  if (AccountStore::GetInstance().EvmProcessMessageTemp(evmMessageContext,
-                                                        result) &&
-      result.exit_reason().exit_reason_case() ==
-          evm::ExitReason::ExitReasonCase::kSucceed) {
+  const auto evmStart = r_timer_start();
+  const bool evmOk = AccountStore::GetInstance().EvmProcessMessageTemp(
+      evmMessageContext, result);
+  outcome.elapsedMs = r_timer_end(evmStart) / 1000;
+
+  if (evmOk && result.exit_reason().exit_reason_case() ==
+                   evm::ExitReason::ExitReasonCase::kSucceed) {
     const auto gasRemained = result.remaining_gas();
     const auto consumedEvmGas =
         (gas >= gasRemained) ? (gas - gasRemained) : gas;
@@ -1003,12 +1063,17 @@ std::string EthRpcMethods::GetEthEstimateGas(const Json::Value &json, const std:
 
     // We can't go beyond gas provided by user (or taken from last block)
     if (retGas >= gas) {
-      throw JsonRpcException(ServerBase::RPC_MISC_ERROR,
-                             "Base fee exceeds gas limit");
+      outcome.errorCode = ServerBase::RPC_MISC_ERROR;
+      outcome.message = "Base fee exceeds gas limit";
+      remember();
+      throw JsonRpcException(outcome.errorCode, outcome.message);
     }
     LOG_GENERAL(WARNING, "Gas estimated: " << retGas);
 
-    return (boost::format("0x%x") % retGas).str();
+    outcome.success = true;
+    outcome.result = (boost::format("0x%x") % retGas).str();
+    remember();
+    return outcome.result;
   } else if (result.exit_reason().exit_reason_case() ==
              evm::ExitReason::kRevert) {
     // Error code 3 is a special case. It is practially documented only in geth
@@ -1023,7 +1088,11 @@ std::string EthRpcMethods::GetEthEstimateGas(const Json::Value &json, const std:
     if (UnpackRevert(result.return_value(), revert_error_str)) {
       message << ": " << revert_error_str;
     }
-    throw JsonRpcException(3, message.str(), "0x" + return_value);
+    outcome.errorCode = 3;
+    outcome.message = message.str();
+    outcome.data = "0x" + return_value;
+    remember();
+    throw JsonRpcException(outcome.errorCode, outcome.message, outcome.data);
   } else {
     throw JsonRpcException(ServerBase::RPC_MISC_ERROR,
                            EvmUtils::ExitReasonString(result.exit_reason()));
@@ -1040,6 +1109,7 @@ string EthRpcMethods::GetEthCallImpl(const Json::Value &_json,
   const auto &addr = JSONConversion::checkJsonGetEthCall(_json, apiKeys.to);
   zbytes code{};
   auto success{false};
+  dev::h256 stateRoot;
   {
     unique_lock<shared_timed_mutex> lock(
         AccountStore::GetInstance().GetPrimaryMutex());
@@ -1051,8 +1121,17 @@ string EthRpcMethods::GetEthCallImpl(const Json::Value &_json,
       return "0x";
     }
     code = contractAccount->GetCode();
+    stateRoot = AccountStore::GetInstance().GetStateRootHash();
   }
 
+  // Traces are not cached, only plain calls
+  const bool useCache = tracer.empty();
+  const std::string cacheMethod = "eth_call";
+  std::string cacheKey;
+  uint64_t blockNum = 0;
+  std::optional<EthCallCache::Outcome> cached;
+  EthCallCache::Outcome outcome;
+
   evm::EvmResult result;
   try {
     Address fromAddr;
@@ -1094,28 +1173,53 @@ string EthRpcMethods::GetEthCallImpl(const Json::Value &_json,
         dsBlock.GetHeader().GetGasPrice(),
         txBlock.GetTimestamp() / 1000000,  // From microseconds to seconds.
         dsBlock.GetHeader().GetDifficulty()};
-    uint64_t blockNum = m_sharedMediator.m_txBlockChain.GetLastBlock()
-                            .GetHeader()
-                            .GetBlockNum();
-
-    /*
-     * EVM estimate only is currently disabled, as per n-hutton advice.
-     */
-    EvmProcessContext evmMessageContext(fromAddr, addr, code, data, gasRemained,
-                                        value, blockNum, txnExtras, "eth_call",
-                                        false, true);
-
-    if (AccountStore::GetInstance().EvmProcessMessageTemp(evmMessageContext,
-                                                          result) &&
-        result.exit_reason().exit_reason_case() ==
-            evm::ExitReason::ExitReasonCase::kSucceed) {
-      success = true;
+    blockNum = m_sharedMediator.m_txBlockChain.GetLastBlock()
+                   .GetHeader()
+                   .GetBlockNum();
+
+    if (useCache) {
+      cacheKey = EthCallCache::MakeKey(cacheMethod, fromAddr, addr, value,
+                                       gasRemained, data);
+      cached = m_callCache.Get(stateRoot, blockNum, cacheKey);
+    }
+
+    if (!cached) {
+      /*
+       * EVM estimate only is currently disabled, as per n-hutton advice.
+       */
+      EvmProcessContext evmMessageContext(fromAddr, addr, code, data,
+                                          gasRemained, value, blockNum,
+                                          txnExtras, "eth_call", false, true);
+
+      const auto evmStart = r_timer_start();
+      if (AccountStore::GetInstance().EvmProcessMessageTemp(evmMessageContext,
+                                                            result) &&
+          result.exit_reason().exit_reason_case() ==
+              evm::ExitReason::ExitReasonCase::kSucceed) {
+        success = true;
+      }
+      outcome.elapsedMs = r_timer_end(evmStart) / 1000;
     }
   } catch (const exception &e) {
     LOG_GENERAL(WARNING, "Error: " << e.what());
     throw JsonRpcException(ServerBase::RPC_MISC_ERROR, "Unable to process");
   }
 
+  if (cached) {
+    return ReplayCachedOutcome(cacheMethod, *cached);
+  }
+  if (useCache) {
+    CountCallCacheLookup(cacheMethod, false);
+  }
+
+  const auto remember = [&]() {
+    // Only if no block was committed while the EVM was running
+    if (useCache &&
+        AccountStore::GetInstance().GetStateRootHash() == stateRoot) {
+      m_callCache.Put(stateRoot, blockNum, cacheKey, outcome);
+    }
+  };
+
   // tracerException : we want only the call trace
   if (!tracer.empty()) {
     LOG_GENERAL(WARNING, "Returning trace! ");
@@ -1127,7 +1231,10 @@ string EthRpcMethods::GetEthCallImpl(const Json::Value &_json,
   DataConversion::StringToHexStr(result.return_value(), return_value);
   boost::algorithm::to_lower(return_value);
   if (success) {
-    return "0x" + return_value;
+    outcome.success = true;
+    outcome.result = "0x" + return_value;
+    remember();
+    return outcome.result;
   } else if (result.exit_reason().exit_reason_case() ==
              evm::ExitReason::kRevert) {
     LOG_GENERAL(WARNING, "Warning! Execution reverted...");
@@ -1140,7 +1247,11 @@ string EthRpcMethods::GetEthCallImpl(const Json::Value &_json,
     if (UnpackRevert(result.return_value(), revert_error_str)) {
       message << ": " << revert_error_str;
     }
-    throw JsonRpcException(3, message.str(), "0x" + return_value);
+    outcome.errorCode = 3;
+    outcome.message = message.str();
+    outcome.data = "0x" + return_value;
+    remember();
+    throw JsonRpcException(outcome.errorCode, outcome.message, outcome.data);
   } else {
     LOG_GENERAL(WARNING, "Warning! Misc error...");
     throw JsonRpcException(ServerBase::RPC_MISC_ERROR,
@@ -1293,10 +1404,9 @@ Json::Value EthRpcMethods::GetEthStorageAt(std::string const &address,
 
   try {
     Address addr{ToBase16AddrHelper(address)};
-    unique_lock<shared_timed_mutex> lock(
-        AccountStore::GetInstance().GetPrimaryMutex());
-
-    const Account *account = AccountStore::GetInstance().GetAccount(addr, true);
+    // Both the account and the contract state are read from the last
+    // committed snapshots, without the primary lock
+    const auto account = AccountStore::GetInstance().GetCommittedAccount(addr);
 
     if (account == nullptr) {
       throw JsonRpcException(ServerBase::RPC_INVALID_ADDRESS_OR_KEY,
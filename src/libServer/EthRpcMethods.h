@@ -17,6 +17,7 @@
 #ifndef ZILLIQA_SRC_LIBSERVER_ETHRPCMETHODS_H_
 #define ZILLIQA_SRC_LIBSERVER_ETHRPCMETHODS_H_
 
+#include "EthCallCache.h"
 #include "Server.h"
 #include <jsonrpccpp/common/exception.h>
 #include "common/Constants.h"
@@ -848,6 +849,7 @@ class EthRpcMethods {
 
  private:
   LookupServer* m_lookupServer;
+  EthCallCache m_callCache{ETH_CALL_CACHE_SIZE};
 };
 
 #endif  // ZILLIQA_SRC_LIBSERVER_ETHRPCMETHODS_H_
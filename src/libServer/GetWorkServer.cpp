@@ -16,6 +16,8 @@
  */
 
 #include <chrono>
+#include <map>
+#include <mutex>
 
 #include "ethash/ethash.hpp"
 
@@ -51,17 +53,34 @@ namespace zil {
 
 namespace local {
 
+// Upper bound on the distinct workers whose hashrate is reported, since the
+// worker names come from eth_submitHashrate callers.
+constexpr size_t MAX_HASHRATE_WORKERS = 256;
+
 class MiningVariables {
   int mining = 0;
+  std::map<std::string, double> hashrates;
+  std::mutex mutexHashrates;
 
  public:
   std::unique_ptr<Z_I64GAUGE> temp;
+  std::unique_ptr<Z_DBLGAUGE> hashrateGauge;
 
   void SetIsMining(int mining) {
     Init();
     this->mining = mining;
   }
 
+  void SetHashrate(const std::string& worker, double hashesPerSecond) {
+    InitHashrate();
+    std::lock_guard<std::mutex> g(mutexHashrates);
+    if (hashrates.size() >= MAX_HASHRATE_WORKERS &&
+        hashrates.find(worker) == hashrates.end()) {
+      return;
+    }
+    hashrates[worker] = hashesPerSecond;
+  }
+
   void Init() {
     if (!temp) {
       temp = std::make_unique<Z_I64GAUGE>(Z_FL::BLOCKS, "mining.gauge",
@@ -72,6 +91,22 @@ class MiningVariables {
       });
     }
   }
+
+  void InitHashrate() {
+    std::lock_guard<std::mutex> g(mutexHashrates);
+    if (!hashrateGauge) {
+      hashrateGauge = std::make_unique<Z_DBLGAUGE>(
+          Z_FL::POW, "mining.hashrate", "Hashrate reported per PoW worker",
+          "hashes/s", true);
+
+      hashrateGauge->SetCallback([this](auto&& result) {
+        std::lock_guard<std::mutex> g(mutexHashrates);
+        for (const auto& [worker, rate] : hashrates) {
+          result.Set(rate, {{"worker", worker}});
+        }
+      });
+    }
+  }
 };
 
 static MiningVariables variables{};
@@ -316,8 +351,28 @@ bool GetWorkServer::submitWork(const string& _nonce, const string& _header,
   ;
 }
 
-bool GetWorkServer::submitHashrate([[gnu::unused]] const string& hashrate,
-                                   [[gnu::unused]] const string& miner_wallet,
-                                   [[gnu::unused]] const string& worker) {
+void GetWorkServer::RecordHashrate(const string& worker,
+                                   double hashesPerSecond) {
+  zil::local::variables.SetHashrate(worker, hashesPerSecond);
+}
+
+bool GetWorkServer::submitHashrate(const string& hashrate,
+                                   const string& miner_wallet,
+                                   const string& worker) {
+  string rate = hashrate;
+  if (!DataConversion::NormalizeHexString(rate)) {
+    LOG_GENERAL(WARNING, "Invalid hashrate " << hashrate);
+    return false;
+  }
+
+  double hashesPerSecond = 0;
+  try {
+    hashesPerSecond = uint256_t("0x" + rate).convert_to<double>();
+  } catch (const std::exception& e) {
+    LOG_GENERAL(WARNING, "Invalid hashrate " << hashrate << ": " << e.what());
+    return false;
+  }
+
+  RecordHashrate(worker.empty() ? miner_wallet : worker, hashesPerSecond);
   return true;
 }
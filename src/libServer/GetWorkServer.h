@@ -161,6 +161,10 @@ class GetWorkServer : public AbstractStubServer {
   bool UpdateCurrentResult(const ethash_mining_result_t &newResult,
                            const uint8_t difficulty);
 
+  // Publishes the hashrate of a PoW worker through the mining metrics.
+  static void RecordHashrate(const std::string &worker,
+                             double hashesPerSecond);
+
   // RPC methods
   virtual Json::Value getWork();
   virtual bool submitHashrate(const std::string &hashrate,
@@ -85,6 +85,29 @@ Address ToBase16AddrHelper(const std::string& addr) {
   return convertedAddr;
 }
 
+/// Blocks listed on a page past the cached ones, i.e. blocks
+/// [currBlockNum - offset - PAGE_SIZE + 2, currBlockNum - offset + 1]
+/// whose previous hashes are shown, keyed by block number
+template <class BlockSharedPtr, class GetRangeFn>
+std::unordered_map<uint64_t, BlockHash> GetListingPagePrevHashes(
+    uint64_t currBlockNum, uint64_t offset, GetRangeFn&& getRange) {
+  std::unordered_map<uint64_t, BlockHash> prevHashes;
+  if (offset > currBlockNum) {
+    return prevHashes;
+  }
+
+  const uint64_t count = std::min<uint64_t>(zil::paging::PAGE_SIZE,
+                                            currBlockNum - offset + 1);
+  std::vector<BlockSharedPtr> blocks;
+  getRange(currBlockNum - offset - count + 2, currBlockNum - offset + 1,
+           blocks);
+  for (const auto& block : blocks) {
+    prevHashes.emplace(block->GetHeader().GetBlockNum(),
+                       block->GetHeader().GetPrevHash());
+  }
+  return prevHashes;
+}
+
 }  // namespace
 
 //[warning] do not make this constant too big as it loops over blockchain
@@ -870,10 +893,7 @@ Json::Value LookupServer::GetBalanceAndNonce(const string& address) {
 
   try {
     Address addr{ToBase16AddrHelper(address)};
-    shared_lock<shared_timed_mutex> lock(
-        AccountStore::GetInstance().GetPrimaryMutex());
-
-    const Account* account = AccountStore::GetInstance().GetAccount(addr, true);
+    const auto account = AccountStore::GetInstance().GetCommittedAccount(addr);
 
     Json::Value ret;
     if (account != nullptr) {
@@ -882,9 +902,10 @@ Json::Value LookupServer::GetBalanceAndNonce(const string& address) {
 
       ret["balance"] = balance.str();
       ret["nonce"] = static_cast<unsigned int>(nonce);
-      LOG_GENERAL(INFO,
-                  "DEBUG: Addr: " << address << " balance: " << balance.str()
-                                  << " nonce: " << nonce << " " << account);
+      LOG_GENERAL(INFO, "DEBUG: Addr: " << address
+                                        << " balance: " << balance.str()
+                                        << " nonce: " << nonce << " "
+                                        << account.get());
     } else if (account == nullptr) {
       throw JsonRpcException(RPC_INVALID_ADDRESS_OR_KEY,
                              "Account is not created");
@@ -919,10 +940,9 @@ Json::Value LookupServer::GetSmartContractState(const string& address,
   try {
     Address addr{ToBase16AddrHelper(address)};
 
-    shared_lock<shared_timed_mutex> lock(
-        AccountStore::GetInstance().GetPrimaryMutex());
-
-    const Account* account = AccountStore::GetInstance().GetAccount(addr, true);
+    // Both the account and the contract state are read from the last
+    // committed snapshots, without the primary lock
+    const auto account = AccountStore::GetInstance().GetCommittedAccount(addr);
 
     if (account == nullptr) {
       throw JsonRpcException(RPC_INVALID_ADDRESS_OR_KEY,
@@ -1494,13 +1514,23 @@ Json::Value LookupServer::DSBlockListing(unsigned int page) {
       _json["data"].append(tmpJson);
     }
   } else {
+    // Read the whole page with one range scan rather than a lookup per block
+    const auto prevHashes = GetListingPagePrevHashes<DSBlockSharedPtr>(
+        currBlockNum, offset, [](uint64_t lo, uint64_t hi, auto& blocks) {
+          BlockStorage::GetBlockStorage().GetRangeDSBlocks(lo, hi, blocks);
+        });
+
     for (uint64_t i = offset;
          i < zil::paging::PAGE_SIZE + offset && i <= currBlockNum; i++) {
       tmpJson.clear();
-      tmpJson["Hash"] = m_mediator.m_dsBlockChain.GetBlock(currBlockNum - i + 1)
-                            .GetHeader()
-                            .GetPrevHash()
-                            .hex();
+      const auto it = prevHashes.find(currBlockNum - i + 1);
+      tmpJson["Hash"] =
+          (it != prevHashes.end()
+               ? it->second
+               : m_mediator.m_dsBlockChain.GetBlock(currBlockNum - i + 1)
+                     .GetHeader()
+                     .GetPrevHash())
+              .hex();
       tmpJson["BlockNum"] = uint(currBlockNum - i);
       _json["data"].append(tmpJson);
     }
@@ -1594,13 +1624,23 @@ Json::Value LookupServer::TxBlockListing(unsigned int page) {
       _json["data"].append(tmpJson);
     }
   } else {
+    // Read the whole page with one range scan rather than a lookup per block
+    const auto prevHashes = GetListingPagePrevHashes<TxBlockSharedPtr>(
+        currBlockNum, offset, [](uint64_t lo, uint64_t hi, auto& blocks) {
+          BlockStorage::GetBlockStorage().GetRangeTxBlocks(lo, hi, blocks);
+        });
+
     for (uint64_t i = offset;
          i < zil::paging::PAGE_SIZE + offset && i <= currBlockNum; i++) {
       tmpJson.clear();
-      tmpJson["Hash"] = m_mediator.m_txBlockChain.GetBlock(currBlockNum - i + 1)
-                            .GetHeader()
-                            .GetPrevHash()
-                            .hex();
+      const auto it = prevHashes.find(currBlockNum - i + 1);
+      tmpJson["Hash"] =
+          (it != prevHashes.end()
+               ? it->second
+               : m_mediator.m_txBlockChain.GetBlock(currBlockNum - i + 1)
+                     .GetHeader()
+                     .GetPrevHash())
+              .hex();
       tmpJson["BlockNum"] = uint(currBlockNum - i);
       _json["data"].append(tmpJson);
     }
@@ -93,18 +93,20 @@ bool Validator::CheckCreatedTransaction(const Transaction& tx,
 
   receipt.SetEpochNum(m_mediator.m_currentEpochNum);
 
+  return AccountStore::GetInstance().UpdateAccountsTemp(
+      m_mediator.m_currentEpochNum, m_mediator.m_node->getNumShards(),
+      m_mediator.m_ds->m_mode != DirectoryService::Mode::IDLE, tx,
+      GetTxnExtras(), receipt, error_code);
+}
+
+TxnExtras Validator::GetTxnExtras() const {
   const auto txBlock = m_mediator.m_txBlockChain.GetLastBlock();
   const auto dsBlock = m_mediator.m_dsBlockChain.GetLastBlock();
 
-  TxnExtras txnExtras{
+  return TxnExtras{
       dsBlock.GetHeader().GetGasPrice(),
       txBlock.GetTimestamp() / 1000000,  // From microseconds to seconds.
       dsBlock.GetHeader().GetDifficulty()};
-
-  return AccountStore::GetInstance().UpdateAccountsTemp(
-      m_mediator.m_currentEpochNum, m_mediator.m_node->getNumShards(),
-      m_mediator.m_ds->m_mode != DirectoryService::Mode::IDLE, tx, txnExtras,
-      receipt, error_code);
 }
 
 bool Validator::CheckCreatedTransactionFromLookup(const Transaction& tx,
@@ -26,6 +26,7 @@
 #include "libData/AccountData/TransactionReceipt.h"
 #include "libData/BlockChainData/BlockLinkChain.h"
 #include "libNetwork/Peer.h"
+#include "libUtils/TxnExtras.h"
 
 class Mediator;
 
@@ -39,6 +40,9 @@ class Validator {
                                TransactionReceipt& receipt,
                                TxnStatus& error_code) const;
 
+  /// Block context under which CheckCreatedTransaction executes transactions.
+  TxnExtras GetTxnExtras() const;
+
   bool CheckCreatedTransactionFromLookup(const Transaction& tx,
                                          TxnStatus& error_code);
 
@@ -16,7 +16,10 @@
  */
 
 #include <array>
+#include <atomic>
 #include <string>
+#include <thread>
+#include <vector>
 
 #define BOOST_TEST_MODULE accountstoretest
 #define BOOST_TEST_DYN_LINK
@@ -25,6 +28,7 @@
 #include "libData/AccountData/Address.h"
 #include "libData/AccountStore/AccountStore.h"
 #include "libData/AccountStore/AccountStoreSC.h"
+#include "libMessage/Messenger.h"
 #include "libTestUtils/TestUtils.h"
 #include "libUtils/Logger.h"
 #include "libUtils/SysCommand.h"
@@ -142,4 +146,253 @@ BOOST_AUTO_TEST_CASE(rwtest) {
   LOG_GENERAL(INFO, "acct2: " << acct2->GetBalance());
 }
 
+BOOST_AUTO_TEST_CASE(speculative_transfers_match_serial) {
+  ENABLE_SCILLA = false;
+  AccountStore::GetInstance().Init();
+
+  const uint128_t initialBalance{1000000000000000000};
+  std::vector<PairOfKey> senders;
+  std::vector<Address> senderAddrs;
+  for (unsigned int i = 0; i < 3; i++) {
+    senders.push_back(Schnorr::GenKeyPair());
+    senderAddrs.push_back(
+        Account::GetAddressFromPublicKey(senders.back().second));
+    AccountStore::GetInstance().AddAccount(senderAddrs.back(),
+                                           {initialBalance, 0});
+  }
+  const Address recipient =
+      Account::GetAddressFromPublicKey(Schnorr::GenKeyPair().second);
+  AccountStore::GetInstance().AddAccount(recipient, {0, 0});
+  const Address newAccount =
+      Account::GetAddressFromPublicKey(Schnorr::GenKeyPair().second);
+  AccountStore::GetInstance().UpdateStateTrieAll();
+
+  auto transfer = [](uint64_t nonce, const Address& to, const PairOfKey& from,
+                     const uint128_t& amount) {
+    return Transaction(DataConversion::Pack(CHAIN_ID, 1), nonce, to, from,
+                       amount, PRECISION_MIN_VALUE, NORMAL_TRAN_GAS);
+  };
+  const Transaction s0n1 = transfer(1, senderAddrs[1], senders[0], 100);
+  const Transaction s0n2 = transfer(2, recipient, senders[0], 5);
+  // Reads sender 1 before s0n1 credits it, so it must be re-executed.
+  const Transaction s1n1 = transfer(1, recipient, senders[1], 7);
+  const Transaction s2n1 = transfer(1, newAccount, senders[2], 3);
+
+  const std::vector<std::vector<Transaction>> senderGroups{
+      {s0n1, s0n2}, {s1n1}, {s2n1}};
+  const std::vector<Transaction> serialOrder{s0n1, s1n1, s0n2, s2n1};
+
+  size_t hits = 0, misses = 0;
+  auto process = [&](bool speculate, std::vector<std::string>& receipts) {
+    AccountStore::GetInstance().InitTemp();
+    if (speculate) {
+      AccountStore::GetInstance().SpeculateTransfersTemp(
+          1, 1, false, senderGroups, GetDefaultTxnExtras());
+    }
+    for (const auto& tx : serialOrder) {
+      TransactionReceipt tr;
+      TxnStatus error_code;
+      const bool status = AccountStore::GetInstance().UpdateAccountsTemp(
+          1, 1, false, tx, GetDefaultTxnExtras(), tr, error_code);
+      receipts.push_back(std::to_string(status) + ":" +
+                         std::to_string(static_cast<int>(error_code)) + ":" +
+                         tr.GetString());
+    }
+    AccountStore::GetInstance().GetSpeculativeCountsTemp(hits, misses);
+    AccountStore::GetInstance().ClearSpeculativeResultsTemp();
+    BOOST_CHECK(AccountStore::GetInstance().SerializeDelta());
+    zbytes delta;
+    AccountStore::GetInstance().GetSerializedDelta(delta);
+    return delta;
+  };
+
+  std::vector<std::string> serialReceipts, speculativeReceipts;
+  const zbytes serialDelta = process(false, serialReceipts);
+  const zbytes speculativeDelta = process(true, speculativeReceipts);
+
+  BOOST_CHECK(serialDelta == speculativeDelta);
+  BOOST_CHECK(serialReceipts == speculativeReceipts);
+  // s0n1 and s2n1 are reused; s1n1 and s0n2 read accounts that s0n1 and
+  // s1n1 changed first in the serial order.
+  BOOST_CHECK_EQUAL(hits, 2);
+  BOOST_CHECK_EQUAL(misses, 2);
+}
+
+BOOST_AUTO_TEST_CASE(streaming_delta_deserialization) {
+  ENABLE_SCILLA = false;
+  AccountStore::GetInstance().Init();
+
+  std::unordered_map<Address, uint128_t> balances;
+  for (unsigned int i = 0; i < 50; i++) {
+    const Address addr =
+        Account::GetAddressFromPublicKey(Schnorr::GenKeyPair().second);
+    balances[addr] = 1000 + i;
+  }
+
+  AccountStore::GetInstance().InitTemp();
+  for (const auto& entry : balances) {
+    AccountStore::GetInstance().AddAccountTemp(entry.first,
+                                               {entry.second, 0});
+  }
+  BOOST_CHECK(AccountStore::GetInstance().SerializeDelta());
+  zbytes delta;
+  AccountStore::GetInstance().GetSerializedDelta(delta);
+
+  std::unordered_map<Address, boost::multiprecision::int256_t> balanceDeltas;
+  BOOST_CHECK(Messenger::StateDeltaToAddressMap(delta, 0, balanceDeltas));
+  BOOST_CHECK_EQUAL(balanceDeltas.size(), balances.size());
+  for (const auto& entry : balances) {
+    BOOST_CHECK(balanceDeltas[entry.first] ==
+                boost::multiprecision::int256_t(entry.second));
+  }
+
+  AccountStore::GetInstance().InitTemp();
+  BOOST_CHECK(AccountStore::GetInstance().DeserializeDeltaTemp(delta, 0));
+
+  // A truncated delta must be reported as a failure
+  const zbytes truncated(delta.begin(), delta.end() - 1);
+  AccountStore::GetInstance().InitTemp();
+  BOOST_CHECK(!AccountStore::GetInstance().DeserializeDeltaTemp(truncated, 0));
+
+  // and must leave the committed state untouched
+  const auto rootBefore = AccountStore::GetInstance().GetStateRootHash();
+  BOOST_CHECK(!AccountStore::GetInstance().DeserializeDelta(truncated, 0));
+  BOOST_CHECK_EQUAL(AccountStore::GetInstance().GetStateRootHash(),
+                    rootBefore);
+  for (const auto& entry : balances) {
+    BOOST_CHECK(AccountStore::GetInstance().GetAccount(entry.first) ==
+                nullptr);
+  }
+
+  BOOST_CHECK(AccountStore::GetInstance().DeserializeDelta(delta, 0));
+  BOOST_CHECK(AccountStore::GetInstance().GetStateRootHash() != rootBefore);
+}
+
+BOOST_AUTO_TEST_CASE(read_snapshot_isolated_from_commits) {
+  ENABLE_SCILLA = false;
+  AccountStore::GetInstance().Init();
+
+  const Address addr =
+      Account::GetAddressFromPublicKey(Schnorr::GenKeyPair().second);
+  const Address missing =
+      Account::GetAddressFromPublicKey(Schnorr::GenKeyPair().second);
+
+  const auto commitBalance = [&addr](const uint128_t& balance) {
+    AccountStore::GetInstance().InitTemp();
+    AccountStore::GetInstance().AddAccountTemp(addr, {balance, 0});
+    BOOST_REQUIRE(AccountStore::GetInstance().SerializeDelta());
+    AccountStore::GetInstance().CommitTemp();
+  };
+
+  commitBalance(1000);
+  const auto before = AccountStore::GetInstance().GetReadSnapshot();
+  BOOST_CHECK(before->GetRoot() ==
+              AccountStore::GetInstance().GetStateRootHash());
+
+  auto account = AccountStore::GetInstance().GetCommittedAccount(addr);
+  BOOST_REQUIRE(account != nullptr);
+  BOOST_CHECK_EQUAL(account->GetBalance(), 1000);
+  BOOST_CHECK(AccountStore::GetInstance().GetCommittedAccount(missing) ==
+              nullptr);
+
+  commitBalance(2000);
+  const auto after = AccountStore::GetInstance().GetReadSnapshot();
+  BOOST_CHECK_GT(after->GetVersion(), before->GetVersion());
+
+  // The changed account must not be served from the inherited cache
+  account = AccountStore::GetInstance().GetCommittedAccount(addr);
+  BOOST_REQUIRE(account != nullptr);
+  BOOST_CHECK_EQUAL(account->GetBalance(), 2000);
+
+  // An older snapshot keeps returning the state it was published with
+  account = AccountStore::GetInstance().GetCommittedAccount(addr, before);
+  BOOST_REQUIRE(account != nullptr);
+  BOOST_CHECK_EQUAL(account->GetBalance(), 1000);
+}
+
+BOOST_AUTO_TEST_CASE(read_snapshot_during_move_updates_to_disk) {
+  ENABLE_SCILLA = false;
+  AccountStore::GetInstance().Init();
+
+  std::vector<Address> addrs;
+  for (unsigned int i = 0; i < 10; i++) {
+    addrs.emplace_back(
+        Account::GetAddressFromPublicKey(Schnorr::GenKeyPair().second));
+  }
+  const auto commitBalances = [&addrs](const uint128_t& balance) {
+    AccountStore::GetInstance().InitTemp();
+    for (const auto& addr : addrs) {
+      AccountStore::GetInstance().AddAccountTemp(addr, {balance, 0});
+    }
+    BOOST_REQUIRE(AccountStore::GetInstance().SerializeDelta());
+    AccountStore::GetInstance().CommitTemp();
+  };
+
+  commitBalances(1000);
+  BOOST_REQUIRE(AccountStore::GetInstance().MoveUpdatesToDisk(300));
+
+  // Readers walk the trie (absent addresses always miss the cache) while the
+  // state DB is committed and reopened underneath them
+  std::atomic<bool> stop{false};
+  std::atomic<unsigned int> failures{0};
+  std::vector<std::thread> readers;
+  for (unsigned int t = 0; t < 4; t++) {
+    readers.emplace_back([&]() {
+      while (!stop) {
+        for (const auto& addr : addrs) {
+          auto account = AccountStore::GetInstance().GetCommittedAccount(addr);
+          if (account == nullptr || account->GetBalance() < 1000) {
+            ++failures;
+          }
+        }
+        const Address missing;
+        if (AccountStore::GetInstance().GetCommittedAccount(missing) !=
+            nullptr) {
+          ++failures;
+        }
+      }
+    });
+  }
+
+  for (unsigned int i = 1; i <= 20; i++) {
+    commitBalances(1000 + i);
+    BOOST_CHECK(AccountStore::GetInstance().MoveUpdatesToDisk(300 + i));
+  }
+  stop = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+
+  BOOST_CHECK_EQUAL(failures.load(), 0);
+  auto account = AccountStore::GetInstance().GetCommittedAccount(addrs[0]);
+  BOOST_REQUIRE(account != nullptr);
+  BOOST_CHECK_EQUAL(account->GetBalance(), 1020);
+}
+
+BOOST_AUTO_TEST_CASE(serialize_snapshot_matches_serialize) {
+  ENABLE_SCILLA = false;
+  AccountStore::GetInstance().Init();
+
+  AccountStore::GetInstance().InitTemp();
+  for (unsigned int i = 0; i < 10; i++) {
+    AccountStore::GetInstance().AddAccountTemp(
+        Account::GetAddressFromPublicKey(Schnorr::GenKeyPair().second),
+        {500 + i, i});
+  }
+  BOOST_REQUIRE(AccountStore::GetInstance().SerializeDelta());
+  AccountStore::GetInstance().CommitTemp();
+
+  // Read back from the trie at the pinned root, it must encode exactly what
+  // the locked serialization does
+  zbytes snapshot;
+  dev::h256 stateRoot;
+  BOOST_REQUIRE(
+      AccountStore::GetInstance().SerializeSnapshot(snapshot, stateRoot));
+  BOOST_CHECK_EQUAL(stateRoot, AccountStore::GetInstance().GetStateRootHash());
+
+  zbytes full;
+  BOOST_REQUIRE(AccountStore::GetInstance().Serialize(full, 0));
+  BOOST_CHECK(snapshot == full);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "libData/AccountData/Account.h"
+#include "libData/AccountData/ContractBlob.h"
+#include "libUtils/Logger.h"
+
+#define BOOST_TEST_MODULE contractblob
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+
+struct Fixture {
+  Fixture() { INIT_STDOUT_LOGGER() }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
+BOOST_AUTO_TEST_SUITE(contractblob)
+
+BOOST_AUTO_TEST_CASE(testInternDeduplicates) {
+  auto& pool = ContractBlobPool::GetInstance();
+
+  const zbytes code(32 * 1024, 0x5b);
+  const auto first = pool.Intern(code);
+  const auto second = pool.Intern(zbytes(code));
+  BOOST_CHECK(first.get() == second.get());
+  BOOST_CHECK(*first == code);
+
+  zbytes other = code;
+  other.back() = 0x00;
+  BOOST_CHECK(pool.Intern(other).get() != first.get());
+
+  BOOST_CHECK(pool.Intern(zbytes{}).get() == ContractBlobPool::Empty().get());
+}
+
+BOOST_AUTO_TEST_CASE(testBlobFreedWithLastHolder) {
+  auto& pool = ContractBlobPool::GetInstance();
+
+  const size_t before = pool.Size();
+  {
+    const auto blob = pool.Intern(zbytes{'t', 'e', 'm', 'p'});
+    BOOST_CHECK_EQUAL(pool.Size(), before + 1);
+  }
+  BOOST_CHECK_EQUAL(pool.Size(), before);
+}
+
+BOOST_AUTO_TEST_CASE(testAccountCopiesShareCode) {
+  const zbytes code{'s', 'c', 'i', 'l', 'l', 'a'};
+  const string message =
+      "[{\"vname\":\"_scilla_version\",\"type\":\"Uint32\",\"value\":\"0\"}]";
+  const zbytes initData(message.begin(), message.end());
+
+  Account account(0, 0);
+  BOOST_REQUIRE(account.SetImmutable(code, initData));
+
+  const Account copy = account;
+  BOOST_CHECK(copy.GetCodeBlob().get() == account.GetCodeBlob().get());
+  BOOST_CHECK(copy.GetInitDataBlob().get() ==
+              account.GetInitDataBlob().get());
+  BOOST_CHECK(copy.GetCode() == code);
+  BOOST_CHECK(copy.GetInitData() == initData);
+
+  // Accounts set up independently with the same code share it too
+  Account other(0, 0);
+  BOOST_REQUIRE(other.SetImmutable(code, initData));
+  BOOST_CHECK(other.GetCodeBlob().get() == account.GetCodeBlob().get());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <thread>
+
+#define BOOST_TEST_MODULE evmbinarytransporttest
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "libData/AccountStore/services/evm/EvmBinaryTransport.h"
+#include "libUtils/Logger.h"
+
+using boost::asio::local::stream_protocol;
+
+namespace {
+
+const std::string SOCKET_PATH = "/tmp/test-evm-binary-transport.sock";
+
+// Answers every request with the reversed payload, or with an error frame
+// when the payload is "fail", or not at all when the payload is "hang".
+class FakeEvmServer {
+ public:
+  FakeEvmServer() : m_acceptor(m_ioContext) {
+    std::filesystem::remove(SOCKET_PATH);
+    m_acceptor.open(stream_protocol());
+    m_acceptor.bind(stream_protocol::endpoint(SOCKET_PATH));
+    m_acceptor.listen();
+    m_thread = std::thread([this] { Serve(); });
+  }
+
+  ~FakeEvmServer() {
+    // Wake the blocking accept with a connection of our own.
+    m_stop = true;
+    stream_protocol::socket wake(m_ioContext);
+    wake.connect(stream_protocol::endpoint(SOCKET_PATH));
+    m_thread.join();
+    std::filesystem::remove(SOCKET_PATH);
+  }
+
+  size_t Accepted() const { return m_accepted; }
+
+ private:
+  void Serve() {
+    std::vector<std::thread> connections;
+    for (;;) {
+      stream_protocol::socket socket(m_ioContext);
+      boost::system::error_code ec;
+      m_acceptor.accept(socket, ec);
+      if (ec || m_stop) {
+        break;
+      }
+      ++m_accepted;
+      connections.emplace_back(
+          [s = std::move(socket)]() mutable { ServeConnection(s); });
+    }
+    for (auto& t : connections) {
+      t.join();
+    }
+  }
+
+  static void ServeConnection(stream_protocol::socket& socket) {
+    boost::system::error_code ec;
+    for (;;) {
+      std::array<uint8_t, 4> header;
+      boost::asio::read(socket, boost::asio::buffer(header), ec);
+      if (ec) {
+        return;
+      }
+      const uint32_t length = (header[0] << 24) | (header[1] << 16) |
+                              (header[2] << 8) | header[3];
+      std::string payload(length, '\0');
+      boost::asio::read(socket, boost::asio::buffer(payload), ec);
+      if (ec) {
+        return;
+      }
+      if (payload == "hang") {
+        // Never answer; returns once the client gives up and closes.
+        char byte;
+        boost::asio::read(socket, boost::asio::buffer(&byte, 1), ec);
+        return;
+      }
+      const bool fail = payload == "fail";
+      std::string body = fail ? "boom" : std::string(payload.rbegin(),
+                                                       payload.rend());
+      const uint32_t frameLength = body.size() + 1;
+      std::string frame{static_cast<char>(frameLength >> 24),
+                        static_cast<char>(frameLength >> 16),
+                        static_cast<char>(frameLength >> 8),
+                        static_cast<char>(frameLength),
+                        static_cast<char>(fail ? 1 : 0)};
+      frame += body;
+      boost::asio::write(socket, boost::asio::buffer(frame), ec);
+    }
+  }
+
+  boost::asio::io_context m_ioContext;
+  stream_protocol::acceptor m_acceptor;
+  std::atomic<size_t> m_accepted{0};
+  std::atomic<bool> m_stop{false};
+  std::thread m_thread;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(evmbinarytransporttest)
+
+BOOST_AUTO_TEST_CASE(roundtrip_reuses_connection) {
+  INIT_STDOUT_LOGGER();
+  FakeEvmServer server;
+  EvmBinaryTransport transport(SOCKET_PATH, 2);
+
+  for (int i = 0; i < 3; ++i) {
+    std::string response;
+    BOOST_CHECK(transport.Call("abc", response, std::chrono::seconds(5)) ==
+                EvmBinaryTransport::Status::OK);
+    BOOST_CHECK_EQUAL(response, "cba");
+  }
+  BOOST_CHECK_EQUAL(server.Accepted(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(error_frame) {
+  INIT_STDOUT_LOGGER();
+  FakeEvmServer server;
+  EvmBinaryTransport transport(SOCKET_PATH, 2);
+
+  std::string response;
+  BOOST_CHECK(transport.Call("fail", response, std::chrono::seconds(5)) ==
+              EvmBinaryTransport::Status::FAILED);
+  BOOST_CHECK_EQUAL(response, "boom");
+}
+
+BOOST_AUTO_TEST_CASE(timeout_drops_connection) {
+  INIT_STDOUT_LOGGER();
+  FakeEvmServer server;
+  EvmBinaryTransport transport(SOCKET_PATH, 2);
+
+  std::string response;
+  BOOST_CHECK(transport.Call("hang", response,
+                             std::chrono::milliseconds(200)) ==
+              EvmBinaryTransport::Status::TIMEOUT);
+  BOOST_CHECK(transport.Call("xy", response, std::chrono::seconds(5)) ==
+              EvmBinaryTransport::Status::OK);
+  BOOST_CHECK_EQUAL(response, "yx");
+  BOOST_CHECK_EQUAL(server.Accepted(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(no_server) {
+  INIT_STDOUT_LOGGER();
+  std::filesystem::remove(SOCKET_PATH);
+  EvmBinaryTransport transport(SOCKET_PATH, 2);
+
+  std::string response;
+  BOOST_CHECK(transport.Call("abc", response, std::chrono::seconds(1)) ==
+              EvmBinaryTransport::Status::FAILED);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
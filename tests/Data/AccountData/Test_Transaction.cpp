@@ -16,6 +16,7 @@
  */
 
 #include <Schnorr.h>
+#include <algorithm>
 #include <array>
 #include <string>
 #include <vector>
@@ -205,4 +206,57 @@ BOOST_AUTO_TEST_CASE(coveragembnforwardedtxnentry) {
   test << mf << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(test_verify_batch) {
+  INIT_STDOUT_LOGGER();
+
+  LOG_MARKER();
+
+  Address toAddr;
+  for (unsigned int i = 0; i < toAddr.asArray().size(); i++) {
+    toAddr.asArray().at(i) = i + 4;
+  }
+
+  std::vector<Transaction> txns;
+  for (unsigned int i = 0; i < 100; i++) {
+    PairOfKey sender = Schnorr::GenKeyPair();
+    txns.emplace_back(DataConversion::Pack(CHAIN_ID, 1), i + 1, toAddr, sender,
+                      55, PRECISION_MIN_VALUE, 22, zbytes{}, zbytes{});
+  }
+
+  // Swap in signatures over unrelated data for a few of them.
+  const std::vector<size_t> corrupted{0, 41, 99};
+  for (const auto index : corrupted) {
+    PairOfKey other = Schnorr::GenKeyPair();
+    txns[index].SetSignature(TestUtils::GetSignature(
+        TestUtils::GenerateRandomCharVector(TestUtils::Dist1to99()), other));
+  }
+
+  const auto valid = Transaction::VerifyBatch(txns);
+  BOOST_REQUIRE_EQUAL(valid.size(), txns.size());
+  for (size_t i = 0; i < txns.size(); i++) {
+    const bool expected =
+        std::find(corrupted.begin(), corrupted.end(), i) == corrupted.end();
+    BOOST_CHECK_EQUAL(valid[i], expected);
+    BOOST_CHECK_EQUAL(valid[i], Transaction::Verify(txns[i]));
+  }
+
+  BOOST_CHECK(Transaction::VerifyBatch(std::vector<Transaction>{}).empty());
+
+  // Against explicit payloads, the signature must be over those bytes.
+  std::vector<zbytes> txnData(txns.size());
+  for (size_t i = 0; i < txns.size(); i++) {
+    txns[i].SerializeCoreFields(txnData[i], 0);
+  }
+  txnData[7].push_back(0);
+  const auto validData = Transaction::VerifyBatch(txns, txnData);
+  BOOST_REQUIRE_EQUAL(validData.size(), txns.size());
+  for (size_t i = 0; i < txns.size(); i++) {
+    BOOST_CHECK_EQUAL(validData[i], valid[i] && i != 7);
+  }
+
+  txnData.pop_back();
+  const auto mismatched = Transaction::VerifyBatch(txns, txnData);
+  BOOST_CHECK(std::count(mismatched.begin(), mismatched.end(), true) == 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -16,6 +16,7 @@
  */
 
 #include <array>
+#include <limits>
 #include <map>
 #include <string>
 
@@ -209,4 +210,48 @@ BOOST_AUTO_TEST_CASE(txnpool_status) {
   BOOST_CHECK_EQUAL(status.second, txn.GetTranID());
 }
 
+BOOST_AUTO_TEST_CASE(txnpool_snapshot) {
+  TxnPool tp;
+
+  std::vector<Transaction> transaction_v;
+  generateUniqueTransactionVector(transaction_v, TestUtils::Dist1to99() + 1);
+
+  MempoolInsertionStatus status;
+  for (const auto& t : transaction_v) {
+    BOOST_CHECK_EQUAL(true, tp.insert(t, status));
+  }
+
+  // Each index refers to the same stored transaction
+  for (const auto& t : transaction_v) {
+    const auto& handle = tp.HashIndex.at(t.GetTranID());
+    BOOST_CHECK(handle ==
+                tp.NonceIndex.at({t.GetSenderPubKey(), t.GetNonce()}));
+    BOOST_CHECK(handle ==
+                tp.GasIndex.at(t.GetGasPriceQa()).at(t.GetTranID()));
+  }
+
+  // ============================================================
+  // Draining a snapshot leaves the original pool untouched
+  // ============================================================
+  TxnPool snapshot = tp.snapshot();
+  BOOST_CHECK_EQUAL(tp.size(), snapshot.size());
+  BOOST_CHECK(tp.find(transaction_v.front().GetTranID()) ==
+              snapshot.find(transaction_v.front().GetTranID()));
+
+  Transaction transactionTest;
+  uint128_t lastGasPrice = std::numeric_limits<uint128_t>::max();
+  while (snapshot.findOne(transactionTest)) {
+    BOOST_CHECK(transactionTest.GetGasPriceQa() <= lastGasPrice);
+    lastGasPrice = transactionTest.GetGasPriceQa();
+  }
+  BOOST_CHECK_EQUAL(0, snapshot.size());
+  BOOST_CHECK_EQUAL(transaction_v.size(), tp.size());
+
+  for (const auto& t : transaction_v) {
+    const auto* found = tp.find(t.GetTranID());
+    BOOST_REQUIRE(found != nullptr);
+    BOOST_CHECK_EQUAL(true, *found == t);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
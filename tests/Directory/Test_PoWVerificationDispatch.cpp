@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <Schnorr.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "libDirectoryService/DirectoryService.h"
+#include "libUtils/DataConversion.h"
+#include "libUtils/Logger.h"
+
+#define BOOST_TEST_MODULE powverificationdispatch
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#define LOCALHOST 0x7F000001
+#define BASE_PORT 2600
+
+using namespace std;
+
+namespace {
+
+DSPowSolution MakeSolution(const PubKey& key, const string& resultingHash) {
+  return DSPowSolution(1, 3, Peer(LOCALHOST, BASE_PORT), key, 0, resultingHash,
+                       string(64, '0'), 0, 0, {0, 0}, Signature());
+}
+
+PoWSolution MakeRecorded(const string& resultingHash) {
+  array<unsigned char, 32> result{};
+  BOOST_REQUIRE(DataConversion::HexStrToStdArray(resultingHash, result));
+  return PoWSolution(0, result, {}, 0, 0, {0, 0});
+}
+
+}  // namespace
+
+struct Fixture {
+  Fixture() { INIT_STDOUT_LOGGER() }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
+BOOST_AUTO_TEST_SUITE(powverificationdispatch)
+
+// Copies of one solution relayed by several DS members are verified once.
+BOOST_AUTO_TEST_CASE(test_DuplicateClaims) {
+  const PubKey key = Schnorr::GenKeyPair().second;
+  const PubKey otherKey = Schnorr::GenKeyPair().second;
+  const string hashA(64, 'a');
+  const string hashB(64, 'b');
+
+  MapOfPubKeyPoW allPoWs;
+  set<pair<PubKey, string>> inFlight;
+
+  BOOST_CHECK(DirectoryService::ClaimPoWVerificationCore(
+      MakeSolution(key, hashA), allPoWs, inFlight));
+  BOOST_CHECK(!DirectoryService::ClaimPoWVerificationCore(
+      MakeSolution(key, hashA), allPoWs, inFlight));
+
+  // Another solution of the same node, or the same hash of another node, is
+  // a different claim
+  BOOST_CHECK(DirectoryService::ClaimPoWVerificationCore(
+      MakeSolution(key, hashB), allPoWs, inFlight));
+  BOOST_CHECK(DirectoryService::ClaimPoWVerificationCore(
+      MakeSolution(otherKey, hashA), allPoWs, inFlight));
+  BOOST_CHECK_EQUAL(inFlight.size(), 3);
+
+  // Once released, a solution can be claimed again unless it was recorded
+  inFlight.erase({key, hashA});
+  allPoWs[key] = MakeRecorded(hashA);
+  BOOST_CHECK(!DirectoryService::ClaimPoWVerificationCore(
+      MakeSolution(key, hashA), allPoWs, inFlight));
+  inFlight.erase({key, hashB});
+  BOOST_CHECK(DirectoryService::ClaimPoWVerificationCore(
+      MakeSolution(key, hashB), allPoWs, inFlight));
+}
+
+// Without a pool every job runs on the calling thread.
+BOOST_AUTO_TEST_CASE(test_QueueWithoutPool) {
+  const auto caller = this_thread::get_id();
+  thread::id ranOn;
+  DirectoryService::QueuePoWVerificationCore(
+      nullptr, 10, [&ranOn]() { ranOn = this_thread::get_id(); });
+  BOOST_CHECK(ranOn == caller);
+}
+
+// Once the backlog reaches the queue size, the caller verifies inline.
+BOOST_AUTO_TEST_CASE(test_InlineFallbackWhenQueueFull) {
+  const unsigned int queueSize = 2;
+  ThreadPool pool(1, "PoWVerifyTest");
+
+  // Park the only worker so that queued jobs stay pending
+  mutex m;
+  condition_variable cv;
+  bool release = false;
+  promise<void> parked;
+  pool.AddJob([&]() {
+    parked.set_value();
+    unique_lock<mutex> lk(m);
+    cv.wait(lk, [&release]() { return release; });
+  });
+  parked.get_future().wait();
+
+  const auto caller = this_thread::get_id();
+  atomic<int> ranInline{0};
+  atomic<int> ranQueued{0};
+  auto job = [&]() {
+    if (this_thread::get_id() == caller) {
+      ++ranInline;
+    } else {
+      ++ranQueued;
+    }
+  };
+
+  // The parked job still counts as left, so one more fits
+  for (int i = 0; i < 4; ++i) {
+    DirectoryService::QueuePoWVerificationCore(&pool, queueSize, job);
+  }
+  BOOST_CHECK_EQUAL(ranInline, 3);
+  BOOST_CHECK_EQUAL(pool.GetJobsLeft(), static_cast<int>(queueSize));
+
+  {
+    lock_guard<mutex> g(m);
+    release = true;
+  }
+  cv.notify_all();
+  // JoinAll would drop what is still queued, so wait for the backlog instead
+  for (int i = 0; i < 500 && pool.GetJobsLeft() > 0; ++i) {
+    this_thread::sleep_for(chrono::milliseconds(10));
+  }
+  BOOST_CHECK_EQUAL(pool.GetJobsLeft(), 0);
+  BOOST_CHECK_EQUAL(ranQueued, 1);
+}
+
+// Reservations cap the solutions of a node, and only of that node.
+BOOST_AUTO_TEST_CASE(test_ReserveSubmissionsUpToLimit) {
+  const PubKey key = Schnorr::GenKeyPair().second;
+  const PubKey otherKey = Schnorr::GenKeyPair().second;
+  const unsigned int limit = 2;
+
+  map<PubKey, uint8_t> counter;
+  for (unsigned int i = 0; i < limit; ++i) {
+    BOOST_CHECK(
+        DirectoryService::ReservePoWSubmissionCore(counter, key, limit));
+  }
+  BOOST_CHECK(!DirectoryService::ReservePoWSubmissionCore(counter, key, limit));
+  BOOST_CHECK_EQUAL(counter[key], limit);
+
+  BOOST_CHECK(
+      DirectoryService::ReservePoWSubmissionCore(counter, otherKey, limit));
+  BOOST_CHECK_EQUAL(counter[otherKey], 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
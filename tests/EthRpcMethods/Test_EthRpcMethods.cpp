@@ -15,6 +15,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include "libServer/EthCallCache.h"
 #include "libServer/EthRpcMethods.h"
 
 #define BOOST_TEST_MODULE ethrpcmethodstest
@@ -70,4 +71,47 @@ BOOST_AUTO_TEST_CASE(test_UnpackRevert4) {
   BOOST_ASSERT(!EthRpcMethods::UnpackRevert(input_str, message));
 }
 
+BOOST_AUTO_TEST_CASE(test_EthCallCache) {
+  EthCallCache cache{2};
+  const dev::h256 root1 = dev::h256::random();
+  const dev::h256 root2 = dev::h256::random();
+  const Address from{"0x0000000000000000000000000000000000000001"};
+  const Address to{"0x0000000000000000000000000000000000000002"};
+  const zbytes data{0x70, 0xa0, 0x82, 0x31};
+
+  const auto key = EthCallCache::MakeKey("eth_call", from, to, 0, 21000, data);
+  BOOST_CHECK(key !=
+              EthCallCache::MakeKey("eth_call", from, to, 1, 21000, data));
+  BOOST_CHECK(key !=
+              EthCallCache::MakeKey("eth_estimateGas", from, to, 0, 21000,
+                                    data));
+
+  EthCallCache::Outcome outcome;
+  outcome.success = true;
+  outcome.result = "0x01";
+  cache.Put(root1, 10, key, outcome);
+
+  auto cached = cache.Get(root1, 10, key);
+  BOOST_REQUIRE(cached.has_value());
+  BOOST_CHECK_EQUAL(cached->result, "0x01");
+
+  // A new block or state root invalidates everything
+  BOOST_CHECK(!cache.Get(root1, 11, key).has_value());
+  cache.Put(root1, 11, key, outcome);
+  BOOST_CHECK(!cache.Get(root2, 11, key).has_value());
+  BOOST_CHECK(!cache.Get(root1, 11, key).has_value());
+
+  // Bounded: the least recently used entry is evicted
+  cache.Put(root2, 11, "a", outcome);
+  cache.Put(root2, 11, "b", outcome);
+  BOOST_CHECK(cache.Get(root2, 11, "a").has_value());
+  cache.Put(root2, 11, "c", outcome);
+  BOOST_CHECK(cache.Get(root2, 11, "a").has_value());
+  BOOST_CHECK(!cache.Get(root2, 11, "b").has_value());
+
+  EthCallCache disabled{0};
+  disabled.Put(root1, 10, key, outcome);
+  BOOST_CHECK(!disabled.Get(root1, 10, key).has_value());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -16,8 +16,11 @@
  */
 
 #include <array>
+#include <map>
+#include <set>
 
 #include "libEth/filters/FiltersUtils.h"
+#include "libEth/filters/SubscriptionIndex.h"
 #include "libUtils/Logger.h"
 
 #define BOOST_TEST_MODULE filtersapitest
@@ -355,6 +358,60 @@ BOOST_AUTO_TEST_CASE(event_filter_match) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(subscription_index) {
+  SubscriptionIndex index;
+  std::map<std::string, EventFilterParams> filters;
+  for (size_t i = 0; i < VALID_TOPIC_FILTERS.size(); ++i) {
+    Json::Value json;
+    std::string error;
+    json[TOPICS_STR] = JsonRead(VALID_TOPIC_FILTERS[i], error);
+    BOOST_REQUIRE_MESSAGE(error.empty(), "Error: " << error);
+
+    // Each filter once without and once with an address
+    EventFilterParams f;
+    BOOST_REQUIRE(InitializeEventFilter(json, f, error));
+    filters["any" + std::to_string(i)] = f;
+    f.address = {SOME_ADDRESS};
+    filters["addr" + std::to_string(i)] = f;
+  }
+  for (const auto& pair : filters) {
+    index.Add(pair.first, pair.second);
+  }
+  BOOST_REQUIRE_EQUAL(index.Size(), filters.size());
+
+  // The index must agree with matching every filter one by one
+  auto check = [&]() {
+    for (const auto& address : {SOME_ADDRESS, OTHER_ADDRESS}) {
+      for (const auto& topics : SAMPLE_TOPICS) {
+        auto found = index.Find(address, topics);
+        std::set<std::string> got(found.begin(), found.end());
+        BOOST_REQUIRE_EQUAL(got.size(), found.size());
+
+        std::set<std::string> expected;
+        for (const auto& pair : filters) {
+          if (Match(pair.second, address, topics)) {
+            expected.insert(pair.first);
+          }
+        }
+        BOOST_REQUIRE(got == expected);
+      }
+    }
+  };
+
+  check();
+
+  for (auto it = filters.begin(); it != filters.end();) {
+    BOOST_REQUIRE(index.Remove(it->first));
+    it = filters.erase(it);
+    if (it != filters.end()) {
+      ++it;
+    }
+  }
+  check();
+
+  BOOST_REQUIRE(!index.Remove("unknown"));
+}
+
 BOOST_AUTO_TEST_CASE(install_filters_result) {
   auto meta = APICache::Create();
 
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "libLookup/SyncScheduler.h"
+
+#define BOOST_TEST_MODULE syncschedulertest
+#include <boost/test/included/unit_test.hpp>
+
+using namespace std;
+
+namespace {
+
+SyncScheduler::Payload MakePayload(uint64_t low, uint64_t high) {
+  SyncScheduler::Payload payload;
+  for (auto i = low; i <= high; ++i) {
+    payload.push_back({static_cast<uint8_t>(i)});
+  }
+  return payload;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(syncschedulertest)
+
+BOOST_AUTO_TEST_CASE(out_of_order_delivery) {
+  auto now = SyncScheduler::Clock::now();
+  SyncScheduler scheduler(1, 25, 10, 3, 3, chrono::seconds(5), 3);
+
+  auto requests = scheduler.NextRequests(now);
+  BOOST_REQUIRE_EQUAL(requests.size(), 3);
+  BOOST_CHECK_EQUAL(requests[0].lowBlockNum, 1);
+  BOOST_CHECK_EQUAL(requests[0].highBlockNum, 10);
+  BOOST_CHECK_EQUAL(requests[2].lowBlockNum, 21);
+  BOOST_CHECK_EQUAL(requests[2].highBlockNum, 25);
+  // Each window goes to its own peer
+  BOOST_CHECK(requests[0].peer != requests[1].peer);
+  BOOST_CHECK(requests[1].peer != requests[2].peer);
+
+  // Later windows are held back until the first one arrives
+  BOOST_CHECK(scheduler.Deliver(21, 25, MakePayload(21, 25)));
+  BOOST_CHECK(scheduler.Deliver(11, 20, MakePayload(11, 20)));
+  BOOST_CHECK(scheduler.PopReady().empty());
+
+  BOOST_CHECK(scheduler.Deliver(1, 10, MakePayload(1, 10)));
+  auto ready = scheduler.PopReady();
+  BOOST_REQUIRE_EQUAL(ready.size(), 3);
+  BOOST_CHECK_EQUAL(ready[0].lowBlockNum, 1);
+  BOOST_CHECK_EQUAL(ready[1].lowBlockNum, 11);
+  BOOST_CHECK_EQUAL(ready[2].lowBlockNum, 21);
+  BOOST_CHECK_EQUAL(ready[2].payload.size(), 5);
+
+  BOOST_CHECK(scheduler.Done());
+  BOOST_CHECK(!scheduler.Failed());
+
+  // Nothing outstanding any more
+  BOOST_CHECK(!scheduler.Deliver(1, 10, MakePayload(1, 10)));
+}
+
+BOOST_AUTO_TEST_CASE(stalled_window_is_reassigned) {
+  auto now = SyncScheduler::Clock::now();
+  SyncScheduler scheduler(1, 20, 10, 2, 1, chrono::seconds(5), 2);
+
+  auto requests = scheduler.NextRequests(now);
+  BOOST_REQUIRE_EQUAL(requests.size(), 1);
+  auto firstPeer = requests[0].peer;
+
+  // Limited to one request in flight until it times out
+  BOOST_CHECK(scheduler.NextRequests(now + chrono::seconds(1)).empty());
+
+  requests = scheduler.NextRequests(now + chrono::seconds(6));
+  BOOST_REQUIRE_EQUAL(requests.size(), 1);
+  BOOST_CHECK_EQUAL(requests[0].lowBlockNum, 1);
+  BOOST_CHECK(requests[0].peer != firstPeer);
+
+  // Out of attempts for the first window
+  BOOST_CHECK(scheduler.NextRequests(now + chrono::seconds(12)).empty());
+  BOOST_CHECK(scheduler.Failed());
+  BOOST_CHECK(!scheduler.Done());
+}
+
+BOOST_AUTO_TEST_CASE(rejected_window_is_requested_again) {
+  auto now = SyncScheduler::Clock::now();
+  SyncScheduler scheduler(5, 5, 10, 2, 2, chrono::seconds(5), 3);
+
+  auto requests = scheduler.NextRequests(now);
+  BOOST_REQUIRE_EQUAL(requests.size(), 1);
+  BOOST_CHECK_EQUAL(requests[0].highBlockNum, 5);
+
+  scheduler.Reject(5, 5);
+  requests = scheduler.NextRequests(now);
+  BOOST_REQUIRE_EQUAL(requests.size(), 1);
+
+  BOOST_CHECK(!scheduler.Deliver(5, 6, MakePayload(5, 6)));
+  BOOST_CHECK(scheduler.Deliver(5, 5, MakePayload(5, 5)));
+  BOOST_CHECK_EQUAL(scheduler.PopReady().size(), 1);
+  BOOST_CHECK(scheduler.Done());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -229,6 +229,18 @@ int TestSerialize() {
 
       ok = (result.startByte == start_byte) && (result.message == msg) &&
            (result.hash == hash);
+
+      // Layout must be readable from the header prefix alone
+      zil::p2p::MessageLayout layout;
+      state = zil::p2p::TryReadMessageLayout(
+          (const uint8_t*)raw.data.get(), zil::p2p::MAX_LAYOUT_PREFIX_LEN,
+          raw.size, layout);
+      ok = ok && (state == zil::p2p::ReadState::SUCCESS) &&
+           (layout.messageBytes == msg.size()) &&
+           (layout.hashBytes == hash.size()) &&
+           (layout.headerBytes + layout.hashBytes + layout.messageBytes +
+                layout.traceBytes ==
+            raw.size);
       if (ok && with_traces) {
         ok = (result.traceInfo == trace_info);
         auto span = zil::trace::Tracing::CreateChildSpanOfRemoteTrace(
@@ -308,6 +308,86 @@ BOOST_AUTO_TEST_CASE(mining_and_verification) {
   BOOST_REQUIRE(!verifyWinningNonce);
 }
 
+BOOST_AUTO_TEST_CASE(verification_with_shared_epoch_context) {
+  POW& POWClient = POW::GetInstance();
+  std::array<unsigned char, 32> rand1 = {{'0', '1'}};
+  std::array<unsigned char, 32> rand2 = {{'0', '2'}};
+  auto peer = TestUtils::GenerateRandomPeer();
+  auto keyPair = Schnorr::GenKeyPair();
+  auto pubKey = keyPair.second;
+
+  uint8_t difficultyToUse = 5;
+  uint64_t blockToUse = 0;
+  auto headerHash = POW::GenHeaderHash(rand1, rand2, peer, pubKey, 0, 0);
+  ethash_mining_result_t winning_result =
+      POWClient.PoWMine(blockToUse, difficultyToUse, keyPair, headerHash, false,
+                        std::time(0), POW_WINDOW_IN_SECONDS);
+  BOOST_REQUIRE(winning_result.success);
+
+  // Several verifiers sharing one context must agree with PoWVerify
+  auto context = POWClient.GetLightEpochContext(blockToUse);
+  std::vector<std::thread> verifiers;
+  std::atomic<unsigned int> numVerified{0};
+  for (unsigned int i = 0; i < 4; ++i) {
+    verifiers.emplace_back([&] {
+      if (POW::PoWVerify(*context, difficultyToUse, headerHash,
+                         winning_result.winning_nonce, winning_result.result,
+                         winning_result.mix_hash)) {
+        ++numVerified;
+      }
+    });
+  }
+  for (auto& verifier : verifiers) {
+    verifier.join();
+  }
+  BOOST_REQUIRE_EQUAL(numVerified, 4U);
+
+  BOOST_REQUIRE(!POW::PoWVerify(*context, difficultyToUse, headerHash,
+                                winning_result.winning_nonce + 1,
+                                winning_result.result,
+                                winning_result.mix_hash));
+}
+
+BOOST_AUTO_TEST_CASE(mining_multi_thread_rounds_and_stop) {
+  POW& POWClient = POW::GetInstance();
+  std::array<unsigned char, 32> rand1 = {{'0', '1'}};
+  std::array<unsigned char, 32> rand2 = {{'0', '2'}};
+  auto peer = TestUtils::GenerateRandomPeer();
+  auto keyPair = Schnorr::GenKeyPair();
+  auto pubKey = keyPair.second;
+
+  // Back to back rounds must each return a solution found by one of the
+  // workers, which means every worker of the previous round has finished
+  uint8_t difficultyToUse = 5;
+  uint64_t blockToUse = 0;
+  for (uint32_t round = 0; round < 3; ++round) {
+    auto headerHash = POW::GenHeaderHash(rand1, rand2, peer, pubKey, round, 0);
+    ethash_mining_result_t winning_result =
+        POWClient.PoWMine(blockToUse, difficultyToUse, keyPair, headerHash,
+                          false, round, POW_WINDOW_IN_SECONDS);
+    BOOST_REQUIRE(winning_result.success);
+    BOOST_REQUIRE(POWClient.PoWVerify(
+        blockToUse, difficultyToUse, headerHash, winning_result.winning_nonce,
+        winning_result.result, winning_result.mix_hash));
+  }
+
+  // Stopping mining must release all workers well before the time window
+  difficultyToUse = 255;
+  auto headerHash = POW::GenHeaderHash(rand1, rand2, peer, pubKey, 0, 0);
+  std::thread stopper([&POWClient] {
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    POWClient.StopMining();
+  });
+  auto startTime = std::chrono::steady_clock::now();
+  ethash_mining_result_t stopped_result =
+      POWClient.PoWMine(blockToUse, difficultyToUse, keyPair, headerHash, false,
+                        0, POW_WINDOW_IN_SECONDS);
+  auto elapsed = std::chrono::steady_clock::now() - startTime;
+  stopper.join();
+  BOOST_REQUIRE(!stopped_result.success);
+  BOOST_REQUIRE(elapsed < std::chrono::seconds(POW_WINDOW_IN_SECONDS));
+}
+
 BOOST_AUTO_TEST_CASE(mining_and_verification_big_block_number) {
   POW& POWClient = POW::GetInstance();
   std::array<unsigned char, 32> rand1 = {{'0', '1'}};
@@ -101,4 +101,104 @@ BOOST_AUTO_TEST_CASE(contract_proof_test) {
       proof, root1, hashed_key2));
 }
 
+BOOST_AUTO_TEST_CASE(committed_state_snapshot_test) {
+  INIT_STDOUT_LOGGER();
+
+  LOG_MARKER();
+
+  auto& cs = ContractStorage::GetContractStorage();
+
+  PairOfKey kpair = Schnorr::GenKeyPair();
+  Address addr = Account::GetAddressFromPublicKey(kpair.second);
+
+  map<string, zbytes> t_states;
+  t_states.emplace(cs.GenerateStorageKey(addr, "ccc", {}),
+                   DataConversion::StringToCharArray("\"5\""));
+  t_states.emplace(cs.GenerateStorageKey(addr, MAP_DEPTH_INDICATOR, {"ccc"}),
+                   DataConversion::StringToCharArray("0"));
+
+  h256 root;
+  cs.UpdateStateDatasAndToDeletes(addr, dev::h256(), t_states, {}, root, false,
+                                  false);
+
+  // Not visible to readers until published
+  Json::Value before;
+  BOOST_CHECK(cs.FetchStateJsonForContract(before, addr));
+  BOOST_CHECK(!before.isMember("ccc"));
+
+  cs.PublishCommittedState();
+  Json::Value published;
+  BOOST_CHECK(cs.FetchStateJsonForContract(published, addr));
+  BOOST_CHECK(published.isMember("ccc"));
+
+  // Moving the state to disk republishes it from the DB snapshot
+  BOOST_CHECK(cs.CommitStateDB(101));
+  Json::Value committed;
+  BOOST_CHECK(cs.FetchStateJsonForContract(committed, addr));
+  BOOST_CHECK(committed.isMember("ccc"));
+}
+
+BOOST_AUTO_TEST_CASE(committed_state_layers_test) {
+  INIT_STDOUT_LOGGER();
+
+  LOG_MARKER();
+
+  auto& cs = ContractStorage::GetContractStorage();
+
+  PairOfKey kpair = Schnorr::GenKeyPair();
+  Address addr = Account::GetAddressFromPublicKey(kpair.second);
+  const auto key = cs.GenerateStorageKey(addr, "ddd", {});
+
+  auto update = [&](const string& value, const vector<string>& toDeletes,
+                    bool revertible) {
+    map<string, zbytes> t_states;
+    if (!value.empty()) {
+      t_states.emplace(key, DataConversion::StringToCharArray(value));
+      t_states.emplace(
+          cs.GenerateStorageKey(addr, MAP_DEPTH_INDICATOR, {"ddd"}),
+          DataConversion::StringToCharArray("0"));
+    }
+    h256 root;
+    cs.UpdateStateDatasAndToDeletes(addr, dev::h256(), t_states, toDeletes,
+                                    root, false, revertible);
+  };
+  auto fetch = [&]() {
+    Json::Value json;
+    BOOST_CHECK(cs.FetchStateJsonForContract(json, addr));
+    return json.isMember("ddd") ? json["ddd"].asString() : string();
+  };
+
+  // Start from a value that only lives in the DB
+  update("\"1\"", {}, false);
+  BOOST_CHECK(cs.CommitStateDB(102));
+  BOOST_CHECK_EQUAL(fetch(), "1");
+
+  // Each publish layers the changed key over the DB value
+  for (int i = 2; i < 10; ++i) {
+    update("\"" + to_string(i) + "\"", {}, false);
+    cs.PublishCommittedState();
+    BOOST_CHECK_EQUAL(fetch(), to_string(i));
+  }
+
+  // A deletion in a newer layer hides both older layers and the DB
+  update("", {key}, false);
+  cs.PublishCommittedState();
+  BOOST_CHECK_EQUAL(fetch(), "");
+
+  // Re-adding and reverting restores the deletion
+  cs.InitRevertibles();
+  update("\"10\"", {}, true);
+  cs.PublishCommittedState();
+  BOOST_CHECK_EQUAL(fetch(), "10");
+  cs.RevertContractStates();
+  BOOST_CHECK_EQUAL(fetch(), "");
+
+  // Moving to disk folds the layers back into the DB snapshot
+  BOOST_CHECK(cs.CommitStateDB(103));
+  BOOST_CHECK_EQUAL(fetch(), "");
+  update("\"11\"", {}, false);
+  cs.PublishCommittedState();
+  BOOST_CHECK_EQUAL(fetch(), "11");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string>
+
+#include "libEth/filters/FiltersUtils.h"
+#include "libEth/filters/LogIndex.h"
+#include "libPersistence/BlockStorage.h"
+#include "libTestUtils/TestUtils.h"
+
+#define BOOST_TEST_MODULE persistencetest
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace evmproj::filters;
+
+namespace {
+
+const string ADDRESS_A = "0x1111111111111111111111111111111111111111";
+const string ADDRESS_B = "0x2222222222222222222222222222222222222222";
+const string TOPIC =
+    "0x00000000000000000000000000000000000000000000000000000000000000aa";
+
+void IndexLogs(LogIndex& index, EpochNumber epoch, const string& address,
+               size_t count) {
+  BlocksCache::EpochMetadata meta;
+  meta.epoch = epoch;
+  for (size_t i = 0; i < count; ++i) {
+    Json::Value log;
+    log[ADDRESS_STR] = address;
+    log[TOPICS_STR].append(TOPIC);
+    log[DATA_STR] = NumberAsString(i);
+    meta.meta.push_back({address, {TOPIC}, log});
+  }
+  index.EpochFinalized(meta);
+}
+
+EventFilterParams FilterFor(const string& address, EpochNumber fromBlock,
+                            EpochNumber toBlock) {
+  EventFilterParams filter;
+  filter.address.push_back(address);
+  filter.fromBlock = fromBlock;
+  filter.toBlock = toBlock;
+  return filter;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(persistencetest)
+
+BOOST_AUTO_TEST_CASE(init) {
+  INIT_STDOUT_LOGGER();
+  TestUtils::Initialize();
+
+  // The event log DB only exists on lookup nodes
+  LOOKUP_NODE_MODE = true;
+}
+
+BOOST_AUTO_TEST_CASE(testPutAndGetEventLogs) {
+  LOG_MARKER();
+
+  auto& storage = BlockStorage::GetBlockStorage();
+  BOOST_REQUIRE(storage.ResetDB(BlockStorage::DBTYPE::EVENT_LOGS));
+
+  dev::h2048 bloomA;
+  bloomA[0] = 0x01;
+  dev::h2048 bloomB;
+  bloomB[255] = 0x80;
+
+  const uint64_t epochA = 3;
+  const uint64_t epochB = EVENT_LOG_INDEX_SECTION_SIZE - 1;
+  const uint64_t epochC = EVENT_LOG_INDEX_SECTION_SIZE;
+
+  BOOST_CHECK(storage.PutEventLogs(epochA, bloomA, "[{\"a\":1}]"));
+  BOOST_CHECK(storage.PutEventLogs(epochB, bloomB, "[{\"b\":2}]"));
+  BOOST_CHECK(storage.PutEventLogs(epochC, bloomB, "[{\"c\":3}]"));
+
+  std::string logs;
+  BOOST_CHECK(storage.GetEventLogs(epochA, logs));
+  BOOST_CHECK_EQUAL(logs, "[{\"a\":1}]");
+  BOOST_CHECK(!storage.GetEventLogs(epochA + 1, logs));
+
+  dev::h2048 bloom;
+  BOOST_CHECK(storage.GetEventLogsBloom(epochB, bloom));
+  BOOST_CHECK(bloom == bloomB);
+  BOOST_CHECK(!storage.GetEventLogsBloom(epochA + 1, bloom));
+
+  // The first section holds the union of epochA and epochB blooms only
+  BOOST_CHECK(storage.GetEventLogsSectionBloom(0, bloom));
+  BOOST_CHECK(bloom == (bloomA | bloomB));
+  BOOST_CHECK(storage.GetEventLogsSectionBloom(1, bloom));
+  BOOST_CHECK(bloom == bloomB);
+  BOOST_CHECK(!storage.GetEventLogsSectionBloom(2, bloom));
+}
+
+BOOST_AUTO_TEST_CASE(testLogIndexScanAndResultCap) {
+  LOG_MARKER();
+
+  BOOST_REQUIRE(
+      BlockStorage::GetBlockStorage().ResetDB(BlockStorage::DBTYPE::EVENT_LOGS));
+
+  LogIndex index;
+  IndexLogs(index, 5, ADDRESS_A, 3);
+  IndexLogs(index, 6, ADDRESS_B, 1);
+  IndexLogs(index, 7, ADDRESS_A, 2);
+
+  // Scan reports the last epoch it went through completely
+  vector<EpochNumber> epochs;
+  BOOST_CHECK_EQUAL(index.Scan(FilterFor(ADDRESS_A, 0, 10), 0, 10,
+                               [&epochs](EpochNumber epoch, const auto&) {
+                                 epochs.push_back(epoch);
+                                 return epochs.size() < 4;
+                               }),
+                    6);
+  BOOST_CHECK((epochs == vector<EpochNumber>{5, 5, 5, 7}));
+
+  PollResult all;
+  index.GetLogs(FilterFor(ADDRESS_A, EARLIEST_EPOCH, LATEST_EPOCH), 10, 5,
+                all);
+  BOOST_CHECK(all.success);
+  BOOST_CHECK_EQUAL(all.result.size(), 5);
+
+  PollResult other;
+  index.GetLogs(FilterFor(ADDRESS_B, 0, 10), 10, 5, other);
+  BOOST_CHECK(other.success);
+  BOOST_CHECK_EQUAL(other.result.size(), 1);
+
+  // Over the cap nothing is returned, only the range that fits
+  PollResult capped;
+  index.GetLogs(FilterFor(ADDRESS_A, 0, 10), 10, 4, capped);
+  BOOST_CHECK(!capped.success);
+  BOOST_CHECK_EQUAL(capped.result.size(), 0);
+  BOOST_CHECK_NE(capped.error.find("more than 4 results"), string::npos);
+  BOOST_CHECK_NE(capped.error.find("[0x0, 0x6]"), string::npos);
+
+  // When not even the first epoch fits there is no range to suggest
+  PollResult first;
+  index.GetLogs(FilterFor(ADDRESS_A, 5, 10), 10, 2, first);
+  BOOST_CHECK(!first.success);
+  BOOST_CHECK_EQUAL(first.error.find("Try with"), string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(testLogIndexBlockRange) {
+  LOG_MARKER();
+
+  BOOST_REQUIRE(
+      BlockStorage::GetBlockStorage().ResetDB(BlockStorage::DBTYPE::EVENT_LOGS));
+
+  LogIndex index;
+  IndexLogs(index, 5, ADDRESS_A, 1);
+  IndexLogs(index, 9, ADDRESS_A, 1);
+
+  PollResult reversed;
+  index.GetLogs(FilterFor(ADDRESS_A, 8, 3), 10, 5, reversed);
+  BOOST_CHECK(!reversed.success);
+  BOOST_CHECK_NE(reversed.error.find("Invalid block range"), string::npos);
+
+  // Epochs past the latest one are clamped to it
+  PollResult clamped;
+  index.GetLogs(FilterFor(ADDRESS_A, 0, 100), 7, 5, clamped);
+  BOOST_CHECK(clamped.success);
+  BOOST_CHECK_EQUAL(clamped.result.size(), 1);
+
+  PollResult beyond;
+  index.GetLogs(FilterFor(ADDRESS_A, 20, 30), 10, 5, beyond);
+  BOOST_CHECK(!beyond.success);
+  BOOST_CHECK_NE(beyond.error.find("after the latest block"), string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
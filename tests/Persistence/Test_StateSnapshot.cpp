@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define BOOST_TEST_MODULE statesnapshottest
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+#include "common/Constants.h"
+#include "libPersistence/StateSnapshot.h"
+#include "libUtils/Logger.h"
+
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE(statesnapshottest)
+
+zbytes MakePayload(size_t size) {
+  zbytes payload(size);
+  for (size_t i = 0; i < size; ++i) {
+    payload[i] = static_cast<zbyte>(i * 31 + 7);
+  }
+  return payload;
+}
+
+BOOST_AUTO_TEST_CASE(write_load_roundtrip) {
+  INIT_STDOUT_LOGGER();
+
+  filesystem::remove_all(STORAGE_PATH + STATE_SNAPSHOT_PATH);
+
+  const dev::h256 root = dev::h256::random();
+  const auto payload = MakePayload(4096);
+  BOOST_REQUIRE(StateSnapshot::Write(199, root, payload));
+  BOOST_REQUIRE(StateSnapshot::Write(99, root, payload));
+
+  uint64_t latest = 0;
+  BOOST_REQUIRE(StateSnapshot::FindLatest(1000, latest));
+  BOOST_CHECK_EQUAL(latest, 199);
+  BOOST_REQUIRE(StateSnapshot::FindLatest(150, latest));
+  BOOST_CHECK_EQUAL(latest, 99);
+  BOOST_CHECK(!StateSnapshot::FindLatest(50, latest));
+
+  zbytes loaded;
+  BOOST_REQUIRE(StateSnapshot::Load(199, root, loaded));
+  BOOST_CHECK(loaded == payload);
+
+  // A snapshot of a different state must not be accepted
+  BOOST_CHECK(!StateSnapshot::Load(199, dev::h256::random(), loaded));
+}
+
+BOOST_AUTO_TEST_CASE(corrupt_snapshot_rejected) {
+  INIT_STDOUT_LOGGER();
+
+  const dev::h256 root = dev::h256::random();
+  BOOST_REQUIRE(StateSnapshot::Write(299, root, MakePayload(4096)));
+
+  const auto path = StateSnapshot::GetPath(299);
+  {
+    fstream file(path, ios::binary | ios::in | ios::out);
+    file.seekp(-1, ios::end);
+    file.put('\xff');
+  }
+
+  zbytes loaded;
+  BOOST_CHECK(!StateSnapshot::Load(299, root, loaded));
+
+  filesystem::resize_file(path, filesystem::file_size(path) / 2);
+  BOOST_CHECK(!StateSnapshot::Load(299, root, loaded));
+}
+
+BOOST_AUTO_TEST_CASE(prune_keeps_newest) {
+  INIT_STDOUT_LOGGER();
+
+  filesystem::remove_all(STORAGE_PATH + STATE_SNAPSHOT_PATH);
+
+  const dev::h256 root = dev::h256::random();
+  for (uint64_t blockNum : {99, 199, 299, 399}) {
+    BOOST_REQUIRE(StateSnapshot::Write(blockNum, root, MakePayload(128)));
+  }
+  StateSnapshot::Prune();
+
+  for (uint64_t blockNum : {99, 199, 299, 399}) {
+    BOOST_CHECK_EQUAL(filesystem::exists(StateSnapshot::GetPath(blockNum)),
+                      blockNum + STATE_SNAPSHOT_KEEP * 100 > 399);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
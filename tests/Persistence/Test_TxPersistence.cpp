@@ -543,4 +543,46 @@ BOOST_AUTO_TEST_CASE(testInsertTxBlockAndQuery) {
   BOOST_CHECK(blockRetrieved->GetBlockHash() == block.GetBlockHash());
 }
 
+BOOST_AUTO_TEST_CASE(testWriteTransaction) {
+  LOG_MARKER();
+
+  BlockStorage::GetBlockStorage().ResetAll();
+
+  constexpr auto BLOCK_NUM = 456;
+
+  TxBlock block = constructDummyTxBlock(BLOCK_NUM);
+  zbytes serializedTxBlock;
+  block.Serialize(serializedTxBlock, 0);
+  const zbytes stateDelta{1, 2, 3, 4};
+
+  auto writeTxn = BlockStorage::GetBlockStorage().BeginWriteTransaction();
+  BOOST_CHECK(writeTxn.PutTxBlock(block.GetHeader(), serializedTxBlock));
+  BOOST_CHECK(writeTxn.PutStateDelta(BLOCK_NUM, stateDelta));
+
+  // Nothing is visible before the commit
+  TxBlockSharedPtr blockRetrieved;
+  BlockStorage::GetBlockStorage().GetTxBlock(BLOCK_NUM, blockRetrieved);
+  BOOST_CHECK(blockRetrieved.get() == nullptr);
+
+  BOOST_CHECK(writeTxn.Commit());
+
+  BlockStorage::GetBlockStorage().GetTxBlock(BLOCK_NUM, blockRetrieved);
+  BOOST_REQUIRE(blockRetrieved.get() != nullptr);
+  BOOST_CHECK(blockRetrieved->GetBlockHash() == block.GetBlockHash());
+
+  blockRetrieved.reset();
+  BlockStorage::GetBlockStorage().GetTxBlock(block.GetBlockHash(),
+                                             blockRetrieved);
+  BOOST_REQUIRE(blockRetrieved.get() != nullptr);
+  BOOST_CHECK(blockRetrieved->GetHeader().GetBlockNum() == BLOCK_NUM);
+
+  zbytes stateDeltaRetrieved;
+  BOOST_CHECK(BlockStorage::GetBlockStorage().GetStateDelta(
+      BLOCK_NUM, stateDeltaRetrieved));
+  BOOST_CHECK(stateDeltaRetrieved == stateDelta);
+
+  // A committed transaction is empty and can be committed again
+  BOOST_CHECK(writeTxn.Commit());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Stands in for scilla-server in Test_ScillaClient. Every call is appended to
+// the file named by its "log" parameter before an optional "sleep_ms" delay,
+// so the test can tell which calls reached a server and how often.
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include <jsonrpccpp/server/abstractserver.h>
+
+#include "libScilla/UnixDomainSocketServer.h"
+#include "libUtils/Logger.h"
+
+using namespace jsonrpc;
+
+class StubScillaServer : public AbstractServer<StubScillaServer> {
+ public:
+  explicit StubScillaServer(AbstractServerConnector& conn)
+      : AbstractServer<StubScillaServer>(conn, JSONRPC_SERVER_V2) {
+    bindAndAddMethod(Procedure("run", PARAMS_BY_NAME, JSON_STRING, NULL),
+                     &StubScillaServer::runI);
+    bindAndAddMethod(Procedure("check", PARAMS_BY_NAME, JSON_STRING, NULL),
+                     &StubScillaServer::checkI);
+  }
+
+  void runI(const Json::Value& request, Json::Value& response) {
+    Serve("run", request, response);
+  }
+
+  void checkI(const Json::Value& request, Json::Value& response) {
+    Serve("check", request, response);
+  }
+
+ private:
+  static void Serve(const std::string& method, const Json::Value& request,
+                    Json::Value& response) {
+    {
+      std::ofstream log(request["log"].asString(), std::ios::app);
+      log << method << ' ' << request["tag"].asString() << ' ' << getpid()
+          << std::endl;
+    }
+    if (request.isMember("sleep_ms")) {
+      std::this_thread::sleep_for(
+          std::chrono::milliseconds(request["sleep_ms"].asUInt()));
+    }
+    response = method + ':' + request["tag"].asString();
+  }
+};
+
+int main(int argc, const char* argv[]) {
+  INIT_STDOUT_LOGGER();
+
+  std::string socketPath;
+  for (int i = 1; i + 1 < argc; ++i) {
+    if (strcmp(argv[i], "-socket") == 0) {
+      socketPath = argv[i + 1];
+    }
+  }
+  if (socketPath.empty()) {
+    LOG_GENERAL(WARNING, "Usage: " << argv[0] << " -socket <path>");
+    return 1;
+  }
+
+  rpc::UnixDomainSocketServer connector(socketPath);
+  StubScillaServer server(connector);
+  if (!server.StartListening()) {
+    return 1;
+  }
+
+  // Runs until the client stops it
+  while (true) {
+    pause();
+  }
+}
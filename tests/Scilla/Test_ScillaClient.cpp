@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Runs ScillaClient against StubScillaServer, which the CMake setup of this
+// directory installs as the scilla-server of version 0.
+
+#include <signal.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/Constants.h"
+#include "libScilla/ScillaClient.h"
+#include "libUtils/Logger.h"
+
+#define BOOST_TEST_MODULE scillaclient
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+namespace fs = std::filesystem;
+
+namespace {
+
+const uint32_t VERSION = 0;
+
+string GetLogPath() { return (fs::current_path() / "stub_calls.log").string(); }
+
+Json::Value MakeRequest(const string& tag, unsigned int sleepMs = 0) {
+  Json::Value request;
+  request["log"] = GetLogPath();
+  request["tag"] = tag;
+  if (sleepMs > 0) {
+    request["sleep_ms"] = sleepMs;
+  }
+  return request;
+}
+
+/// Returns the pids of the stub processes that were handed a call with tag.
+vector<pid_t> GetCalls(const string& tag) {
+  vector<pid_t> pids;
+  ifstream log(GetLogPath());
+  string line;
+  while (getline(log, line)) {
+    istringstream fields(line);
+    string method, callTag;
+    pid_t pid = 0;
+    if (fields >> method >> callTag >> pid && callTag == tag) {
+      pids.push_back(pid);
+    }
+  }
+  return pids;
+}
+
+bool WaitForCalls(const string& tag, size_t count) {
+  for (int i = 0; i < 500; ++i) {
+    if (GetCalls(tag).size() >= count) {
+      return true;
+    }
+    this_thread::sleep_for(chrono::milliseconds(10));
+  }
+  return false;
+}
+
+future<bool> CallRunnerAsync(const Json::Value& request) {
+  return async(launch::async, [request]() {
+    string result;
+    return ScillaClient::GetInstance().CallRunner(VERSION, request, result);
+  });
+}
+
+}  // namespace
+
+struct Fixture {
+  Fixture() {
+    INIT_STDOUT_LOGGER()
+    fs::remove(GetLogPath());
+  }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
+BOOST_AUTO_TEST_SUITE(scillaclient)
+
+BOOST_AUTO_TEST_CASE(test_call) {
+  BOOST_REQUIRE(ScillaClient::GetInstance().CheckClient(VERSION));
+
+  string result;
+  BOOST_CHECK(ScillaClient::GetInstance().CallRunner(
+      VERSION, MakeRequest("plain"), result));
+  BOOST_CHECK_EQUAL(result, "run:plain");
+  BOOST_CHECK(ScillaClient::GetInstance().CallChecker(
+      VERSION, MakeRequest("plain"), result));
+  BOOST_CHECK_EQUAL(result, "check:plain");
+  BOOST_CHECK_EQUAL(GetCalls("plain").size(), 2);
+}
+
+// A call given up on by its caller fails once its server is stopped, and is
+// not sent again to the restarted server.
+BOOST_AUTO_TEST_CASE(test_reset_worker_not_retried) {
+  const Json::Value request = MakeRequest("timed_out", 60000);
+  auto pending = CallRunnerAsync(request);
+  BOOST_REQUIRE(WaitForCalls("timed_out", 1));
+  const pid_t stopped = GetCalls("timed_out").front();
+
+  // Requests of other calls leave the worker alone
+  ScillaClient::GetInstance().ResetWorker(VERSION, MakeRequest("other"));
+  BOOST_CHECK(pending.wait_for(chrono::milliseconds(200)) ==
+              future_status::timeout);
+
+  ScillaClient::GetInstance().ResetWorker(VERSION, request);
+  BOOST_REQUIRE(pending.wait_for(chrono::seconds(10)) == future_status::ready);
+  BOOST_CHECK(!pending.get());
+  BOOST_CHECK(kill(stopped, 0) != 0);
+
+  // The worker serves the next call from a fresh process
+  string result;
+  BOOST_CHECK(ScillaClient::GetInstance().CallRunner(
+      VERSION, MakeRequest("after_reset"), result));
+  BOOST_CHECK_EQUAL(result, "run:after_reset");
+  BOOST_REQUIRE_EQUAL(GetCalls("after_reset").size(), 1);
+  BOOST_CHECK_NE(GetCalls("after_reset").front(), stopped);
+
+  BOOST_CHECK_EQUAL(GetCalls("timed_out").size(), 1);
+}
+
+// A call still waiting for an idle worker is dropped without reaching any
+// server.
+BOOST_AUTO_TEST_CASE(test_reset_queued_call) {
+  const unsigned int poolSize = max(SCILLA_SERVER_POOL_SIZE, 1U);
+
+  vector<Json::Value> busyRequests;
+  vector<future<bool>> busy;
+  for (unsigned int i = 0; i < poolSize; ++i) {
+    busyRequests.emplace_back(MakeRequest("busy", 60000));
+    busyRequests.back()["index"] = i;
+    busy.emplace_back(CallRunnerAsync(busyRequests.back()));
+  }
+  BOOST_REQUIRE(WaitForCalls("busy", poolSize));
+
+  const Json::Value request = MakeRequest("queued");
+  auto queued = CallRunnerAsync(request);
+  BOOST_CHECK(queued.wait_for(chrono::milliseconds(200)) ==
+              future_status::timeout);
+
+  ScillaClient::GetInstance().ResetWorker(VERSION, request);
+  BOOST_REQUIRE(queued.wait_for(chrono::seconds(10)) == future_status::ready);
+  BOOST_CHECK(!queued.get());
+
+  for (const auto& busyRequest : busyRequests) {
+    ScillaClient::GetInstance().ResetWorker(VERSION, busyRequest);
+  }
+  for (auto& call : busy) {
+    BOOST_REQUIRE(call.wait_for(chrono::seconds(10)) == future_status::ready);
+    BOOST_CHECK(!call.get());
+  }
+
+  BOOST_CHECK(GetCalls("queued").empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2023 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "common/Constants.h"
+#include "libScilla/ScillaWorkspace.h"
+#include "libUtils/Logger.h"
+
+#define BOOST_TEST_MODULE scillaworkspace
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+namespace fs = std::filesystem;
+
+namespace {
+
+// Where ScillaWorkspace puts the per-process roots, resolved the same way
+fs::path GetBase() {
+  const fs::path fallback = fs::current_path() / SCILLA_FILES;
+  if (SCILLA_WORKSPACE_ROOT.empty()) {
+    return fallback;
+  }
+  std::error_code ec;
+  const fs::path base = fs::absolute(SCILLA_WORKSPACE_ROOT);
+  fs::create_directories(base, ec);
+  return ec ? fallback : base;
+}
+
+ino_t GetInode(const string& path) {
+  struct stat st {};
+  BOOST_REQUIRE_EQUAL(stat(path.c_str(), &st), 0);
+  return st.st_ino;
+}
+
+string ReadFile(const string& path) {
+  ifstream is(path, ios::binary);
+  return {istreambuf_iterator<char>(is), istreambuf_iterator<char>()};
+}
+
+size_t CountCachedCode() {
+  size_t count = 0;
+  for (const auto& entry :
+       fs::directory_iterator(ScillaWorkspace::GetRoot() / "code")) {
+    if (entry.is_regular_file()) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+}  // namespace
+
+struct Fixture {
+  Fixture() { INIT_STDOUT_LOGGER() }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
+BOOST_AUTO_TEST_SUITE(scillaworkspace)
+
+// Must run first: the sweep happens when the root is first resolved
+BOOST_AUTO_TEST_CASE(test_remove_stale_directories) {
+  const fs::path base = GetBase();
+  fs::create_directories(base);
+
+  // A child that has exited and been reaped leaves a pid nobody owns
+  const pid_t child = fork();
+  BOOST_REQUIRE(child >= 0);
+  if (child == 0) {
+    _exit(0);
+  }
+  BOOST_REQUIRE_EQUAL(waitpid(child, nullptr, 0), child);
+
+  const fs::path dead = base / to_string(child);
+  const fs::path alive = base / to_string(getppid());
+  const fs::path other = base / "not_a_pid";
+  for (const auto& dir : {dead, alive, other}) {
+    fs::create_directories(dir / "1");
+  }
+
+  BOOST_REQUIRE(!ScillaWorkspace::GetRoot().empty());
+  BOOST_CHECK_EQUAL(ScillaWorkspace::GetRoot(), base / to_string(getpid()));
+  BOOST_CHECK(!fs::exists(dead));
+  BOOST_CHECK(fs::exists(alive));
+  BOOST_CHECK(fs::exists(other));
+
+  fs::remove_all(alive);
+  fs::remove_all(other);
+}
+
+BOOST_AUTO_TEST_CASE(test_distinct_directories) {
+  vector<unique_ptr<ScillaWorkspace>> workspaces(8);
+  vector<thread> threads;
+  for (auto& workspace : workspaces) {
+    threads.emplace_back(
+        [&workspace]() { workspace = make_unique<ScillaWorkspace>(); });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  set<string> dirs;
+  for (const auto& workspace : workspaces) {
+    BOOST_REQUIRE(workspace->IsReady());
+    const auto dir = fs::path(workspace->GetInitJsonPath()).parent_path();
+    BOOST_CHECK(fs::is_directory(dir));
+    dirs.insert(dir.string());
+  }
+  BOOST_CHECK_EQUAL(dirs.size(), workspaces.size());
+
+  BOOST_CHECK(workspaces[0]->ExportInitJson("[]"));
+  BOOST_CHECK(fs::exists(workspaces[0]->GetInitJsonPath()));
+  BOOST_CHECK(!fs::exists(workspaces[1]->GetInitJsonPath()));
+}
+
+BOOST_AUTO_TEST_CASE(test_removed_on_destruction) {
+  fs::path dir;
+  {
+    ScillaWorkspace workspace;
+    BOOST_REQUIRE(workspace.IsReady());
+    BOOST_CHECK(workspace.ExportInitJson("[]"));
+    BOOST_CHECK(workspace.ExportCode("scilla_version 0", false));
+    dir = fs::path(workspace.GetInitJsonPath()).parent_path();
+    BOOST_CHECK(fs::exists(dir));
+  }
+  BOOST_CHECK(!fs::exists(dir));
+}
+
+BOOST_AUTO_TEST_CASE(test_code_cache_hit_links_same_inode) {
+  const string code = "scilla_version 0\n(* cache hit *)";
+
+  ScillaWorkspace first;
+  ScillaWorkspace second;
+  BOOST_REQUIRE(first.ExportCode(code, false));
+  BOOST_REQUIRE(second.ExportCode(code, false));
+
+  BOOST_CHECK_EQUAL(GetInode(first.GetCodePath(false)),
+                    GetInode(second.GetCodePath(false)));
+  // Both workspaces and the cache entry
+  BOOST_CHECK_EQUAL(fs::hard_link_count(first.GetCodePath(false)), 3);
+  BOOST_CHECK_EQUAL(ReadFile(second.GetCodePath(false)), code);
+
+  ScillaWorkspace library;
+  BOOST_REQUIRE(library.ExportCode(code, true));
+  BOOST_CHECK_NE(GetInode(library.GetCodePath(true)),
+                 GetInode(first.GetCodePath(false)));
+}
+
+BOOST_AUTO_TEST_CASE(test_code_cache_lru_eviction) {
+  const auto capacity = max(SCILLA_CODE_CACHE_SIZE, 1U);
+
+  ScillaWorkspace oldest;
+  BOOST_REQUIRE(oldest.ExportCode("(* oldest *)", false));
+  BOOST_CHECK_EQUAL(fs::hard_link_count(oldest.GetCodePath(false)), 2);
+
+  // Filling the cache pushes out the least recently used entry only
+  for (unsigned int i = 0; i < capacity; ++i) {
+    ScillaWorkspace workspace;
+    BOOST_REQUIRE(workspace.ExportCode("(* " + to_string(i) + " *)", false));
+  }
+  BOOST_CHECK_EQUAL(CountCachedCode(), capacity);
+  BOOST_CHECK_EQUAL(fs::hard_link_count(oldest.GetCodePath(false)), 1);
+  BOOST_CHECK_EQUAL(ReadFile(oldest.GetCodePath(false)), "(* oldest *)");
+
+  // A hit refreshes an entry, so the next insert evicts another one
+  ScillaWorkspace refreshed;
+  BOOST_REQUIRE(refreshed.ExportCode("(* 0 *)", false));
+  ScillaWorkspace newest;
+  BOOST_REQUIRE(newest.ExportCode("(* newest *)", false));
+  BOOST_CHECK_EQUAL(CountCachedCode(), capacity);
+  BOOST_CHECK_EQUAL(fs::hard_link_count(refreshed.GetCodePath(false)), 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_extlibs_skip_unchanged) {
+  const dev::h160 libAddr(
+      "0x1234567890123456789012345678901234567890");
+  const auto codePath = ScillaWorkspace::GetExtlibCodePath(libAddr);
+  const auto initPath = ScillaWorkspace::GetExtlibInitPath(libAddr);
+
+  map<dev::h160, pair<string, string>> exports{
+      {libAddr, {"scilla_version 0\nlibrary L", "[]"}}};
+  BOOST_REQUIRE(ScillaWorkspace::ExportExtlibs(exports));
+  BOOST_CHECK_EQUAL(ReadFile(codePath), exports[libAddr].first);
+  BOOST_CHECK_EQUAL(ReadFile(initPath), exports[libAddr].second);
+
+  // Files are replaced by rename, so an untouched file keeps its inode
+  const auto codeInode = GetInode(codePath);
+  const auto initInode = GetInode(initPath);
+  BOOST_REQUIRE(ScillaWorkspace::ExportExtlibs(exports));
+  BOOST_CHECK_EQUAL(GetInode(codePath), codeInode);
+  BOOST_CHECK_EQUAL(GetInode(initPath), initInode);
+
+  exports[libAddr].second = "[ ]";
+  BOOST_REQUIRE(ScillaWorkspace::ExportExtlibs(exports));
+  BOOST_CHECK_EQUAL(GetInode(codePath), codeInode);
+  BOOST_CHECK_NE(GetInode(initPath), initInode);
+  BOOST_CHECK_EQUAL(ReadFile(initPath), "[ ]");
+
+  // A file removed behind our back is written again
+  fs::remove(codePath);
+  BOOST_REQUIRE(ScillaWorkspace::ExportExtlibs(exports));
+  BOOST_CHECK_EQUAL(ReadFile(codePath), exports[libAddr].first);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -22,6 +22,7 @@
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 #include "libPersistence/ScillaMessage.pb.h"
 #pragma GCC diagnostic pop
+#include "libScilla/ScillaIPCBinaryServer.h"
 #include "libScilla/ScillaIPCServer.h"
 #include "libScilla/UnixDomainSocketClient.h"
 #include "libScilla/UnixDomainSocketServer.h"
@@ -41,6 +42,45 @@ struct Fixture {
 
 BOOST_GLOBAL_FIXTURE(Fixture);
 
+namespace {
+
+void AppendField(std::string& out, const std::string& field) {
+  const uint32_t length = field.size();
+  out += {static_cast<char>(length >> 24), static_cast<char>(length >> 16),
+          static_cast<char>(length >> 8), static_cast<char>(length)};
+  out += field;
+}
+
+std::string MakeRequest(ScillaIPCBinaryServer::Method method,
+                        const std::vector<std::string>& fields,
+                        uint32_t count) {
+  std::string request(1, static_cast<char>(method));
+  request += {static_cast<char>(count >> 24), static_cast<char>(count >> 16),
+              static_cast<char>(count >> 8), static_cast<char>(count)};
+  for (const auto& field : fields) {
+    AppendField(request, field);
+  }
+  return request;
+}
+
+uint32_t ReadLength(const std::string& in, size_t pos) {
+  return (static_cast<uint32_t>(static_cast<uint8_t>(in[pos])) << 24) |
+         (static_cast<uint8_t>(in[pos + 1]) << 16) |
+         (static_cast<uint8_t>(in[pos + 2]) << 8) |
+         static_cast<uint8_t>(in[pos + 3]);
+}
+
+// Reads the u32-prefixed field at pos and advances pos past it.
+std::string ReadField(const std::string& in, size_t& pos) {
+  const uint32_t length = ReadLength(in, pos);
+  pos += 4;
+  std::string field = in.substr(pos, length);
+  pos += length;
+  return field;
+}
+
+}  // namespace
+
 BOOST_AUTO_TEST_SUITE(scillaipc)
 
 // NOTE: Remember to use unique field names for different tests
@@ -921,4 +961,113 @@ BOOST_AUTO_TEST_CASE(test_scillatestsuite) {
   LOG_GENERAL(INFO, "Test_ScillaIPCServer: server has stopped listening.");
 }
 
+// Batched update and fetch over the binary socket.
+BOOST_AUTO_TEST_CASE(test_binary_batch) {
+  rpc::UnixDomainSocketServer s(SCILLA_IPC_SOCKET_PATH);
+  ScillaIPCServer server(nullptr, s);
+  ScillaIPCBinaryServer binaryServer(server, SCILLA_IPC_BINARY_SOCKET_PATH);
+  BOOST_REQUIRE(binaryServer.StartListening());
+
+  // Set foo[key1] and foo[key2] in one request.
+  ProtoScillaQuery query;
+  query.set_name("foo_test_binary_batch");
+  query.set_mapdepth(1);
+  std::vector<std::string> fields;
+  for (const auto& key : {"key1", "key2"}) {
+    query.clear_indices();
+    query.add_indices(key);
+    ProtoScillaVal value;
+    value.set_bval(std::string("val_") + key);
+    fields.emplace_back(query.SerializeAsString());
+    fields.emplace_back(value.SerializeAsString());
+  }
+  std::string frame;
+  AppendField(frame,
+              MakeRequest(ScillaIPCBinaryServer::Method::UPDATE_STATE_VALUE,
+                          fields, 2));
+
+  // Then fetch key1, key2 and the absent key3 in another.
+  fields.clear();
+  for (const auto& key : {"key1", "key2", "key3"}) {
+    query.clear_indices();
+    query.add_indices(key);
+    fields.emplace_back(query.SerializeAsString());
+  }
+  AppendField(frame,
+              MakeRequest(ScillaIPCBinaryServer::Method::FETCH_STATE_VALUE,
+                          fields, 3));
+
+  // Both frames go over the same connection.
+  boost::asio::io_context ioContext;
+  boost::asio::local::stream_protocol::socket socket(ioContext);
+  socket.connect(boost::asio::local::stream_protocol::endpoint(
+      SCILLA_IPC_BINARY_SOCKET_PATH));
+  boost::asio::write(socket, boost::asio::buffer(frame));
+
+  std::vector<std::string> responses;
+  for (int i = 0; i < 2; ++i) {
+    std::string header(4, '\0');
+    boost::asio::read(socket, boost::asio::buffer(header));
+    std::string body(ReadLength(header, 0), '\0');
+    boost::asio::read(socket, boost::asio::buffer(body));
+    responses.emplace_back(body);
+  }
+
+  BOOST_REQUIRE_EQUAL(responses[0].size(), 1);
+  BOOST_CHECK_EQUAL(responses[0][0], 0);
+
+  const auto& fetched = responses[1];
+  BOOST_REQUIRE(!fetched.empty());
+  BOOST_CHECK_EQUAL(fetched[0], 0);
+  size_t pos = 1;
+  for (const auto& key : {"key1", "key2"}) {
+    BOOST_CHECK_EQUAL(fetched[pos++], 1);
+    ProtoScillaVal value;
+    value.ParseFromString(ReadField(fetched, pos));
+    BOOST_CHECK_EQUAL(value.bval(), std::string("val_") + key);
+  }
+  BOOST_CHECK_EQUAL(fetched[pos++], 0);
+  ReadField(fetched, pos);
+  BOOST_CHECK_EQUAL(pos, fetched.size());
+
+  binaryServer.StopListening();
+}
+
+// Truncated batches are rejected before anything is applied.
+BOOST_AUTO_TEST_CASE(test_binary_malformed) {
+  rpc::UnixDomainSocketServer s(SCILLA_IPC_SOCKET_PATH);
+  ScillaIPCServer server(nullptr, s);
+  ScillaIPCBinaryServer binaryServer(server, SCILLA_IPC_BINARY_SOCKET_PATH);
+
+  ProtoScillaQuery query;
+  query.set_name("foo_test_binary_malformed");
+  query.set_mapdepth(0);
+  ProtoScillaVal value;
+  value.set_bval("420");
+
+  // Two entries announced, one and a half sent.
+  std::string response;
+  binaryServer.HandleRequest(
+      MakeRequest(ScillaIPCBinaryServer::Method::UPDATE_STATE_VALUE,
+                  {query.SerializeAsString(), value.SerializeAsString(),
+                   query.SerializeAsString()},
+                  2),
+      response);
+  BOOST_REQUIRE(!response.empty());
+  BOOST_CHECK_EQUAL(response[0], 1);
+
+  binaryServer.HandleRequest(
+      MakeRequest(ScillaIPCBinaryServer::Method::FETCH_STATE_VALUE,
+                  {query.SerializeAsString()}, 1),
+      response);
+  // Nothing was written by the rejected batch.
+  BOOST_REQUIRE_GE(response.size(), 2);
+  BOOST_CHECK_EQUAL(response[0], 0);
+  BOOST_CHECK_EQUAL(response[1], 0);
+
+  binaryServer.HandleRequest(std::string(1, '\x7f') + std::string(4, '\0'),
+                             response);
+  BOOST_CHECK_EQUAL(response[0], 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
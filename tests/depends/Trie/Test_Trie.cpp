@@ -678,4 +678,76 @@ BOOST_AUTO_TEST_CASE(triePerf) {
   //        it.\n";
 }
 
+BOOST_AUTO_TEST_CASE(trieInsertBatch) {
+  INIT_STDOUT_LOGGER();
+
+  LOG_MARKER();
+
+  auto makeKey = [](unsigned _i) {
+    return asBytes(sha3(asBytes(std::to_string(_i))).hex().substr(0, 40));
+  };
+
+  MemoryDB serialDB;
+  MemoryDB batchDB;
+  GenericTrieDB<MemoryDB> serial(&serialDB);
+  GenericTrieDB<MemoryDB> batch(&batchDB);
+  serial.init();
+  batch.init();
+
+  // Builds the first state from empty, then updates half of it and adds more.
+  for (unsigned round = 0; round < 2; ++round) {
+    std::vector<std::pair<zbytes, zbytes>> entries;
+    for (unsigned i = round * 200; i < round * 200 + 400; ++i) {
+      entries.emplace_back(makeKey(i), asBytes(std::to_string(i + round)));
+    }
+    for (auto const& entry : entries) {
+      serial.insert(entry.first, entry.second);
+    }
+    batch.insertBatch(entries, 4);
+
+    BOOST_REQUIRE_EQUAL(serial.root(), batch.root());
+    for (auto const& entry : entries) {
+      BOOST_CHECK_EQUAL(batch.at(entry.first), asString(entry.second));
+    }
+  }
+
+  // Only intermediate roots, which are dead either way, may differ.
+  BOOST_CHECK(serialDB.keys() == batchDB.keys());
+}
+
+BOOST_AUTO_TEST_CASE(trieInsertBatchSplitsHexKeys) {
+  INIT_STDOUT_LOGGER();
+
+  LOG_MARKER();
+
+  // Same keys as the state trie: hex strings of addresses, whose first
+  // nibble is always 3 or 6.
+  std::vector<std::pair<zbytes, zbytes>> entries;
+  for (unsigned i = 0; i < 1000; ++i) {
+    h160 address = right160(sha3(asBytes(std::to_string(i))));
+    entries.emplace_back(asBytes(address.hex()), asBytes(std::to_string(i)));
+  }
+
+  MemoryDB serialDB;
+  GenericTrieDB<MemoryDB> serial(&serialDB);
+  serial.init();
+  for (auto const& entry : entries) {
+    serial.insert(entry.first, entry.second);
+  }
+
+  for (unsigned threads : {2, 8, 32}) {
+    MemoryDB batchDB;
+    GenericTrieDB<MemoryDB> batch(&batchDB);
+    batch.init();
+    size_t subtrees = batch.insertBatch(entries, threads);
+
+    BOOST_CHECK_GE(subtrees, threads);
+    BOOST_REQUIRE_EQUAL(serial.root(), batch.root());
+    for (auto const& entry : entries) {
+      BOOST_CHECK_EQUAL(batch.at(entry.first), asString(entry.second));
+    }
+    BOOST_CHECK(serialDB.keys() == batchDB.keys());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
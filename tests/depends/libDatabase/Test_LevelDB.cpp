@@ -28,6 +28,7 @@
 #include "common/Constants.h"
 #include "depends/common/FixedHash.h"
 #include "depends/libDatabase/LevelDB.h"
+#include "depends/libDatabase/LevelDBProfile.h"
 #include "libUtils/Logger.h"
 
 using namespace std;
@@ -124,4 +125,104 @@ BOOST_AUTO_TEST_CASE(iterator_order) {
   delete iter;
 }
 
+BOOST_AUTO_TEST_CASE(binary_blocknum_keys) {
+  LOG_MARKER();
+
+  LevelDB m_testDB("binary_blocknum_keys");
+  m_testDB.ResetDB();
+
+  // Legacy decimal keys, block 17 missing
+  m_testDB.SetBinaryBlockNumKeys(false);
+  for (uint64_t i = 0; i < 30; i++) {
+    if (i != 17) {
+      m_testDB.Insert((uint256_t)i, "v" + to_string(i));
+    }
+  }
+
+  auto Range = [&m_testDB](uint64_t lo, uint64_t hi) {
+    vector<uint64_t> blockNums;
+    m_testDB.ForEachBlockInRange(
+        lo, hi, [&blockNums](uint64_t blockNum, const leveldb::Slice& value) {
+          BOOST_CHECK_EQUAL(value.ToString(), "v" + to_string(blockNum));
+          blockNums.emplace_back(blockNum);
+          return true;
+        });
+    return blockNums;
+  };
+
+  BOOST_CHECK((Range(8, 11) == vector<uint64_t>{8, 9, 10, 11}));
+
+  // New blocks get binary keys, old ones stay readable
+  m_testDB.SetBinaryBlockNumKeys(true);
+  for (uint64_t i = 30; i < 35; i++) {
+    m_testDB.Insert((uint256_t)i, "v" + to_string(i));
+  }
+  BOOST_CHECK_EQUAL(m_testDB.Lookup((uint256_t)3), "v3");
+  BOOST_CHECK_EQUAL(Range(15, 32).size(), 17);
+
+  BOOST_CHECK_EQUAL(m_testDB.MigrateBlockNumKeys(), 29);
+  BOOST_CHECK_EQUAL(m_testDB.MigrateBlockNumKeys(), 0);
+
+  // All keys are now fixed-width and sorted numerically
+  std::unique_ptr<leveldb::Iterator> it{
+      m_testDB.GetDB()->NewIterator(leveldb::ReadOptions())};
+  uint64_t expected = 0;
+  for (it->SeekToFirst(); it->Valid(); it->Next()) {
+    uint64_t blockNum = 0;
+    BOOST_CHECK(LevelDB::ParseBlockNumKey(it->key(), blockNum));
+    BOOST_CHECK_EQUAL(it->key().size(), sizeof(blockNum));
+    BOOST_CHECK_EQUAL(blockNum, expected);
+    expected += (expected == 16) ? 2 : 1;
+  }
+  BOOST_CHECK_EQUAL(expected, 35);
+
+  vector<uint64_t> expectedRange{15, 16};
+  for (uint64_t i = 18; i <= 34; i++) {
+    expectedRange.emplace_back(i);
+  }
+  BOOST_CHECK(Range(15, 100) == expectedRange);
+
+  BOOST_CHECK_EQUAL(m_testDB.DeleteKey((uint256_t)9), 0);
+  BOOST_CHECK(!m_testDB.Exists((uint256_t)9));
+}
+
+BOOST_AUTO_TEST_CASE(db_profiles) {
+  LOG_MARKER();
+
+  BOOST_CHECK(GetLevelDBProfile("txBodies") == LevelDBProfile::POINT_LOOKUP);
+  BOOST_CHECK(GetLevelDBProfile("txBodies_3") ==
+              LevelDBProfile::POINT_LOOKUP);
+  BOOST_CHECK(GetLevelDBProfile("state") == LevelDBProfile::POINT_LOOKUP);
+  BOOST_CHECK(GetLevelDBProfile("microBlocks_12") ==
+              LevelDBProfile::APPEND_ONLY);
+  BOOST_CHECK(GetLevelDBProfile("stateDelta") == LevelDBProfile::APPEND_ONLY);
+  BOOST_CHECK(GetLevelDBProfile("state_purge") == LevelDBProfile::DEFAULT);
+  BOOST_CHECK(GetLevelDBProfile("metadata") == LevelDBProfile::DEFAULT);
+
+  const auto pointLookup = GetLevelDBOptions(LevelDBProfile::POINT_LOOKUP);
+  const auto appendOnly = GetLevelDBOptions(LevelDBProfile::APPEND_ONLY);
+  BOOST_CHECK(pointLookup.filter_policy != nullptr);
+  BOOST_CHECK(pointLookup.block_cache == appendOnly.block_cache);
+  BOOST_CHECK_EQUAL(pointLookup.block_size,
+                    size_t(LEVELDB_POINT_LOOKUP_BLOCK_SIZE_KB) << 10);
+  BOOST_CHECK_EQUAL(appendOnly.write_buffer_size,
+                    size_t(LEVELDB_APPEND_ONLY_WRITE_BUFFER_MB) << 20);
+
+  // Reads through the bloom filter must still find every key once the
+  // memtable has been flushed to table files.
+  const string dbName = "txBodies_9999";
+  BOOST_REQUIRE(GetLevelDBProfile(dbName) == LevelDBProfile::POINT_LOOKUP);
+  LevelDB m_testDB(dbName);
+  for (unsigned int i = 0; i < 1000; i++) {
+    m_testDB.Insert(to_string(i), zbytes{(unsigned char)(i & 0xff)});
+  }
+  m_testDB.compact();
+  m_testDB.Reopen();
+  for (unsigned int i = 0; i < 1000; i++) {
+    BOOST_CHECK_EQUAL(m_testDB.Lookup(to_string(i)),
+                      string(1, (char)(i & 0xff)));
+  }
+  BOOST_CHECK(!m_testDB.Exists(string("absent")));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2019 Zilliqa
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string>
+
+#define BOOST_TEST_MODULE nodecachetest
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "depends/common/SHA3.h"
+#include "depends/libDatabase/NodeCache.h"
+#include "libMetrics/Api.h"
+#include "libUtils/Logger.h"
+
+using namespace std;
+using namespace dev;
+
+struct Fixture {
+  Fixture() {
+    INIT_STDOUT_LOGGER();
+    Metrics::GetInstance().Initialize();
+  }
+};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
+
+BOOST_AUTO_TEST_SUITE(nodecachetest)
+
+BOOST_AUTO_TEST_CASE(get_put_erase) {
+  NodeCache cache(1 << 20, 4);
+  const h256 key = sha3(string("node"));
+
+  string value;
+  BOOST_CHECK(!cache.Get(key, value));
+
+  cache.Put(key, "rlp");
+  BOOST_REQUIRE(cache.Get(key, value));
+  BOOST_CHECK_EQUAL(value, "rlp");
+
+  cache.Erase(key);
+  BOOST_CHECK(!cache.Get(key, value));
+
+  cache.Put(key, "rlp");
+  cache.Clear();
+  BOOST_CHECK(!cache.Get(key, value));
+}
+
+BOOST_AUTO_TEST_CASE(evicts_least_recently_used) {
+  // One shard holding a handful of 1KB nodes.
+  NodeCache cache(8 * 1024, 1);
+  const string node(1000, 'x');
+
+  for (unsigned i = 0; i < 7; ++i) {
+    cache.Put(sha3(to_string(i)), node);
+  }
+
+  // Touch the oldest so that the next insert evicts the second oldest.
+  string value;
+  BOOST_REQUIRE(cache.Get(sha3(to_string(0)), value));
+  cache.Put(sha3(to_string(7)), node);
+
+  BOOST_CHECK(cache.Get(sha3(to_string(0)), value));
+  BOOST_CHECK(!cache.Get(sha3(to_string(1)), value));
+  BOOST_CHECK(cache.Get(sha3(to_string(7)), value));
+}
+
+BOOST_AUTO_TEST_CASE(disabled) {
+  NodeCache cache(0, 16);
+  const h256 key = sha3(string("node"));
+
+  cache.Put(key, "rlp");
+  string value;
+  BOOST_CHECK(!cache.Enabled());
+  BOOST_CHECK(!cache.Get(key, value));
+}
+
+BOOST_AUTO_TEST_SUITE_END()